@@ -0,0 +1,82 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2025
+
+   TrackLinkLoadGen - Engine Compatibility
+
+   The bits of CoreMinimal.h the plugin's ThirdParty sources use, so that
+   UDPManager builds outside the engine. Logging goes to stderr.
+  ========================================================================*/
+
+#pragma once
+
+#include <cstdio>
+
+#if defined(_WIN32)
+	#error "TrackLinkLoadGen is a Linux/POSIX tool; use the TrackLink simulators on Windows"
+#endif
+
+#define PLATFORM_WINDOWS 0
+#if defined(__linux__)
+	#define PLATFORM_LINUX 1
+#else
+	#define PLATFORM_LINUX 0
+#endif
+#if defined(__APPLE__)
+	#define PLATFORM_MAC 1
+#else
+	#define PLATFORM_MAC 0
+#endif
+
+#define TEXT(x) x
+#define ANSI_TO_TCHAR(Str) (Str)
+
+/** Log verbosity; messages above the threshold are dropped */
+namespace ELogVerbosity
+{
+	enum Type { NoLogging, Fatal, Error, Warning, Display, Log, Verbose, VeryVerbose };
+}
+
+/** Highest verbosity printed by UE_LOG (Warning unless --verbose) */
+extern ELogVerbosity::Type GLogVerbosity;
+
+#define DECLARE_LOG_CATEGORY_EXTERN(CategoryName, DefaultVerbosity, CompileTimeVerbosity)
+
+#define UE_LOG(CategoryName, Verbosity, Format, ...) \
+	do \
+	{ \
+		if (ELogVerbosity::Verbosity <= GLogVerbosity) \
+		{ \
+			fprintf(stderr, #CategoryName ": " #Verbosity ": " Format "\n", ##__VA_ARGS__); \
+		} \
+	} while (0)
+
+// POSIX spelling of the Winsock names used by InetAddr and UDPManager
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <sys/ioctl.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <errno.h>
+#include <ctype.h>
+#include <string.h>
+
+typedef int SOCKET;
+typedef unsigned short USHORT;
+typedef unsigned short WORD;
+typedef unsigned long ULONG;
+
+#define INVALID_SOCKET (-1)
+#define SOCKET_ERROR (-1)
+
+#define closesocket close
+#define ioctlsocket ioctl
+#define strcpy_s(Dest, DestSize, Source) snprintf(Dest, DestSize, "%s", Source)
+
+// Winsock start-up is a no-op on POSIX
+struct WSADATA {};
+#define MAKEWORD(Low, High) ((WORD)(((Low) & 0xff) | (((High) & 0xff) << 8)))
+inline int WSAStartup(WORD, WSADATA*) { return 0; }
+inline int WSAGetLastError() { return errno; }
@@ -0,0 +1,17 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2025
+
+   TrackLinkLoadGen - Engine Compatibility
+
+   Module interface declared by AefPharus.h; never instantiated here.
+  ========================================================================*/
+
+#pragma once
+
+class IModuleInterface
+{
+public:
+	virtual ~IModuleInterface() {}
+	virtual void StartupModule() {}
+	virtual void ShutdownModule() {}
+};
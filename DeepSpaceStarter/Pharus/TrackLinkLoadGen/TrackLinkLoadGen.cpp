@@ -0,0 +1,795 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2025
+
+   TrackLinkLoadGen - Headless TrackLink Load Generator
+
+   Synthesises N tracks and sends them as TrackLink frames over UDP
+   (unicast or multicast), at the wire format of ThirdParty/TrackLinkWire.h,
+   or with --tuio as TUIO 1.1 /tuio/2Dcur bundles (ThirdParty/OscPacket.h).
+   Stands in for the Windows simulators when load-testing on Linux.
+  ========================================================================*/
+
+#include "UDPManager.h"
+#include "OscPacket.h"
+#include "TrackLinkWire.h"
+#include "TrackRecord.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+ELogVerbosity::Type GLogVerbosity = ELogVerbosity::Warning;
+
+using namespace pharus;
+
+namespace
+{
+	/** Largest datagram a TrackLinkClient receives whole (TrackLinkClient::RECV_BUFFER_SIZE) */
+	constexpr int MaxClientDatagram = 20480;
+	/** Largest frame a TrackLinkClient reassembles from several datagrams (same buffer) */
+	constexpr int MaxClientFrame = 20480;
+	/** Radius of the echo ring around a track, meters */
+	constexpr float EchoRadius = 0.15f;
+	constexpr float Pi = 3.14159265358979f;
+	/** Port Pharus' tuiosender and most TUIO clients use */
+	constexpr unsigned short TuioPort = 3333;
+	/** Bundle element sizes with their size prefix: 2Dcur "set" (s, 5 floats) and "fseq" */
+	constexpr int TuioSetSize = 4 + 12 + 12 + 4 + 4 + 5 * 4;
+	constexpr int TuioFrameSequenceSize = 4 + 12 + 4 + 8 + 4;
+
+	enum class EMotion
+	{
+		Static,
+		Linear,
+		Circle,
+		Walk
+	};
+
+	struct FOptions
+	{
+		int Tracks = 100;
+		double Rate = 30.0;
+		int Echoes = 2;
+		EMotion Motion = EMotion::Walk;
+		/** Meters per second */
+		float Speed = 1.2f;
+		/** Mean track lifetime in seconds, 0 = tracks live until the generator stops */
+		double Lifetime = 0.0;
+		/** Tracking area, meters (Deep Space floor as configured in the simulators) */
+		float Width = 15.0f;
+		float Height = 8.3f;
+
+		std::string Host = "127.0.0.1";
+		bool bMulticast = false;
+		std::string Group = "239.1.1.1";
+		int TTL = 1;
+		/** Local address of the interface multicast leaves on, empty = routing table */
+		std::string Interface;
+		unsigned short Port = 44345;
+		bool bPortSet = false;
+		/** Send TUIO 1.1 instead of TrackLink */
+		bool bTuio = false;
+		int MaxDatagram = 1472;
+		/** Cut frames at MaxDatagram regardless of record boundaries */
+		bool bSplit = false;
+		int SendBufferSize = 4 * 1024 * 1024;
+
+		/** Seconds to run, 0 = until interrupted */
+		double Duration = 0.0;
+		unsigned int IdBase = 1;
+		unsigned int Seed = 1;
+		bool bQuiet = false;
+	};
+
+	struct FTrack
+	{
+		unsigned int ID = 0;
+		TrackState State = TS_NEW;
+		float X = 0.0f, Y = 0.0f;
+		float VX = 0.0f, VY = 0.0f;
+		/** Last heading, kept while standing still */
+		float DirX = 1.0f, DirY = 0.0f;
+		/** Circle: center, radius and angle */
+		float CX = 0.0f, CY = 0.0f, Radius = 0.0f, Angle = 0.0f;
+		/** Seconds alive and seconds until the track leaves (0 = never) */
+		double Age = 0.0;
+		double Life = 0.0;
+	};
+
+	struct FCounters
+	{
+		unsigned long long Frames = 0;
+		unsigned long long Datagrams = 0;
+		unsigned long long Bytes = 0;
+		unsigned long long SendErrors = 0;
+		unsigned long long LateFrames = 0;
+		unsigned long long NewTracks = 0;
+		unsigned long long LostTracks = 0;
+	};
+
+	std::atomic<bool> GStop(false);
+
+	void HandleSignal(int)
+	{
+		GStop = true;
+	}
+
+	void PrintUsage()
+	{
+		printf(
+			"Usage: TrackLinkLoadGen [options]\n"
+			"\n"
+			"Tracks:\n"
+			"  --tracks N          Tracks alive at any time (default 100)\n"
+			"  --rate HZ           Frames per second (default 30)\n"
+			"  --echoes N          Echoes per track (default 2)\n"
+			"  --motion MODEL      static | linear | circle | walk (default walk)\n"
+			"  --speed M/S         Track speed in meters per second (default 1.2)\n"
+			"  --lifetime SEC      Mean lifetime; expired tracks leave (TS_OFF) and are replaced\n"
+			"                      by new IDs (default 0 = tracks never leave)\n"
+			"  --area WxH          Tracking area in meters (default 15x8.3)\n"
+			"  --id-base N         First track ID, give each generator its own range (default 1)\n"
+			"  --seed N            Random seed, same seed = same traffic (default 1)\n"
+			"\n"
+			"Output:\n"
+			"  --host ADDR         Unicast destination (default 127.0.0.1)\n"
+			"  --multicast [GROUP] Send to a multicast group instead (default 239.1.1.1)\n"
+			"  --ttl N             Multicast TTL (default 1)\n"
+			"  --interface ADDR    Local address of the NIC to send multicast on (default: route)\n"
+			"  --port N            Destination port (default 44345, with --tuio 3333)\n"
+			"  --tuio              Send TUIO 1.1 /tuio/2Dcur bundles (alive, set, fseq) instead of\n"
+			"                      TrackLink; echoes are not sent, large frames span several\n"
+			"                      bundles with the same fseq\n"
+			"  --max-datagram N    Datagram size limit in bytes, at most %d (default 1472)\n"
+			"  --split             Cut frames at --max-datagram mid-record, to exercise reassembly\n"
+			"  --send-buffer N     Socket send buffer in bytes (default 4194304)\n"
+			"\n"
+			"Run:\n"
+			"  --duration SEC      Stop after SEC seconds (default 0 = until Ctrl+C)\n"
+			"  --quiet             No per-second statistics\n"
+			"  --verbose           Log every socket call\n",
+			MaxClientDatagram);
+	}
+
+	bool ParseMotion(const char* Name, EMotion& OutMotion)
+	{
+		if (strcmp(Name, "static") == 0) { OutMotion = EMotion::Static; return true; }
+		if (strcmp(Name, "linear") == 0) { OutMotion = EMotion::Linear; return true; }
+		if (strcmp(Name, "circle") == 0) { OutMotion = EMotion::Circle; return true; }
+		if (strcmp(Name, "walk") == 0) { OutMotion = EMotion::Walk; return true; }
+		return false;
+	}
+
+	const char* MotionName(EMotion Motion)
+	{
+		switch (Motion)
+		{
+		case EMotion::Static: return "static";
+		case EMotion::Linear: return "linear";
+		case EMotion::Circle: return "circle";
+		default: return "walk";
+		}
+	}
+
+	/** Bundle element size of a 2Dcur "alive" listing Tracks sessions, with its size prefix */
+	int TuioAliveSize(int Tracks)
+	{
+		// address, type tags (",s" + one 'i' per session), "alive", session IDs
+		return 4 + 12 + osc::paddedSize(2 + Tracks + 1) + 8 + 4 * Tracks;
+	}
+
+	/** Parses argv; accepts "--name value" and "--name=value" */
+	bool ParseArgs(int Argc, char** Argv, FOptions& Options)
+	{
+		for (int i = 1; i < Argc; ++i)
+		{
+			std::string Name = Argv[i];
+			std::string Value;
+			bool bHasValue = false;
+			const size_t Equals = Name.find('=');
+			if (Equals != std::string::npos)
+			{
+				Value = Name.substr(Equals + 1);
+				Name = Name.substr(0, Equals);
+				bHasValue = true;
+			}
+
+			auto Next = [&](const char*& Out) -> bool
+			{
+				if (!bHasValue)
+				{
+					if (i + 1 >= Argc)
+					{
+						fprintf(stderr, "%s needs a value\n", Name.c_str());
+						return false;
+					}
+					Value = Argv[++i];
+				}
+				Out = Value.c_str();
+				return true;
+			};
+			const char* Arg = nullptr;
+
+			if (Name == "--help" || Name == "-h")
+			{
+				PrintUsage();
+				exit(0);
+			}
+			else if (Name == "--tracks") { if (!Next(Arg)) return false; Options.Tracks = atoi(Arg); }
+			else if (Name == "--rate") { if (!Next(Arg)) return false; Options.Rate = atof(Arg); }
+			else if (Name == "--echoes") { if (!Next(Arg)) return false; Options.Echoes = atoi(Arg); }
+			else if (Name == "--speed") { if (!Next(Arg)) return false; Options.Speed = (float)atof(Arg); }
+			else if (Name == "--lifetime") { if (!Next(Arg)) return false; Options.Lifetime = atof(Arg); }
+			else if (Name == "--id-base") { if (!Next(Arg)) return false; Options.IdBase = (unsigned int)strtoul(Arg, nullptr, 10); }
+			else if (Name == "--seed") { if (!Next(Arg)) return false; Options.Seed = (unsigned int)strtoul(Arg, nullptr, 10); }
+			else if (Name == "--host") { if (!Next(Arg)) return false; Options.Host = Arg; }
+			else if (Name == "--ttl") { if (!Next(Arg)) return false; Options.TTL = atoi(Arg); }
+			else if (Name == "--interface") { if (!Next(Arg)) return false; Options.Interface = Arg; }
+			else if (Name == "--port") { if (!Next(Arg)) return false; Options.Port = (unsigned short)atoi(Arg); Options.bPortSet = true; }
+			else if (Name == "--max-datagram") { if (!Next(Arg)) return false; Options.MaxDatagram = atoi(Arg); }
+			else if (Name == "--send-buffer") { if (!Next(Arg)) return false; Options.SendBufferSize = atoi(Arg); }
+			else if (Name == "--duration") { if (!Next(Arg)) return false; Options.Duration = atof(Arg); }
+			else if (Name == "--split") { Options.bSplit = true; }
+			else if (Name == "--tuio") { Options.bTuio = true; }
+			else if (Name == "--quiet") { Options.bQuiet = true; }
+			else if (Name == "--verbose") { GLogVerbosity = ELogVerbosity::VeryVerbose; }
+			else if (Name == "--motion")
+			{
+				if (!Next(Arg))
+					return false;
+				if (!ParseMotion(Arg, Options.Motion))
+				{
+					fprintf(stderr, "Unknown motion model '%s' (static, linear, circle, walk)\n", Arg);
+					return false;
+				}
+			}
+			else if (Name == "--area")
+			{
+				if (!Next(Arg))
+					return false;
+				if (sscanf(Arg, "%fx%f", &Options.Width, &Options.Height) != 2)
+				{
+					fprintf(stderr, "--area expects WxH in meters, e.g. 15x8.3\n");
+					return false;
+				}
+			}
+			else if (Name == "--multicast")
+			{
+				Options.bMulticast = true;
+				// optional group
+				if (bHasValue)
+					Options.Group = Value;
+				else if (i + 1 < Argc && Argv[i + 1][0] != '-')
+					Options.Group = Argv[++i];
+			}
+			else
+			{
+				fprintf(stderr, "Unknown option %s (--help for usage)\n", Name.c_str());
+				return false;
+			}
+		}
+
+		if (Options.Tracks < 0 || Options.Rate <= 0.0 || Options.Echoes < 0 || Options.Speed < 0.0f || Options.Lifetime < 0.0
+			|| Options.Width <= 0.0f || Options.Height <= 0.0f)
+		{
+			fprintf(stderr, "Invalid value: tracks, echoes, speed and lifetime must not be negative; rate and area must be positive\n");
+			return false;
+		}
+		if (Options.bTuio)
+		{
+			if (Options.bSplit)
+			{
+				fprintf(stderr, "--split cuts TrackLink records and does not apply to --tuio\n");
+				return false;
+			}
+			if (!Options.bPortSet)
+				Options.Port = TuioPort;
+			// the first bundle of a frame holds the whole alive list, one set and the fseq
+			const int MinBundle = osc::BUNDLE_HEADER_SIZE + TuioAliveSize(Options.Tracks) + TuioSetSize + TuioFrameSequenceSize;
+			if (Options.MaxDatagram > MaxClientDatagram || Options.MaxDatagram < MinBundle)
+			{
+				fprintf(stderr, "--max-datagram must be between %d (alive list of %d tracks) and %d (client receive buffer)\n",
+					MinBundle, Options.Tracks, MaxClientDatagram);
+				return false;
+			}
+			return true;
+		}
+		const int RecordSize = wire::TRACK_MIN_SIZE + Options.Echoes * wire::ECHO_SIZE;
+		if (Options.MaxDatagram > MaxClientDatagram || (!Options.bSplit && Options.MaxDatagram < RecordSize) || Options.MaxDatagram < 2)
+		{
+			fprintf(stderr, "--max-datagram must be between %d (one track record) and %d (client receive buffer)\n",
+				Options.bSplit ? 2 : RecordSize, MaxClientDatagram);
+			return false;
+		}
+		if (Options.bSplit && RecordSize > MaxClientFrame)
+		{
+			fprintf(stderr, "A track record with %d echoes exceeds the client's reassembly buffer (%d bytes)\n", Options.Echoes, MaxClientFrame);
+			return false;
+		}
+		return true;
+	}
+
+	/**
+	 * Track motion and lifecycle
+	 *
+	 * Positions are in meters inside the area; tracks reflect off its edges.
+	 */
+	class FTrackGenerator
+	{
+	public:
+		explicit FTrackGenerator(const FOptions& InOptions)
+			: Options(InOptions)
+			, Random(InOptions.Seed)
+			, NextID(InOptions.IdBase)
+		{
+			Tracks.resize(Options.Tracks);
+			for (FTrack& Track : Tracks)
+			{
+				Spawn(Track);
+			}
+		}
+
+		std::vector<FTrack>& GetTracks() { return Tracks; }
+
+		/** Advances every track by Dt seconds; a track that left last frame is replaced */
+		void Step(float Dt, FCounters& Counters)
+		{
+			for (FTrack& Track : Tracks)
+			{
+				if (Track.State == TS_OFF)
+				{
+					Spawn(Track);
+					++Counters.NewTracks;
+					continue;
+				}
+				Track.State = TS_CONT;
+				Move(Track, Dt);
+				Track.Age += Dt;
+				if (Track.Life > 0.0 && Track.Age >= Track.Life)
+				{
+					Track.State = TS_OFF;
+					++Counters.LostTracks;
+				}
+			}
+		}
+
+		/** Marks every track as leaving, for the last frame */
+		void RemoveAll()
+		{
+			for (FTrack& Track : Tracks)
+			{
+				Track.State = TS_OFF;
+			}
+		}
+
+	private:
+		float Uniform(float Min, float Max)
+		{
+			return std::uniform_real_distribution<float>(Min, Max)(Random);
+		}
+
+		void Spawn(FTrack& Track)
+		{
+			Track = FTrack();
+			Track.ID = NextID++;
+			Track.State = TS_NEW;
+			Track.X = Uniform(0.0f, Options.Width);
+			Track.Y = Uniform(0.0f, Options.Height);
+			const float Heading = Uniform(0.0f, 2.0f * Pi);
+			Track.DirX = cosf(Heading);
+			Track.DirY = sinf(Heading);
+			if (Options.Lifetime > 0.0)
+			{
+				Track.Life = Options.Lifetime * Uniform(0.5f, 1.5f);
+			}
+
+			switch (Options.Motion)
+			{
+			case EMotion::Static:
+				break;
+			case EMotion::Circle:
+				Track.Radius = Uniform(0.5f, 0.25f * std::min(Options.Width, Options.Height));
+				Track.Angle = Heading;
+				Track.CX = std::min(std::max(Track.X, Track.Radius), Options.Width - Track.Radius);
+				Track.CY = std::min(std::max(Track.Y, Track.Radius), Options.Height - Track.Radius);
+				Track.X = Track.CX + Track.Radius * cosf(Track.Angle);
+				Track.Y = Track.CY + Track.Radius * sinf(Track.Angle);
+				break;
+			default:
+				Track.VX = Track.DirX * Options.Speed;
+				Track.VY = Track.DirY * Options.Speed;
+				break;
+			}
+		}
+
+		void Move(FTrack& Track, float Dt)
+		{
+			switch (Options.Motion)
+			{
+			case EMotion::Static:
+				return;
+			case EMotion::Circle:
+			{
+				Track.Angle += Options.Speed / Track.Radius * Dt;
+				const float NewX = Track.CX + Track.Radius * cosf(Track.Angle);
+				const float NewY = Track.CY + Track.Radius * sinf(Track.Angle);
+				Track.VX = (NewX - Track.X) / Dt;
+				Track.VY = (NewY - Track.Y) / Dt;
+				Track.X = NewX;
+				Track.Y = NewY;
+				break;
+			}
+			case EMotion::Walk:
+			{
+				// heading drifts by ~1 radian per second
+				const float Turn = std::normal_distribution<float>(0.0f, sqrtf(Dt))(Random);
+				const float Cos = cosf(Turn), Sin = sinf(Turn);
+				const float VX = Track.VX * Cos - Track.VY * Sin;
+				const float VY = Track.VX * Sin + Track.VY * Cos;
+				Track.VX = VX;
+				Track.VY = VY;
+			}
+				// fall through
+			case EMotion::Linear:
+				Track.X += Track.VX * Dt;
+				Track.Y += Track.VY * Dt;
+				Reflect(Track.X, Track.VX, Options.Width);
+				Reflect(Track.Y, Track.VY, Options.Height);
+				break;
+			}
+
+			const float Speed = sqrtf(Track.VX * Track.VX + Track.VY * Track.VY);
+			if (Speed > 1e-4f)
+			{
+				Track.DirX = Track.VX / Speed;
+				Track.DirY = Track.VY / Speed;
+			}
+		}
+
+		static void Reflect(float& Position, float& Velocity, float Extent)
+		{
+			if (Position < 0.0f)
+			{
+				Position = -Position;
+				Velocity = fabsf(Velocity);
+			}
+			else if (Position > Extent)
+			{
+				Position = 2.0f * Extent - Position;
+				Velocity = -fabsf(Velocity);
+			}
+			Position = std::min(std::max(Position, 0.0f), Extent);
+		}
+
+		const FOptions& Options;
+		std::mt19937 Random;
+		unsigned int NextID;
+		std::vector<FTrack> Tracks;
+	};
+
+	/** Writes one track record; returns the bytes written (wire::TRACK_MIN_SIZE + echoes) */
+	int WriteRecord(char* Out, const FTrack& Track, const FOptions& Options, float Dt)
+	{
+		char* Cur = Out;
+		*Cur++ = 'T';
+		char* Fields = Cur;
+		wire::write<unsigned int>(Fields + wire::OFS_ID, Track.ID);
+		wire::write<int32_t>(Fields + wire::OFS_STATE, (int32_t)Track.State);
+		wire::write<float>(Fields + wire::OFS_CURRENT_POS, Track.X);
+		wire::write<float>(Fields + wire::OFS_CURRENT_POS + 4, Track.Y);
+		wire::write<float>(Fields + wire::OFS_EXPECT_POS, Track.X + Track.VX * Dt);
+		wire::write<float>(Fields + wire::OFS_EXPECT_POS + 4, Track.Y + Track.VY * Dt);
+		wire::write<float>(Fields + wire::OFS_ORIENTATION, Track.DirX);
+		wire::write<float>(Fields + wire::OFS_ORIENTATION + 4, Track.DirY);
+		wire::write<float>(Fields + wire::OFS_SPEED, sqrtf(Track.VX * Track.VX + Track.VY * Track.VY));
+		wire::write<float>(Fields + wire::OFS_REL_POS, Track.X / Options.Width);
+		wire::write<float>(Fields + wire::OFS_REL_POS + 4, Track.Y / Options.Height);
+		Cur += wire::TRACK_FIELDS_SIZE;
+
+		// echoes on a ring around the track, relative coordinates like relPos
+		for (int e = 0; e < Options.Echoes; ++e)
+		{
+			const float Angle = 2.0f * Pi * e / Options.Echoes;
+			*Cur = 'E';
+			wire::write<float>(Cur + 1, (Track.X + EchoRadius * cosf(Angle)) / Options.Width);
+			wire::write<float>(Cur + 5, (Track.Y + EchoRadius * sinf(Angle)) / Options.Height);
+			Cur[wire::ECHO_SIZE - 1] = 'e';
+			Cur += wire::ECHO_SIZE;
+		}
+		*Cur++ = 't';
+		return (int)(Cur - Out);
+	}
+
+	class FSender
+	{
+	public:
+		FSender(const FOptions& InOptions, FCounters& InCounters)
+			: Options(InOptions)
+			, Counters(InCounters)
+		{
+		}
+
+		bool Open()
+		{
+			if (!Socket.Create())
+			{
+				fprintf(stderr, "Unable to create a UDP socket (errno %d)\n", errno);
+				return false;
+			}
+			if (!Socket.SetSendBufferSize(Options.SendBufferSize))
+			{
+				fprintf(stderr, "Warning: unable to set the send buffer to %d bytes\n", Options.SendBufferSize);
+			}
+			// not ConnectMcast(): that binds the destination port, and this socket only sends
+			const char* Destination = Options.bMulticast ? Options.Group.c_str() : Options.Host.c_str();
+			if (!Socket.Connect(Destination, Options.Port))
+			{
+				fprintf(stderr, "Unable to resolve %s\n", Destination);
+				return false;
+			}
+			if (Options.bMulticast && !Socket.SetTTL(Options.TTL))
+			{
+				fprintf(stderr, "Warning: unable to set the multicast TTL to %d\n", Options.TTL);
+			}
+			if (Options.bMulticast && !Options.Interface.empty())
+			{
+				in_addr Interface;
+				Interface.s_addr = inet_addr(Options.Interface.c_str());
+				if (setsockopt(Socket.GetSocket(), IPPROTO_IP, IP_MULTICAST_IF, &Interface, sizeof(Interface)) != 0)
+				{
+					fprintf(stderr, "Unable to send multicast on %s (errno %d)\n", Options.Interface.c_str(), errno);
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/** Sends a frame of whole records, packed into datagrams of at most MaxDatagram bytes */
+		void SendFrame(const char* Frame, const std::vector<int>& RecordEnds)
+		{
+			if (Options.bSplit)
+			{
+				// groups of whole records the client can reassemble, each cut into datagrams
+				int GroupStart = 0;
+				size_t Record = 0;
+				while (Record < RecordEnds.size())
+				{
+					int GroupEnd = RecordEnds[Record++];
+					while (Record < RecordEnds.size() && RecordEnds[Record] - GroupStart <= MaxClientFrame)
+						GroupEnd = RecordEnds[Record++];
+					int Pos = GroupStart;
+					while (Pos < GroupEnd)
+					{
+						int Size = std::min(Options.MaxDatagram, GroupEnd - Pos);
+						// the client takes a datagram ending in 't' as the end of the frame
+						if (Pos + Size < GroupEnd && Frame[Pos + Size - 1] == 't')
+							--Size;
+						Send(Frame + Pos, Size);
+						Pos += Size;
+					}
+					GroupStart = GroupEnd;
+				}
+				return;
+			}
+
+			int DatagramStart = 0;
+			int DatagramEnd = 0;
+			for (const int RecordEnd : RecordEnds)
+			{
+				if (RecordEnd - DatagramStart > Options.MaxDatagram)
+				{
+					Send(Frame + DatagramStart, DatagramEnd - DatagramStart);
+					DatagramStart = DatagramEnd;
+				}
+				DatagramEnd = RecordEnd;
+			}
+			if (DatagramEnd > DatagramStart)
+			{
+				Send(Frame + DatagramStart, DatagramEnd - DatagramStart);
+			}
+		}
+
+		/**
+		 * Sends a frame as TUIO 1.1 /tuio/2Dcur bundles: the first carries the alive list, every one
+		 * as many sets as fit into MaxDatagram and the same fseq, so receivers apply them as one frame.
+		 */
+		void SendTuioFrame(const std::vector<FTrack>& Tracks, int32_t FrameID)
+		{
+			TuioBuffer.resize(Options.MaxDatagram);
+			OscPacketWriter Writer(TuioBuffer.data(), (int)TuioBuffer.size());
+
+			AliveTags.assign(1, 's');
+			for (const FTrack& Track : Tracks)
+			{
+				if (Track.State != TS_OFF)
+					AliveTags.push_back('i');
+			}
+
+			Writer.beginBundle();
+			Writer.beginMessage("/tuio/2Dcur", AliveTags.c_str());
+			Writer.addString("alive");
+			for (const FTrack& Track : Tracks)
+			{
+				if (Track.State != TS_OFF)
+					Writer.addInt((int32_t)Track.ID);
+			}
+			Writer.endMessage();
+
+			for (const FTrack& Track : Tracks)
+			{
+				if (Track.State == TS_OFF)
+					continue;
+				if (Writer.size() + TuioSetSize + TuioFrameSequenceSize > Options.MaxDatagram)
+				{
+					EndTuioBundle(Writer, FrameID);
+					Writer.reset();
+					Writer.beginBundle();
+				}
+				Writer.beginMessage("/tuio/2Dcur", "sifffff");
+				Writer.addString("set");
+				Writer.addInt((int32_t)Track.ID);
+				Writer.addFloat(Track.X / Options.Width);
+				Writer.addFloat(Track.Y / Options.Height);
+				Writer.addFloat(Track.VX / Options.Width);
+				Writer.addFloat(Track.VY / Options.Height);
+				Writer.addFloat(0.0f);
+				Writer.endMessage();
+			}
+			EndTuioBundle(Writer, FrameID);
+		}
+
+	private:
+		void EndTuioBundle(OscPacketWriter& Writer, int32_t FrameID)
+		{
+			Writer.beginMessage("/tuio/2Dcur", "si");
+			Writer.addString("fseq");
+			Writer.addInt(FrameID);
+			Writer.endMessage();
+			Writer.endBundle();
+			if (Writer.overflow())
+			{
+				++Counters.SendErrors;
+				return;
+			}
+			Send(TuioBuffer.data(), Writer.size());
+		}
+
+		void Send(const char* Data, int Size)
+		{
+			// blocks while the send buffer is full, which paces bursts of large frames
+			if (Socket.Send(Data, Size) == Size)
+			{
+				++Counters.Datagrams;
+				Counters.Bytes += Size;
+			}
+			else
+			{
+				++Counters.SendErrors;
+			}
+		}
+
+		const FOptions& Options;
+		FCounters& Counters;
+		UDPManager Socket;
+		std::vector<char> TuioBuffer;
+		std::string AliveTags;
+	};
+}
+
+int main(int Argc, char** Argv)
+{
+	FOptions Options;
+	if (!ParseArgs(Argc, Argv, Options))
+	{
+		return 2;
+	}
+
+	FCounters Counters;
+	FSender Sender(Options, Counters);
+	if (!Sender.Open())
+	{
+		return 1;
+	}
+
+	signal(SIGINT, HandleSignal);
+	signal(SIGTERM, HandleSignal);
+
+	FTrackGenerator Generator(Options);
+	const int RecordSize = wire::TRACK_MIN_SIZE + Options.Echoes * wire::ECHO_SIZE;
+	std::vector<char> Frame((size_t)std::max(Options.Tracks, 1) * RecordSize);
+	std::vector<int> RecordEnds;
+	RecordEnds.reserve(Options.Tracks);
+
+	const float Dt = (float)(1.0 / Options.Rate);
+	int32_t FrameID = 0;
+	auto BuildAndSend = [&]()
+	{
+		if (Options.bTuio)
+		{
+			Sender.SendTuioFrame(Generator.GetTracks(), ++FrameID);
+			++Counters.Frames;
+			return;
+		}
+		RecordEnds.clear();
+		int Size = 0;
+		for (const FTrack& Track : Generator.GetTracks())
+		{
+			Size += WriteRecord(Frame.data() + Size, Track, Options, Dt);
+			RecordEnds.push_back(Size);
+		}
+		Sender.SendFrame(Frame.data(), RecordEnds);
+		++Counters.Frames;
+	};
+
+	printf("TrackLinkLoadGen: %d tracks (%s, %d echoes) at %.1f Hz to %s:%u%s, %d byte datagrams%s%s\n",
+		Options.Tracks, MotionName(Options.Motion), Options.bTuio ? 0 : Options.Echoes, Options.Rate,
+		Options.bMulticast ? Options.Group.c_str() : Options.Host.c_str(), (unsigned)Options.Port,
+		Options.bMulticast ? " (multicast)" : "", Options.MaxDatagram, Options.bSplit ? " (split)" : "",
+		Options.bTuio ? ", TUIO" : "");
+	fflush(stdout);
+
+	using Clock = std::chrono::steady_clock;
+	const Clock::duration Period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / Options.Rate));
+	const Clock::time_point Start = Clock::now();
+	Clock::time_point NextFrame = Start;
+	Clock::time_point NextReport = Start + std::chrono::seconds(1);
+	FCounters Reported;
+
+	Counters.NewTracks = Options.Tracks;
+	while (!GStop)
+	{
+		BuildAndSend();
+
+		const Clock::time_point Now = Clock::now();
+		if (Options.Duration > 0.0 && Now - Start >= std::chrono::duration<double>(Options.Duration))
+		{
+			break;
+		}
+		if (!Options.bQuiet && Now >= NextReport)
+		{
+			const double Seconds = std::chrono::duration<double>(Now - NextReport + std::chrono::seconds(1)).count();
+			printf("%8.1f s  %6.1f fps  %8.0f datagrams/s  %7.2f MB/s  new %llu  lost %llu  late %llu  errors %llu\n",
+				std::chrono::duration<double>(Now - Start).count(),
+				(Counters.Frames - Reported.Frames) / Seconds,
+				(Counters.Datagrams - Reported.Datagrams) / Seconds,
+				(Counters.Bytes - Reported.Bytes) / Seconds / (1024.0 * 1024.0),
+				Counters.NewTracks - Reported.NewTracks, Counters.LostTracks - Reported.LostTracks,
+				Counters.LateFrames - Reported.LateFrames, Counters.SendErrors - Reported.SendErrors);
+			fflush(stdout);
+			Reported = Counters;
+			NextReport = Now + std::chrono::seconds(1);
+		}
+
+		NextFrame += Period;
+		if (Now > NextFrame)
+		{
+			// could not keep up; skip the missed frames instead of bursting to catch up
+			const Clock::duration Behind = Now - NextFrame;
+			Counters.LateFrames += Behind / Period + 1;
+			NextFrame += (Behind / Period + 1) * Period;
+		}
+		std::this_thread::sleep_until(NextFrame);
+
+		Generator.Step(Dt, Counters);
+	}
+
+	// let receivers see every track leave instead of waiting for their lost timeout
+	Generator.RemoveAll();
+	BuildAndSend();
+	Counters.LostTracks += Options.Tracks;
+
+	const double Elapsed = std::chrono::duration<double>(Clock::now() - Start).count();
+	printf("TrackLinkLoadGen: %llu frames, %llu datagrams, %.2f MB in %.1f s (%.1f fps), %llu tracks created, %llu late frames, %llu send errors\n",
+		Counters.Frames, Counters.Datagrams, Counters.Bytes / (1024.0 * 1024.0), Elapsed, Counters.Frames / std::max(Elapsed, 1e-3),
+		Counters.NewTracks, Counters.LateFrames, Counters.SendErrors);
+	return Counters.SendErrors > 0 ? 1 : 0;
+}
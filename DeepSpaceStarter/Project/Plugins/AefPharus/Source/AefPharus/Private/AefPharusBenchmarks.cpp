@@ -0,0 +1,901 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2025
+
+   AefPharus - Benchmarks
+
+   Console commands that measure hot paths of the plugin in isolation.
+   Not compiled into shipping builds.
+
+   Commands:
+   - Pharus.Benchmark.TrackTable [Frames]
+   - Pharus.Benchmark.ReceiveWorkers [MaxWorkers] [Seconds] [Port]
+   - Pharus.Benchmark.Restart [Cycles] [Port]
+   - Pharus.Benchmark.Replay <File> [Runs] [Speed]
+   - Pharus.Benchmark.Parsers [Frames]
+   - Pharus.Benchmark.FloorMapping [Iterations]
+   - Pharus.Benchmark.WallMapping [Iterations]
+   - Pharus.Benchmark.WallLookup [Iterations]
+  ========================================================================*/
+
+#include "AefPharus.h"
+#include "AefPharusInstance.h"
+#include "AefPharusMappingReference.h"
+#include "AefPharusTransforms.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+#include "OscPacket.h"
+#include "TrackTable.h"
+#include "TrackLink.h"
+#include "TrackLinkReactor.h"
+#include "TrackLinkFrame.h"
+#include "TrackLinkWire.h"
+#include "TrackSnapshot.h"
+#include "TuioDecoder.h"
+#include "UDPManager.h"
+
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if !UE_BUILD_SHIPPING
+
+namespace AefPharusBenchmarks
+{
+	/** Tracks replaced per frame, in percent (people leaving and entering) */
+	constexpr int32 ChurnPercent = 1;
+
+	/**
+	 * Simulated receive loop: every frame updates all tracks, a few leave (TS_OFF) and new ones appear.
+	 * The std::map variant does what TrackLinkClient used to do: find, insert, find again, erase.
+	 * @return Seconds spent
+	 */
+	double RunStdMap(int32 NumTracks, int32 NumFrames, uint64& OutChecksum)
+	{
+		std::map<unsigned int, pharus::TrackRecord> Map;
+		unsigned int NextID = 1;
+		unsigned int FirstID = 1;
+		const int32 Churn = FMath::Max(1, NumTracks * ChurnPercent / 100);
+
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			// Tracks that are still alive
+			for (unsigned int ID = FirstID; ID < NextID; ++ID)
+			{
+				auto Iter = Map.find(ID);
+				if (Iter == Map.end())
+				{
+					Map.insert(std::pair<unsigned int, pharus::TrackRecord>(ID, pharus::TrackRecord()));
+					Iter = Map.find(ID);
+				}
+				Iter->second.trackID = ID;
+				Iter->second.speed = (float)Frame;
+				OutChecksum += Iter->first;
+			}
+
+			// Oldest leave, new ones arrive
+			for (int32 i = 0; i < Churn && FirstID < NextID && (int32)Map.size() >= NumTracks; ++i)
+			{
+				Map.erase(FirstID++);
+			}
+			while ((int32)(NextID - FirstID) < NumTracks)
+			{
+				++NextID;
+			}
+		}
+		return FPlatformTime::Seconds() - Start;
+	}
+
+	/** Same workload on pharus::TrackTable (one lookup per track) */
+	double RunTrackTable(int32 NumTracks, int32 NumFrames, uint64& OutChecksum)
+	{
+		pharus::TrackTable Table;
+		unsigned int NextID = 1;
+		unsigned int FirstID = 1;
+		const int32 Churn = FMath::Max(1, NumTracks * ChurnPercent / 100);
+
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (unsigned int ID = FirstID; ID < NextID; ++ID)
+			{
+				bool bInserted = false;
+				pharus::TrackRecord& Track = Table.findOrInsert(ID, bInserted);
+				Track.speed = (float)Frame;
+				OutChecksum += Track.trackID;
+			}
+
+			for (int32 i = 0; i < Churn && FirstID < NextID && (int32)Table.size() >= NumTracks; ++i)
+			{
+				Table.erase(FirstID++);
+			}
+			while ((int32)(NextID - FirstID) < NumTracks)
+			{
+				++NextID;
+			}
+		}
+		return FPlatformTime::Seconds() - Start;
+	}
+
+	void TrackTable(const TArray<FString>& Args)
+	{
+		const int32 NumFrames = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 2000;
+		const int32 TrackCounts[] = { 50, 500, 5000 };
+
+		UE_LOG(LogAefPharus, Log, TEXT("TrackTable benchmark: %d frames, %d%% churn per frame"), NumFrames, ChurnPercent);
+
+		for (const int32 NumTracks : TrackCounts)
+		{
+			uint64 MapChecksum = 0;
+			uint64 TableChecksum = 0;
+			const double MapSeconds = RunStdMap(NumTracks, NumFrames, MapChecksum);
+			const double TableSeconds = RunTrackTable(NumTracks, NumFrames, TableChecksum);
+			const double Lookups = (double)NumTracks * NumFrames;
+
+			UE_LOG(LogAefPharus, Log, TEXT("  %5d tracks: std::map %7.1f ns/track, TrackTable %7.1f ns/track (%.1fx)%s"),
+				NumTracks,
+				MapSeconds * 1e9 / Lookups,
+				TableSeconds * 1e9 / Lookups,
+				TableSeconds > 0.0 ? MapSeconds / TableSeconds : 0.0,
+				MapChecksum == TableChecksum ? TEXT("") : TEXT(" CHECKSUM MISMATCH"));
+		}
+	}
+
+	FAutoConsoleCommand TrackTableCommand(
+		TEXT("Pharus.Benchmark.TrackTable"),
+		TEXT("Compares std::map and pharus::TrackTable on a simulated receive loop with 50, 500 and 5000 tracks. Usage: Pharus.Benchmark.TrackTable [Frames=2000]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&TrackTable));
+
+	/** Tracks per datagram sent by every simulated tracker */
+	constexpr int32 TracksPerSender = 100;
+
+	/** One TrackLink frame with NumTracks records (state TS_CONT, two echoes each) */
+	TArray<char> MakeWireFrame(unsigned int FirstID, int32 NumTracks)
+	{
+		TArray<char> Frame;
+		auto Append = [&Frame](const void* Data, int32 Size)
+		{
+			Frame.Append(static_cast<const char*>(Data), Size);
+		};
+		for (int32 i = 0; i < NumTracks; ++i)
+		{
+			const unsigned int ID = FirstID + i;
+			const int State = pharus::TS_CONT;
+			const float Fields[9] = { 1.0f, 2.0f, 1.0f, 2.0f, 1.0f, 0.0f, 0.5f, 0.3f, 0.4f };
+			const float Echo[2] = { 0.3f, 0.4f };
+			Frame.Add('T');
+			Append(&ID, 4);
+			Append(&State, 4);
+			Append(Fields, sizeof(Fields));
+			for (int32 e = 0; e < 2; ++e)
+			{
+				Frame.Add('E');
+				Append(Echo, sizeof(Echo));
+				Frame.Add('e');
+			}
+			Frame.Add('t');
+		}
+		return Frame;
+	}
+
+	/**
+	 * Loopback load: NumSenders sockets (distinct source ports, so the kernel spreads them
+	 * over the reuse-port group) send as fast as they can to a client with NumWorkers sockets.
+	 */
+	void RunReceiveWorkers(int32 NumWorkers, int32 NumSenders, double Seconds, int32 Port)
+	{
+		pharus::TrackLinkOptions Options;
+		Options.multicast = false;
+		Options.localIP = "127.0.0.1";
+		Options.port = (unsigned short)Port;
+		Options.snapshots = true;
+		Options.receiveWorkers = NumWorkers;
+		Options.receiveBufferSize = 4 * 1024 * 1024;
+		pharus::TrackLinkClient Client(Options);
+
+		// All workers bind before load starts, otherwise senders get rehashed mid-run
+		FPlatformProcess::Sleep(0.3f);
+
+		std::atomic<bool> bStop(false);
+		std::vector<std::thread> Senders;
+		for (int32 s = 0; s < NumSenders; ++s)
+		{
+			Senders.emplace_back([&bStop, s, Port]()
+			{
+				const TArray<char> Frame = MakeWireFrame((unsigned int)(s + 1) * 1000, TracksPerSender);
+				UDPManager Socket;
+				if (!Socket.Create() || !Socket.Connect("127.0.0.1", (USHORT)Port))
+				{
+					return;
+				}
+				while (!bStop.load(std::memory_order_relaxed))
+				{
+					Socket.Send(Frame.GetData(), Frame.Num());
+				}
+				Socket.Close();
+			});
+		}
+
+		// Consume like the game thread would, but as often as possible
+		const pharus::TrackLinkStatistics Before = Client.getStatistics();
+		const double Start = FPlatformTime::Seconds();
+		double MergeSeconds = 0.0;
+		int32 Merges = 0;
+		size_t MergedTracks = 0;
+		while (FPlatformTime::Seconds() - Start < Seconds)
+		{
+			const double MergeStart = FPlatformTime::Seconds();
+			const pharus::TrackSnapshot* Snapshot = Client.acquireSnapshot();
+			MergeSeconds += FPlatformTime::Seconds() - MergeStart;
+			++Merges;
+			MergedTracks = FMath::Max(MergedTracks, Snapshot ? Snapshot->tracks.size() : 0);
+			FPlatformProcess::Sleep(0.001f);
+		}
+		const double Elapsed = FPlatformTime::Seconds() - Start;
+		const pharus::TrackLinkStatistics After = Client.getStatistics();
+
+		bStop = true;
+		for (std::thread& Sender : Senders)
+		{
+			Sender.join();
+		}
+
+		const double Frames = (double)(After.frames - Before.frames);
+		const double Received = (double)(After.recvDatagrams - Before.recvDatagrams);
+		const double Dropped = (double)(After.kernelDrops - Before.kernelDrops);
+		UE_LOG(LogAefPharus, Log, TEXT("  %2d worker(s): %9.0f frames/s, %11.0f tracks/s, %5.1f%% dropped by kernel, merge %6.1f us, %d tracks merged"),
+			NumWorkers,
+			Frames / Elapsed,
+			(double)(After.tracks - Before.tracks) / Elapsed,
+			Received + Dropped > 0.0 ? 100.0 * Dropped / (Received + Dropped) : 0.0,
+			Merges > 0 ? MergeSeconds * 1e6 / Merges : 0.0,
+			(int32)MergedTracks);
+	}
+
+	void ReceiveWorkers(const TArray<FString>& Args)
+	{
+		const int32 MaxWorkers = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 16) : 4;
+		const double Seconds = Args.Num() > 1 ? FMath::Max(0.5, FCString::Atod(*Args[1])) : 2.0;
+		const int32 Port = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 45990;
+		// Same load for every run; more senders than workers so each socket gets a share
+		const int32 NumSenders = MaxWorkers * 4;
+
+		UE_LOG(LogAefPharus, Log, TEXT("ReceiveWorkers benchmark: %d senders x %d tracks per datagram on 127.0.0.1:%d, %.1f s per run, %d CPU cores"),
+			NumSenders, TracksPerSender, Port, Seconds, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+
+		for (int32 NumWorkers = 1; ; NumWorkers *= 2)
+		{
+			NumWorkers = FMath::Min(NumWorkers, MaxWorkers);
+			RunReceiveWorkers(NumWorkers, NumSenders, Seconds, Port);
+			if (NumWorkers == MaxWorkers)
+			{
+				break;
+			}
+		}
+	}
+
+	FAutoConsoleCommand ReceiveWorkersCommand(
+		TEXT("Pharus.Benchmark.ReceiveWorkers"),
+		TEXT("Measures receive throughput with 1 to MaxWorkers reuse-port sockets under loopback load (senders share the CPU with the workers). Usage: Pharus.Benchmark.ReceiveWorkers [MaxWorkers=4] [Seconds=2] [Port=45990]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&ReceiveWorkers));
+
+	/**
+	 * Creates and destroys a client Cycles times. Startup lasts until the first frame arrives
+	 * (a sender keeps offering one every 0.5 ms), teardown is the destructor.
+	 */
+	void RunRestart(const TCHAR* Label, const pharus::TrackLinkOptions& Options, int32 Cycles)
+	{
+		UDPManager Sender;
+		if (!Sender.Create() || !Sender.Connect("127.0.0.1", Options.port))
+		{
+			UE_LOG(LogAefPharus, Error, TEXT("  %s: unable to create the sender socket"), Label);
+			return;
+		}
+		const TArray<char> Frame = MakeWireFrame(1, 1);
+
+		double StartupSum = 0.0, StartupMax = 0.0;
+		double TeardownSum = 0.0, TeardownMax = 0.0;
+		int32 Failed = 0;
+		for (int32 Cycle = 0; Cycle < Cycles; ++Cycle)
+		{
+			double Start = FPlatformTime::Seconds();
+			std::unique_ptr<pharus::TrackLinkClient> Client = std::make_unique<pharus::TrackLinkClient>(Options);
+			while (Client->getStatistics().frames == 0 && FPlatformTime::Seconds() - Start < 2.0)
+			{
+				Sender.Send(Frame.GetData(), Frame.Num());
+				FPlatformProcess::Sleep(0.0005f);
+			}
+			const double Startup = FPlatformTime::Seconds() - Start;
+			Failed += Client->getStatistics().frames == 0 ? 1 : 0;
+
+			Start = FPlatformTime::Seconds();
+			Client.reset();
+			const double Teardown = FPlatformTime::Seconds() - Start;
+
+			StartupSum += Startup;
+			StartupMax = FMath::Max(StartupMax, Startup);
+			TeardownSum += Teardown;
+			TeardownMax = FMath::Max(TeardownMax, Teardown);
+		}
+		Sender.Close();
+
+		UE_LOG(LogAefPharus, Log, TEXT("  %-16s startup %7.2f ms (max %7.2f), teardown %7.2f ms (max %7.2f)%s"),
+			Label,
+			StartupSum * 1e3 / Cycles, StartupMax * 1e3,
+			TeardownSum * 1e3 / Cycles, TeardownMax * 1e3,
+			Failed > 0 ? *FString::Printf(TEXT(", %d cycle(s) received nothing"), Failed) : TEXT(""));
+	}
+
+	void Restart(const TArray<FString>& Args)
+	{
+		const int32 Cycles = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 1000) : 20;
+		const int32 Port = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 45990;
+
+		UE_LOG(LogAefPharus, Log, TEXT("Restart benchmark: %d cycles on 127.0.0.1:%d"), Cycles, Port);
+
+		pharus::TrackLinkOptions Options;
+		Options.multicast = false;
+		Options.localIP = "127.0.0.1";
+		Options.port = (unsigned short)Port;
+		RunRestart(TEXT("dedicated thread"), Options, Cycles);
+
+		pharus::TrackLinkReactor Reactor(1);
+		Options.reactor = &Reactor;
+		RunRestart(TEXT("shared reactor"), Options, Cycles);
+
+		Options.reactor = nullptr;
+		Options.busyPoll = true;
+		RunRestart(TEXT("busy-poll"), Options, Cycles);
+	}
+
+	FAutoConsoleCommand RestartCommand(
+		TEXT("Pharus.Benchmark.Restart"),
+		TEXT("Measures how long a TrackLinkClient takes from construction to its first frame and to shut down, with a dedicated thread, the shared reactor and busy-poll. Usage: Pharus.Benchmark.Restart [Cycles=20] [Port=45990]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Restart));
+
+	/** FNV-1a over the bytes of every parsed frame; equal digests mean identical frames in identical order */
+	struct FFrameDigest : public pharus::ITrackFrameReceiver
+	{
+		uint64 Digest = 14695981039346656037ull;
+		int64 Frames = 0;
+
+		virtual void onTrackFrame(const pharus::TrackFrameView& Frame) override
+		{
+			const uint8* Bytes = reinterpret_cast<const uint8*>(Frame.bytes());
+			for (int32 i = 0; i < Frame.byteSize(); ++i)
+			{
+				Digest = (Digest ^ Bytes[i]) * 1099511628211ull;
+			}
+			++Frames;
+		}
+	};
+
+	/**
+	 * Replays a capture Runs times through the full receive path (reassembly, parser, track
+	 * table, snapshots) and checks that every run produced the same frames.
+	 */
+	void Replay(const TArray<FString>& Args)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogAefPharus, Warning, TEXT("Usage: Pharus.Benchmark.Replay <File> [Runs=3] [Speed=0]"));
+			return;
+		}
+		const FString Path = FPaths::ConvertRelativePathToFull(UAefPharusInstance::GetCaptureDirectory(), Args[0]);
+		const int32 Runs = Args.Num() > 1 ? FMath::Clamp(FCString::Atoi(*Args[1]), 1, 100) : 3;
+		const double Speed = Args.Num() > 2 ? FMath::Max(0.0, FCString::Atod(*Args[2])) : 0.0;
+
+		UE_LOG(LogAefPharus, Log, TEXT("Replay benchmark: %s, %d run(s) at %s"),
+			*Path, Runs, Speed > 0.0 ? *FString::Printf(TEXT("%.2gx speed"), Speed) : TEXT("full speed"));
+
+		const FTCHARToUTF8 PathUtf8(*Path);
+		pharus::TrackLinkOptions Options;
+		Options.replayFile = PathUtf8.Get();
+		Options.replaySpeed = Speed;
+		Options.snapshots = true;
+
+		uint64 FirstDigest = 0;
+		bool bDeterministic = true;
+		for (int32 Run = 0; Run < Runs; ++Run)
+		{
+			FFrameDigest Digest;
+			const double Start = FPlatformTime::Seconds();
+			try
+			{
+				pharus::TrackLinkClient Client(Options);
+				Client.registerFrameReceiver(&Digest);
+				while (!Client.getStatistics().replayFinished)
+				{
+					// consume like the game thread would
+					Client.acquireSnapshot();
+					FPlatformProcess::Sleep(0.0005f);
+				}
+				const double Elapsed = FPlatformTime::Seconds() - Start;
+				const pharus::TrackLinkStatistics Stats = Client.getStatistics();
+				Client.unregisterFrameReceiver(&Digest);
+
+				UE_LOG(LogAefPharus, Log, TEXT("  run %d: %llu datagrams, %lld frames, %llu tracks in %.3f s (%.0f frames/s), %llu malformed, digest %016llx"),
+					Run + 1, Stats.recvDatagrams, Digest.Frames, Stats.tracks, Elapsed,
+					Elapsed > 0.0 ? Digest.Frames / Elapsed : 0.0, Stats.malformedFrames, Digest.Digest);
+			}
+			catch (const std::exception& e)
+			{
+				UE_LOG(LogAefPharus, Error, TEXT("  %hs"), e.what());
+				return;
+			}
+
+			if (Run == 0)
+			{
+				FirstDigest = Digest.Digest;
+			}
+			bDeterministic = bDeterministic && Digest.Digest == FirstDigest;
+		}
+
+		UE_LOG(LogAefPharus, Log, TEXT("  frames identical in every run: %s"), bDeterministic ? TEXT("yes") : TEXT("NO"));
+	}
+
+	FAutoConsoleCommand ReplayCommand(
+		TEXT("Pharus.Benchmark.Replay"),
+		TEXT("Replays a traffic capture (CaptureTraffic) through the receive path and checks that every run parses the same frames. Relative paths start in Saved/Pharus/Captures. Usage: Pharus.Benchmark.Replay <File> [Runs=3] [Speed=0 (as fast as possible)]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Replay));
+
+	/** Tracking area the TUIO payload is scaled to, in meters */
+	const pharus::PharusVector2f ParserArea = { 15.0f, 8.3f };
+
+	/** Position of a synthetic track in a frame, relative to the area */
+	pharus::PharusVector2f ParserPosition(int32 Track, int32 Frame)
+	{
+		return { FMath::Frac(Track * 0.618034f + Frame * 0.001f), FMath::Frac(Track * 0.414214f + Frame * 0.0007f) };
+	}
+
+	/** One TrackLink frame with NumTracks moving tracks, no echoes */
+	void BuildTrackLinkFrame(int32 NumTracks, int32 Frame, std::vector<char>& Out)
+	{
+		namespace wire = pharus::wire;
+		Out.assign((size_t)NumTracks * wire::TRACK_MIN_SIZE, 0);
+		char* P = Out.data();
+		for (int32 i = 0; i < NumTracks; ++i)
+		{
+			const pharus::PharusVector2f Rel = ParserPosition(i, Frame);
+			*P = 'T';
+			char* Fields = P + 1;
+			wire::write<uint32>(Fields + wire::OFS_ID, (uint32)i + 1);
+			wire::write<int32>(Fields + wire::OFS_STATE, Frame == 0 ? pharus::TS_NEW : pharus::TS_CONT);
+			wire::write<float>(Fields + wire::OFS_CURRENT_POS, Rel.x * ParserArea.x);
+			wire::write<float>(Fields + wire::OFS_CURRENT_POS + 4, Rel.y * ParserArea.y);
+			wire::write<float>(Fields + wire::OFS_EXPECT_POS, Rel.x * ParserArea.x);
+			wire::write<float>(Fields + wire::OFS_EXPECT_POS + 4, Rel.y * ParserArea.y);
+			wire::write<float>(Fields + wire::OFS_ORIENTATION, 1.0f);
+			wire::write<float>(Fields + wire::OFS_ORIENTATION + 4, 0.0f);
+			wire::write<float>(Fields + wire::OFS_SPEED, 0.5f);
+			wire::write<float>(Fields + wire::OFS_REL_POS, Rel.x);
+			wire::write<float>(Fields + wire::OFS_REL_POS + 4, Rel.y);
+			P[wire::TRACK_MIN_SIZE - 1] = 't';
+			P += wire::TRACK_MIN_SIZE;
+		}
+	}
+
+	/** The same frame as a TUIO 1.1 bundle: /tuio/2Dcur alive, one set per track, fseq last */
+	void BuildTuioBundle(int32 NumTracks, int32 Frame, std::vector<char>& Out)
+	{
+		// 2Dcur set: 56 bytes with its size prefix; alive: 4 per session
+		Out.resize(256 + (size_t)NumTracks * 64);
+		pharus::OscPacketWriter Writer(Out.data(), (int)Out.size());
+		Writer.beginBundle();
+
+		// "alive" followed by one session ID per track
+		TArray<ANSICHAR> AliveTags;
+		AliveTags.Init('i', NumTracks + 2);
+		AliveTags[0] = 's';
+		AliveTags.Last() = '\0';
+		Writer.beginMessage("/tuio/2Dcur", AliveTags.GetData());
+		Writer.addString("alive");
+		for (int32 i = 0; i < NumTracks; ++i)
+		{
+			Writer.addInt(i + 1);
+		}
+		Writer.endMessage();
+
+		for (int32 i = 0; i < NumTracks; ++i)
+		{
+			const pharus::PharusVector2f Rel = ParserPosition(i, Frame);
+			Writer.beginMessage("/tuio/2Dcur", "sifffff");
+			Writer.addString("set");
+			Writer.addInt(i + 1);
+			Writer.addFloat(Rel.x);
+			Writer.addFloat(Rel.y);
+			Writer.addFloat(0.5f / ParserArea.x);
+			Writer.addFloat(0.0f);
+			Writer.addFloat(0.0f);
+			Writer.endMessage();
+		}
+
+		Writer.beginMessage("/tuio/2Dcur", "si");
+		Writer.addString("fseq");
+		Writer.addInt(Frame + 1);
+		Writer.endMessage();
+		Writer.endBundle();
+		check(!Writer.overflow());
+		Out.resize(Writer.size());
+	}
+
+	/** Applies a decoded record the way TrackLinkClient does: one lookup, then copy */
+	void ApplyParsedTrack(pharus::TrackTable& Table, const pharus::TrackRecord& Record, uint64& OutChecksum)
+	{
+		bool bInserted = false;
+		pharus::TrackRecord& Track = Table.findOrInsert(Record.trackID, bInserted);
+		Track = Record;
+		OutChecksum += Record.trackID;
+	}
+
+	/** Decodes the frame NumFrames times; every pass is a fresh frame to the parser (the bytes just repeat) */
+	double RunTrackLinkParser(const std::vector<char>& Frame, int32 NumFrames, uint64& OutChecksum)
+	{
+		pharus::TrackTable Table;
+		pharus::TrackRecord Decoded;
+		const double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumFrames; ++i)
+		{
+			for (const pharus::TrackView& View : pharus::TrackFrameView(Frame.data(), (int)Frame.size()))
+			{
+				Decoded.trackID = View.trackID();
+				Decoded.state = View.state();
+				Decoded.currentPos = View.currentPos();
+				Decoded.expectPos = View.expectPos();
+				Decoded.orientation = View.orientation();
+				Decoded.speed = View.speed();
+				Decoded.relPos = View.relPos();
+				ApplyParsedTrack(Table, Decoded, OutChecksum);
+			}
+		}
+		return FPlatformTime::Seconds() - Start;
+	}
+
+	/** OSC walk and TUIO session state for the same frames; the fseq is advanced in place each pass */
+	double RunTuioParser(std::vector<char>& Bundle, int32 NumFrames, uint64& OutChecksum, uint64& OutMalformed)
+	{
+		pharus::TrackTable Table;
+		pharus::TuioDecoder Decoder(ParserArea);
+		// fseq is the last argument of the bundle
+		char* FrameSequence = Bundle.data() + Bundle.size() - 4;
+		const double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumFrames; ++i)
+		{
+			pharus::osc::writeUInt32(FrameSequence, (uint32)i + 1);
+			Decoder.beginPacket();
+			const pharus::OscPacketView::Error Error = pharus::OscPacketView(Bundle.data(), (int)Bundle.size()).forEachMessage(
+				[&](const pharus::OscMessageView& Message)
+				{
+					const pharus::TuioDecoder::Result Result = Decoder.add(Message);
+					if (Result == pharus::TuioDecoder::FRAME)
+					{
+						for (const pharus::TrackRecord& Record : Decoder.frame())
+						{
+							ApplyParsedTrack(Table, Record, OutChecksum);
+						}
+					}
+					else if (Result == pharus::TuioDecoder::MALFORMED)
+					{
+						++OutMalformed;
+					}
+				});
+			if (Error != pharus::OscPacketView::OK)
+			{
+				++OutMalformed;
+			}
+		}
+		return FPlatformTime::Seconds() - Start;
+	}
+
+	/**
+	 * Decode cost of the two input protocols for the same tracks: TrackLink frames against
+	 * TUIO 1.1 bundles (OSC parsing plus session state), both ending in a TrackTable.
+	 * Measures the parsers in memory; sockets are the same for both and left out.
+	 */
+	void Parsers(const TArray<FString>& Args)
+	{
+		const int32 NumFrames = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 2000;
+		const int32 TrackCounts[] = { 50, 500, 5000 };
+
+		UE_LOG(LogAefPharus, Log, TEXT("Parser benchmark: %d frames, TrackLink against TUIO /tuio/2Dcur"), NumFrames);
+
+		std::vector<char> TrackLinkFrame;
+		std::vector<char> TuioBundle;
+		for (const int32 NumTracks : TrackCounts)
+		{
+			BuildTrackLinkFrame(NumTracks, 1, TrackLinkFrame);
+			BuildTuioBundle(NumTracks, 1, TuioBundle);
+
+			uint64 TrackLinkChecksum = 0;
+			uint64 TuioChecksum = 0;
+			uint64 Malformed = 0;
+			const double TrackLinkSeconds = RunTrackLinkParser(TrackLinkFrame, NumFrames, TrackLinkChecksum);
+			const double TuioSeconds = RunTuioParser(TuioBundle, NumFrames, TuioChecksum, Malformed);
+			const double Tracks = (double)NumTracks * NumFrames;
+			auto MegabytesPerSecond = [NumFrames](const std::vector<char>& Bytes, double Seconds)
+			{
+				return Seconds > 0.0 ? (double)Bytes.size() * NumFrames / Seconds / (1024.0 * 1024.0) : 0.0;
+			};
+
+			UE_LOG(LogAefPharus, Log, TEXT("  %5d tracks: TrackLink %6.1f ns/track (%5d B, %6.0f MB/s), TUIO %6.1f ns/track (%6d B, %6.0f MB/s), TUIO/TrackLink %.2fx%s%s"),
+				NumTracks,
+				TrackLinkSeconds * 1e9 / Tracks, (int32)TrackLinkFrame.size(), MegabytesPerSecond(TrackLinkFrame, TrackLinkSeconds),
+				TuioSeconds * 1e9 / Tracks, (int32)TuioBundle.size(), MegabytesPerSecond(TuioBundle, TuioSeconds),
+				TrackLinkSeconds > 0.0 ? TuioSeconds / TrackLinkSeconds : 0.0,
+				TrackLinkChecksum == TuioChecksum ? TEXT("") : TEXT(" CHECKSUM MISMATCH"),
+				Malformed == 0 ? TEXT("") : TEXT(" MALFORMED"));
+		}
+	}
+
+	FAutoConsoleCommand ParsersCommand(
+		TEXT("Pharus.Benchmark.Parsers"),
+		TEXT("Compares the TrackLink parser with the TUIO decoder (OSC bundles with alive, set and fseq) on the same tracks with 50, 500 and 5000 tracks, in memory. Usage: Pharus.Benchmark.Parsers [Frames=2000]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Parsers));
+
+	/** Per-track chain against its compiled replacement, see CompareMapping() */
+	struct FMappingComparison
+	{
+		double PerTrackNs = 0.0;
+		double CompiledNs = 0.0;
+
+		/** Largest difference between both results over all tracks, see MappingDeviation() */
+		double MaxDeviation = 0.0;
+
+		double PerTrackChecksum = 0.0;
+		double CompiledChecksum = 0.0;
+	};
+
+	/** Distance in cm between two mapped positions */
+	double MappingDeviation(const FVector& Expected, const FVector& Actual)
+	{
+		return FVector::Dist(Expected, Actual);
+	}
+
+	/** 1 if two region lookups disagree */
+	double MappingDeviation(int32 Expected, int32 Actual)
+	{
+		return Expected == Actual ? 0.0 : 1.0;
+	}
+
+	double MappingChecksum(const FVector& Result)
+	{
+		return Result.X + Result.Y + Result.Z;
+	}
+
+	double MappingChecksum(int32 Result)
+	{
+		return Result;
+	}
+
+	/**
+	 * Times PerTrack(i) and Compiled(i) for every track i, NumIterations times each, then compares
+	 * both once per track. Both return the same type (FVector or int32).
+	 */
+	template <typename PerTrackFuncType, typename CompiledFuncType>
+	FMappingComparison CompareMapping(int32 NumTracks, int32 NumIterations, PerTrackFuncType&& PerTrack, CompiledFuncType&& Compiled)
+	{
+		FMappingComparison Result;
+		const double Mapped = (double)NumTracks * NumIterations;
+
+		double Start = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			for (int32 i = 0; i < NumTracks; ++i)
+			{
+				Result.PerTrackChecksum += MappingChecksum(PerTrack(i));
+			}
+		}
+		Result.PerTrackNs = (FPlatformTime::Seconds() - Start) * 1e9 / Mapped;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			for (int32 i = 0; i < NumTracks; ++i)
+			{
+				Result.CompiledChecksum += MappingChecksum(Compiled(i));
+			}
+		}
+		Result.CompiledNs = (FPlatformTime::Seconds() - Start) * 1e9 / Mapped;
+
+		for (int32 i = 0; i < NumTracks; ++i)
+		{
+			Result.MaxDeviation = FMath::Max(Result.MaxDeviation, MappingDeviation(PerTrack(i), Compiled(i)));
+		}
+		return Result;
+	}
+
+	/** One line per comparison; Unit follows the deviation, Extra is appended (further timings of the same case) */
+	void LogMappingComparison(const TCHAR* Name, const FMappingComparison& Result, const TCHAR* Unit, const FString& Extra = FString())
+	{
+		UE_LOG(LogAefPharus, Log, TEXT("  %-10s: per track %6.2f ns/track, compiled %6.2f ns/track (%.1fx), max deviation %.4f%s (checksum %.0f / %.0f)%s"),
+			Name,
+			Result.PerTrackNs,
+			Result.CompiledNs,
+			Result.CompiledNs > 0.0 ? Result.PerTrackNs / Result.CompiledNs : 0.0,
+			Result.MaxDeviation,
+			Unit,
+			Result.PerTrackChecksum,
+			Result.CompiledChecksum,
+			*Extra);
+	}
+
+	/**
+	 * Per-track floor mapping against the compiled affine (FAefPharusFloorTransform) on the same
+	 * positions, for normalized and absolute input.
+	 */
+	void FloorMapping(const TArray<FString>& Args)
+	{
+		const int32 NumIterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 200;
+		constexpr int32 NumTracks = 5000;
+
+		const FVector RootOrigin(250.0f, -120.0f, 35.0f);
+		const FRotator RootRotation(5.0f, 30.0f, 0.0f);
+
+		FAefPharusInstanceConfig Normalized;
+		Normalized.SimpleScale = FVector2D(1000.0f, 1500.0f);
+		Normalized.FloorZ = 10.0f;
+		Normalized.FloorRotation = 90.0f;
+		Normalized.bInvertY = true;
+		Normalized.bUseNormalizedCoordinates = true;
+
+		FAefPharusInstanceConfig Absolute = Normalized;
+		Absolute.TrackingSurfaceDimensions = FVector2D(10.0f, 15.0f);
+		Absolute.bUseNormalizedCoordinates = false;
+
+		UE_LOG(LogAefPharus, Log, TEXT("Floor mapping benchmark: %d tracks x %d iterations"), NumTracks, NumIterations);
+
+		const struct { const TCHAR* Name; const FAefPharusInstanceConfig* Config; FVector2D Range; } Cases[] =
+		{
+			{ TEXT("normalized"), &Normalized, FVector2D(1.0f, 1.0f) },
+			{ TEXT("absolute"), &Absolute, Absolute.TrackingSurfaceDimensions },
+		};
+
+		FRandomStream Random(1234);
+		TArray<FVector2D> Positions;
+		Positions.SetNumUninitialized(NumTracks);
+		for (const auto& Case : Cases)
+		{
+			for (FVector2D& Position : Positions)
+			{
+				Position = FVector2D(Random.FRand() * Case.Range.X, Random.FRand() * Case.Range.Y);
+			}
+
+			const FAefPharusFloorTransform Transform = FAefPharusFloorTransform::Compile(*Case.Config, RootOrigin, RootRotation);
+			LogMappingComparison(Case.Name, CompareMapping(NumTracks, NumIterations,
+				[&](int32 i) { return AefPharusMappingReference::MapFloorPerTrack(*Case.Config, Positions[i], RootOrigin, RootRotation); },
+				[&](int32 i) { return Transform.ToWorld.TransformPosition(Positions[i]); }), TEXT(" cm"));
+		}
+	}
+
+	FAutoConsoleCommand FloorMappingCommand(
+		TEXT("Pharus.Benchmark.FloorMapping"),
+		TEXT("Compares the per-track Simple (floor) mapping chain with the compiled affine transform on 5000 positions, normalized and absolute input. Usage: Pharus.Benchmark.FloorMapping [Iterations=200]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&FloorMapping));
+
+	/**
+	 * Per-track wall region mapping against the compiled region transforms (FAefPharusWallTransform)
+	 * on four walls side by side on the tracking surface. The region lookup is the same for both.
+	 */
+	void WallMapping(const TArray<FString>& Args)
+	{
+		const int32 NumIterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 200;
+		constexpr int32 NumTracks = 5000;
+		constexpr int32 NumWalls = 4;
+		constexpr float GlobalWallRotation = 0.0f;
+
+		const FVector RootOrigin(250.0f, -120.0f, 35.0f);
+		const FRotator RootRotation(0.0f, 30.0f, 0.0f);
+
+		// Back, Right, Front, Left along X, 15 m x 10 m room, 4 m high
+		FAefPharusWallRegion Regions[NumWalls];
+		const float Yaws[NumWalls] = { 0.0f, 90.0f, 180.0f, 270.0f };
+		const FVector Corners[NumWalls] = { FVector(0, 0, 0), FVector(1500, 0, 0), FVector(1500, 1000, 0), FVector(0, 1000, 0) };
+		for (int32 i = 0; i < NumWalls; ++i)
+		{
+			Regions[i].TrackingBounds = FBox2D(FVector2D(i / (float)NumWalls, 0.0f), FVector2D((i + 1) / (float)NumWalls, 1.0f));
+			Regions[i].WorldPosition = Corners[i];
+			Regions[i].WorldRotation = FRotator(0.0f, Yaws[i], 0.0f);
+			Regions[i].Scale = FVector2D(i % 2 == 0 ? 1500.0f : 1000.0f, 400.0f);
+			Regions[i].bInvertY = true;
+			Regions[i].Rotation2D = 0.0f;
+		}
+
+		FAefPharusWallTransform Compiled[NumWalls];
+		for (int32 i = 0; i < NumWalls; ++i)
+		{
+			Compiled[i] = FAefPharusWallTransform::Compile(Regions[i], GlobalWallRotation, RootOrigin, RootRotation);
+		}
+
+		FRandomStream Random(1234);
+		TArray<FVector2D> Positions;
+		TArray<int32> RegionIndices;
+		Positions.SetNumUninitialized(NumTracks);
+		RegionIndices.SetNumUninitialized(NumTracks);
+		for (int32 i = 0; i < NumTracks; ++i)
+		{
+			Positions[i] = FVector2D(Random.FRand(), Random.FRand());
+			RegionIndices[i] = FMath::Min(NumWalls - 1, (int32)(Positions[i].X * NumWalls));
+		}
+
+		UE_LOG(LogAefPharus, Log, TEXT("Wall mapping benchmark: %d tracks x %d iterations, %d walls"), NumTracks, NumIterations, NumWalls);
+
+		LogMappingComparison(TEXT("walls"), CompareMapping(NumTracks, NumIterations,
+			[&](int32 i) { return AefPharusMappingReference::MapWallPerTrack(Regions[RegionIndices[i]], Positions[i], RootOrigin, RootRotation, GlobalWallRotation); },
+			[&](int32 i) { return Compiled[RegionIndices[i]].ToWorld.TransformPosition(Positions[i]); }), TEXT(" cm"));
+	}
+
+	FAutoConsoleCommand WallMappingCommand(
+		TEXT("Pharus.Benchmark.WallMapping"),
+		TEXT("Compares the per-track Regions (wall) mapping chain with the compiled region transforms on 5000 positions over four walls. Usage: Pharus.Benchmark.WallMapping [Iterations=200]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&WallMapping));
+
+	/**
+	 * Region lookup per track against the compiled lookup (single and batch) on four walls side
+	 * by side with overlapping corners, plus positions outside every region. The deviation is 1
+	 * if any lookup returned another region.
+	 */
+	void WallLookup(const TArray<FString>& Args)
+	{
+		const int32 NumIterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 200;
+		constexpr int32 NumTracks = 5000;
+		constexpr int32 NumWalls = 4;
+
+		// Back, Right, Front, Left along X, neighbours overlap by 0.02
+		const EAefPharusWallSide Sides[NumWalls] = { EAefPharusWallSide::Back, EAefPharusWallSide::Right, EAefPharusWallSide::Front, EAefPharusWallSide::Left };
+		TArray<FAefPharusWallRegion> Regions;
+		for (int32 i = 0; i < NumWalls; ++i)
+		{
+			FAefPharusWallRegion& Region = Regions.AddDefaulted_GetRef();
+			Region.WallSide = Sides[i];
+			Region.TrackingBounds = FBox2D(FVector2D(FMath::Max(0.0f, i * 0.25f - 0.01f), 0.0f), FVector2D(FMath::Min(1.0f, (i + 1) * 0.25f + 0.01f), 1.0f));
+		}
+		const FAefPharusWallRegionLookup Lookup = FAefPharusWallRegionLookup::Compile(Regions);
+
+		FRandomStream Random(1234);
+		TArray<FVector2D> Positions;
+		Positions.SetNumUninitialized(NumTracks);
+		for (FVector2D& Position : Positions)
+		{
+			// 10% outside the tracking surface
+			Position = FVector2D(Random.FRandRange(-0.05f, 1.05f), Random.FRandRange(-0.05f, 1.05f));
+		}
+
+		UE_LOG(LogAefPharus, Log, TEXT("Wall region lookup benchmark: %d tracks x %d iterations, %d regions"), NumTracks, NumIterations, Regions.Num());
+
+		const FMappingComparison Comparison = CompareMapping(NumTracks, NumIterations,
+			[&](int32 i) { return AefPharusMappingReference::FindWallRegionPerTrack(Regions, Positions[i]); },
+			[&](int32 i) { return Lookup.Find(Positions[i]); });
+
+		// Batch on top: one call per frame instead of one per track
+		TArray<int32> RegionIndices;
+		RegionIndices.SetNumUninitialized(NumTracks);
+		double BatchChecksum = 0.0;
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			Lookup.FindBatch(Positions, RegionIndices);
+			for (const int32 RegionIndex : RegionIndices)
+			{
+				BatchChecksum += RegionIndex;
+			}
+		}
+		const double BatchNs = (FPlatformTime::Seconds() - Start) * 1e9 / ((double)NumTracks * NumIterations);
+
+		LogMappingComparison(TEXT("lookup"), Comparison, TEXT(""), FString::Printf(TEXT(", batch %6.2f ns/track (%.1fx)%s"),
+			BatchNs,
+			BatchNs > 0.0 ? Comparison.PerTrackNs / BatchNs : 0.0,
+			BatchChecksum == Comparison.PerTrackChecksum ? TEXT("") : TEXT(" BATCH CHECKSUM MISMATCH")));
+	}
+
+	FAutoConsoleCommand WallLookupCommand(
+		TEXT("Pharus.Benchmark.WallLookup"),
+		TEXT("Compares the per-track wall region search with the compiled region lookup (single and batch) on 5000 positions over four overlapping walls. Usage: Pharus.Benchmark.WallLookup [Iterations=200]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&WallLookup));
+}
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,85 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2025
+
+   AefPharus - Console Commands
+
+   Runtime diagnostics for the tracker instances of the current world.
+   Not compiled into shipping builds.
+
+   Commands:
+   - Pharus.Latency [InstanceName] [reset]
+  ========================================================================*/
+
+#include "AefPharus.h"
+#include "AefPharusSubsystem.h"
+#include "AefPharusInstance.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace AefPharusConsoleCommands
+{
+	/** Subsystem of the world the command was issued in, nullptr without a game instance */
+	UAefPharusSubsystem* GetSubsystem(UWorld* World)
+	{
+		UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		return GameInstance ? GameInstance->GetSubsystem<UAefPharusSubsystem>() : nullptr;
+	}
+
+	void Latency(const TArray<FString>& Args, UWorld* World)
+	{
+		UAefPharusSubsystem* Subsystem = GetSubsystem(World);
+		if (!Subsystem)
+		{
+			UE_LOG(LogAefPharus, Warning, TEXT("Pharus.Latency: No AefPharus subsystem in this world"));
+			return;
+		}
+
+		bool bReset = false;
+		FString InstanceFilter;
+		for (const FString& Arg : Args)
+		{
+			if (Arg.Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+			{
+				bReset = true;
+			}
+			else
+			{
+				InstanceFilter = Arg;
+			}
+		}
+
+		for (const FName& InstanceName : Subsystem->GetAllInstanceNames())
+		{
+			if (!InstanceFilter.IsEmpty() && !InstanceName.ToString().Equals(InstanceFilter, ESearchCase::IgnoreCase))
+			{
+				continue;
+			}
+
+			UAefPharusInstance* Instance = Subsystem->GetTrackerInstance(InstanceName);
+			if (!Instance)
+			{
+				continue;
+			}
+
+			const FAefPharusLatencyStats Stats = Instance->GetLatencyStats();
+			UE_LOG(LogAefPharus, Log, TEXT("Pharus.Latency [%s]: %d samples, p50 %.2f ms, p95 %.2f ms, p99 %.2f ms, max %.2f ms (%s timestamps)"),
+				*InstanceName.ToString(), Stats.SampleCount, Stats.P50Ms, Stats.P95Ms, Stats.P99Ms, Stats.MaxMs,
+				Stats.bKernelTimestamps ? TEXT("kernel") : TEXT("user space"));
+
+			if (bReset)
+			{
+				Instance->ResetLatencyStats();
+			}
+		}
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs LatencyCommand(
+		TEXT("Pharus.Latency"),
+		TEXT("Logs UDP arrival to actor update latency percentiles per tracker instance. Usage: Pharus.Latency [InstanceName] [reset]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&Latency));
+}
+
+#endif // !UE_BUILD_SHIPPING
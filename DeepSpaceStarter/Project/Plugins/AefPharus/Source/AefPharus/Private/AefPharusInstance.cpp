@@ -17,6 +17,8 @@
 #include "EngineUtils.h"  // For TActorIterator (used in FindExistingActorByName)
 #include "GameFramework/Actor.h"
 #include "Containers/Ticker.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
 
 // nDisplay support (optional - only if DisplayCluster module is available)
 #if WITH_EDITOR || UE_BUILD_SHIPPING || UE_BUILD_DEVELOPMENT
@@ -70,69 +72,50 @@ bool UAefPharusInstance::Initialize(const FAefPharusInstanceConfig& InConfig, UW
 	SpawnClass = InSpawnClass;
 	WorldContext = InWorld;
 
-	// Create TrackLinkClient
-	try
+	// Root origin comes from the subsystem's per-frame snapshot, never from the actor directly
+	if (UAefPharusSubsystem* Subsystem = Cast<UAefPharusSubsystem>(GetOuter()))
 	{
-		// Prepare BindNIC string for TrackLinkClient
-		// IMPORTANT: TrackLinkClient stores a pointer to this string, so we must keep it alive
-		const char* BindNICPtr = nullptr;
-
-		FString TrimmedBindNIC = Config.BindNIC.TrimStartAndEnd();
-		if (!TrimmedBindNIC.IsEmpty())
-		{
-			// Use specific network interface
-			// Convert FString to ANSI and store in persistent TArray
-			// +1 for null terminator
-			BindNICStorage.SetNumUninitialized(TrimmedBindNIC.Len() + 1);
-			FCStringAnsi::Strncpy(BindNICStorage.GetData(), TCHAR_TO_ANSI(*TrimmedBindNIC), BindNICStorage.Num());
-			BindNICPtr = BindNICStorage.GetData();
-		}
-		else
-		{
-			// Use INADDR_ANY (bind to all interfaces)
-			// IMPORTANT: Must use "0.0.0.0" string, NOT nullptr (inet_addr cannot handle nullptr!)
-			BindNICStorage.SetNumUninitialized(8);  // "0.0.0.0" + null terminator
-			FCStringAnsi::Strncpy(BindNICStorage.GetData(), "0.0.0.0", BindNICStorage.Num());
-			BindNICPtr = BindNICStorage.GetData();
-		}
+		RootTransformSource = &Subsystem->GetPublishedRootTransform();
+	}
+	else
+	{
+		UE_LOG(LogAefPharus, Warning, TEXT("[%s] No owning subsystem found - using zero root origin"), *Config.InstanceName.ToString());
+	}
 
-		// Prepare MulticastGroup string for TrackLinkClient
-		// IMPORTANT: TrackLinkClient stores a pointer to this string, so we must keep it alive
-		const char* MulticastGroupPtr = nullptr;
+	// Compiled mapping for the mapping stage (recompiled when Config or the root origin changes)
+	RefreshTransforms(true);
 
-		FString TrimmedMulticastGroup = Config.MulticastGroup.TrimStartAndEnd();
-		if (!TrimmedMulticastGroup.IsEmpty())
-		{
-			// Convert FString to ANSI and store in persistent TArray
-			MulticastGroupStorage.SetNumUninitialized(TrimmedMulticastGroup.Len() + 1);
-			FCStringAnsi::Strncpy(MulticastGroupStorage.GetData(), TCHAR_TO_ANSI(*TrimmedMulticastGroup), MulticastGroupStorage.Num());
-			MulticastGroupPtr = MulticastGroupStorage.GetData();
-		}
-		else
-		{
-			// Use default multicast group
-			const char* DefaultMulticast = "239.1.1.1";
-			MulticastGroupStorage.SetNumUninitialized(FCStringAnsi::Strlen(DefaultMulticast) + 1);
-			FCStringAnsi::Strncpy(MulticastGroupStorage.GetData(), DefaultMulticast, MulticastGroupStorage.Num());
-			MulticastGroupPtr = MulticastGroupStorage.GetData();
-		}
+	// Event queue must exist before the client starts receiving (callback mode only)
+	TrackEventQueueCapacity = FMath::Clamp(Config.TrackEventQueueSize, 64, 65536);
+	if (!Config.bUseFrameSnapshots)
+	{
+		TrackEventQueue = MakeUnique<TCircularQueue<FAefPharusTrackEvent>>(TrackEventQueueCapacity + 1);
+	}
+	SnapshotDiff.reset();
+	TrackEventOverflows = 0;
+	TrackEventHighWater = 0;
+	LastReportedOverflows = 0;
+	LastReportedKernelDrops = 0;
+	ResetLatencyStats();
+	NetworkStats = FAefPharusNetworkStats();
+	LastNetworkCounters = pharus::TrackLinkStatistics();
+	LastNetworkSampleTime = FPlatformTime::Seconds();
 
-		TrackLinkClient = MakeUnique<pharus::TrackLinkClient>(
-			Config.bIsMulticast,
-			BindNICPtr,
-			Config.UDPPort,
-			MulticastGroupPtr
-		);
+	// Create TrackLinkClient
+	try
+	{
+		TrackLinkClient = CreateTrackLinkClient(Config, BindNICStorage, MulticastGroupStorage);
 	}
 	catch (const std::exception& e)
 	{
 		UE_LOG(LogAefPharus, Error, TEXT("Failed to create TrackLinkClient for instance '%s': %hs"),
 			*Config.InstanceName.ToString(), e.what());
+		TrackEventQueue.Reset();
 		return false;
 	}
 
-	// Register as receiver
-	if (TrackLinkClient)
+	// Register as receiver (snapshot mode reads whole frames in ProcessPendingOperations instead)
+	if (TrackLinkClient && !Config.bUseFrameSnapshots)
 	{
 		TrackLinkClient->registerTrackReceiver(this);
 	}
@@ -188,6 +171,127 @@ bool UAefPharusInstance::Initialize(const FAefPharusInstanceConfig& InConfig, UW
 	return true;
 }
 
+TUniquePtr<pharus::TrackLinkClient> UAefPharusInstance::CreateTrackLinkClient(const FAefPharusInstanceConfig& InConfig, TArray<ANSICHAR>& OutBindNIC, TArray<ANSICHAR>& OutMulticastGroup) const
+{
+	// Prepare BindNIC string for TrackLinkClient
+	// IMPORTANT: TrackLinkClient stores a pointer to this string, the caller keeps it alive
+	const char* BindNICPtr = nullptr;
+
+	FString TrimmedBindNIC = InConfig.BindNIC.TrimStartAndEnd();
+	if (!TrimmedBindNIC.IsEmpty())
+	{
+		// Use specific network interface
+		// Convert FString to ANSI and store in persistent TArray
+		// +1 for null terminator
+		OutBindNIC.SetNumUninitialized(TrimmedBindNIC.Len() + 1);
+		FCStringAnsi::Strncpy(OutBindNIC.GetData(), TCHAR_TO_ANSI(*TrimmedBindNIC), OutBindNIC.Num());
+		BindNICPtr = OutBindNIC.GetData();
+	}
+	else
+	{
+		// Use INADDR_ANY (bind to all interfaces)
+		// IMPORTANT: Must use "0.0.0.0" string, NOT nullptr (inet_addr cannot handle nullptr!)
+		OutBindNIC.SetNumUninitialized(8);  // "0.0.0.0" + null terminator
+		FCStringAnsi::Strncpy(OutBindNIC.GetData(), "0.0.0.0", OutBindNIC.Num());
+		BindNICPtr = OutBindNIC.GetData();
+	}
+
+	// Prepare MulticastGroup string for TrackLinkClient
+	// IMPORTANT: TrackLinkClient stores a pointer to this string, the caller keeps it alive
+	const char* MulticastGroupPtr = nullptr;
+
+	FString TrimmedMulticastGroup = InConfig.MulticastGroup.TrimStartAndEnd();
+	if (!TrimmedMulticastGroup.IsEmpty())
+	{
+		// Convert FString to ANSI and store in persistent TArray
+		OutMulticastGroup.SetNumUninitialized(TrimmedMulticastGroup.Len() + 1);
+		FCStringAnsi::Strncpy(OutMulticastGroup.GetData(), TCHAR_TO_ANSI(*TrimmedMulticastGroup), OutMulticastGroup.Num());
+		MulticastGroupPtr = OutMulticastGroup.GetData();
+	}
+	else
+	{
+		// Use default multicast group
+		const char* DefaultMulticast = "239.1.1.1";
+		OutMulticastGroup.SetNumUninitialized(FCStringAnsi::Strlen(DefaultMulticast) + 1);
+		FCStringAnsi::Strncpy(OutMulticastGroup.GetData(), DefaultMulticast, OutMulticastGroup.Num());
+		MulticastGroupPtr = OutMulticastGroup.GetData();
+	}
+
+	pharus::TrackLinkOptions Options;
+	Options.multicast = InConfig.bIsMulticast;
+	Options.localIP = BindNICPtr;
+	Options.port = InConfig.UDPPort;
+	Options.multicastGroup = MulticastGroupPtr;
+	Options.protocol = InConfig.Protocol == EAefPharusProtocol::Tuio ? pharus::PROTOCOL_TUIO : pharus::PROTOCOL_TRACKLINK;
+	Options.tuioArea = { (float)InConfig.TuioAreaSize.X, (float)InConfig.TuioAreaSize.Y };
+	Options.snapshots = InConfig.bUseFrameSnapshots;
+	Options.receiveBufferSize = FMath::Max(0, InConfig.ReceiveBufferSize);
+
+	// Parallel receive sockets merge their frames into snapshots; per-track callbacks would race on the event queue
+	Options.receiveWorkers = FMath::Clamp(InConfig.ReceiveWorkers, 1, 16);
+	if (Options.receiveWorkers > 1 && !InConfig.bUseFrameSnapshots)
+	{
+		UE_LOG(LogAefPharus, Warning, TEXT("Instance '%s': ReceiveWorkers=%d requires UseFrameSnapshots=true, using one receive socket"),
+			*InConfig.InstanceName.ToString(), Options.receiveWorkers);
+		Options.receiveWorkers = 1;
+	}
+
+	// Low-latency receive on a dedicated thread that polls instead of sleeping
+	Options.busyPoll = InConfig.bBusyPoll;
+	Options.busyPollSpinUs = FMath::Max(0, InConfig.BusyPollSpinMicroseconds);
+	Options.busyPollYieldUs = FMath::Max(0, InConfig.BusyPollYieldMicroseconds);
+	Options.busyPollSocketUs = FMath::Max(0, InConfig.BusyPollSocketMicroseconds);
+
+	// Name, priority and affinity of this instance's own receive thread(s), if it gets any
+	Options.thread = UAefPharusSubsystem::MakeNetworkThreadOptions(InConfig.ReceiveThreadPriority, InConfig.ReceiveThreadAffinityMask,
+		FString::Printf(TEXT("PharusReceive %s"), *InConfig.InstanceName.ToString()));
+
+	// Use the subsystem's shared network threads if available
+	if (UAefPharusSubsystem* Subsystem = Cast<UAefPharusSubsystem>(GetOuter()))
+	{
+		Options.reactor = Subsystem->GetNetworkReactor();
+	}
+
+	// Venue traffic capture / replay; the client only reads the paths while it is constructed.
+	// Every capture gets a new name, a hot network switch must not truncate the file still being written.
+	FString ReplayPath = InConfig.ReplayFile.TrimStartAndEnd();
+	FString CapturePath;
+	if (!ReplayPath.IsEmpty())
+	{
+		ReplayPath = FPaths::ConvertRelativePathToFull(GetCaptureDirectory(), ReplayPath);
+	}
+	else if (InConfig.bCaptureTraffic)
+	{
+		IFileManager::Get().MakeDirectory(*GetCaptureDirectory(), true);
+		CapturePath = GetCaptureDirectory() / FString::Printf(TEXT("%s_%s.tlcap"),
+			*InConfig.InstanceName.ToString(), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S-%s")));
+	}
+	const FTCHARToUTF8 ReplayPathUtf8(*ReplayPath);
+	const FTCHARToUTF8 CapturePathUtf8(*CapturePath);
+	Options.replayFile = ReplayPath.IsEmpty() ? nullptr : ReplayPathUtf8.Get();
+	Options.replaySpeed = FMath::Max(0.0f, InConfig.ReplaySpeed);
+	Options.captureFile = CapturePath.IsEmpty() ? nullptr : CapturePathUtf8.Get();
+
+	// Shared-memory bridge to the other processes on this host; the name is read while constructing, too
+	switch (InConfig.BridgeMode)
+	{
+	case EAefPharusBridgeMode::Publish:		Options.bridge = pharus::BRIDGE_PUBLISH; break;
+	case EAefPharusBridgeMode::Subscribe:	Options.bridge = pharus::BRIDGE_SUBSCRIBE; break;
+	case EAefPharusBridgeMode::Auto:		Options.bridge = pharus::BRIDGE_AUTO; break;
+	default:								Options.bridge = pharus::BRIDGE_OFF; break;
+	}
+	const FString BridgeName = InConfig.BridgeName.TrimStartAndEnd();
+	const FTCHARToUTF8 BridgeNameUtf8(*BridgeName);
+	Options.bridgeName = BridgeName.IsEmpty() ? nullptr : BridgeNameUtf8.Get();
+
+	return MakeUnique<pharus::TrackLinkClient>(Options);
+}
+
+FString UAefPharusInstance::GetCaptureDirectory()
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("Pharus") / TEXT("Captures"));
+}
+
 void UAefPharusInstance::Shutdown()
 {
 	if (!bIsRunning)
@@ -208,6 +312,13 @@ void UAefPharusInstance::Shutdown()
 		TrackLinkClient->unregisterTrackReceiver(this);
 		TrackLinkClient.Reset();
 	}
+	PendingRebind.Reset();
+
+	// Network thread is gone - drop undelivered events
+	TrackEventQueue.Reset();
+	PendingSpawns.Reset();
+	PendingUpdates.Reset();
+	PendingRemovals.Reset();
 
 	// Shutdown actor pool if exists
 	if (ActorPool)
@@ -231,6 +342,8 @@ void UAefPharusInstance::Shutdown()
 	SpawnedActors.Empty();
 	TrackToPoolIndex.Empty();
 	TrackDataCache.Empty();
+	TracksOutsideBounds.Empty();
+	RebindUnconfirmedTracks.Empty();
 
 	bIsRunning = false;
 
@@ -243,179 +356,346 @@ void UAefPharusInstance::Shutdown()
 
 void UAefPharusInstance::onTrackNew(const pharus::TrackRecord& Track)
 {
+	EnqueueTrackEvent(MakeTrackEvent(FAefPharusTrackEvent::EKind::New, Track));
+}
+
+void UAefPharusInstance::onTrackUpdate(const pharus::TrackRecord& Track)
+{
+	EnqueueTrackEvent(MakeTrackEvent(FAefPharusTrackEvent::EKind::Update, Track));
+}
+
+void UAefPharusInstance::onTrackLost(const pharus::TrackRecord& Track)
+{
+	EnqueueTrackEvent(MakeTrackEvent(FAefPharusTrackEvent::EKind::Lost, Track));
+}
+
+FAefPharusTrackEvent UAefPharusInstance::MakeTrackEvent(FAefPharusTrackEvent::EKind Kind, const pharus::TrackRecord& Track)
+{
+	FAefPharusTrackEvent Event;
+	Event.Kind = Kind;
+	Event.TrackID = Track.trackID;
+
+	if (Kind == FAefPharusTrackEvent::EKind::Lost)
+	{
+		return Event;
+	}
+
 	// Use relPos (TUIO-normalized 0-1 coordinates) instead of currentPos (absolute meters)
 	// TUIO has origin top-left (Y=0 at top), flip Y to match UE coordinate system
-	const FVector2D InputPos = FVector2D(Track.relPos.x, 1.0f - Track.relPos.y);
-	const bool bIsValid = IsTrackPositionValid(InputPos);
+	Event.InputPos = FVector2D(Track.relPos.x, 1.0f - Track.relPos.y);
+	Event.Orientation = FVector2D(Track.orientation.x, Track.orientation.y);
+	Event.Speed = Track.speed;
+
+	// Timestamp for timeout detection (UDP packet received); bounds and mapping follow on the game thread
+	Event.ReceiveTime = FPlatformTime::Seconds();
+	Event.ArrivalTimeNs = Track.arrivalTimeNs;
 
-	FScopeLock Lock(&PendingOperationsMutex);
+	return Event;
+}
 
-	if (!bIsValid)
+void UAefPharusInstance::EnqueueTrackEvent(const FAefPharusTrackEvent& Event)
+{
+	if (!TrackEventQueue->Enqueue(Event))
 	{
-		// Track starts outside valid bounds - remember it but don't spawn
-		// Still add to TrackDataCache for timeout tracking!
-		TracksOutsideBounds.Add(Track.trackID);
-		
-		FAefPharusTrackData TrackData;
-		TrackData.TrackID = Track.trackID;
-		TrackData.LastUpdateTime = FPlatformTime::Seconds();
-		TrackData.bIsInsideBoundary = false;  // Outside bounds
-		TrackDataCache.Add(Track.trackID, TrackData);
-		
-		if (Config.bLogRejectedTracks)
+		// Game thread is not keeping up - drop, ProcessPendingOperations reports it.
+		// A dropped Update is superseded by the next frame; a dropped New is recovered
+		// by the next Update, a dropped Lost by TrackLostTimeout.
+		TrackEventOverflows.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	// Single producer: no other thread writes the high-water mark
+	const int32 Fill = (int32)TrackEventQueue->Count();
+	if (Fill > TrackEventHighWater.load(std::memory_order_relaxed))
+	{
+		TrackEventHighWater.store(Fill, std::memory_order_relaxed);
+	}
+}
+
+//--------------------------------------------------------------------------------
+// Track Events (Game Thread)
+//--------------------------------------------------------------------------------
+
+void UAefPharusInstance::StageTrackEvent(const FAefPharusTrackEvent& Event)
+{
+	int32* StagedIndex = StagedTrackIndices.Find(Event.TrackID);
+
+	if (Event.Kind == FAefPharusTrackEvent::EKind::Lost)
+	{
+		// Whatever was staged for the track is moot now. Lost needs no mapping: apply it at once,
+		// so a track that reappears under the same ID later in the tick is staged anew
+		if (StagedIndex)
 		{
-			const FVector2D NormalizedPos = NormalizeTrackPosition(InputPos);
-			UE_LOG(LogAefPharus, Warning, 
-				TEXT("[%s] Track %d outside bounds (new) - position (%.3f, %.3f) normalized (%.3f, %.3f) - waiting for valid position"),
-				*Config.InstanceName.ToString(), Track.trackID, 
-				InputPos.X, InputPos.Y, NormalizedPos.X, NormalizedPos.Y);
+			StagedTracks[*StagedIndex].Kind = FAefPharusTrackEvent::EKind::Lost; // Skipped by MapStagedTracks
+			StagedTrackIndices.Remove(Event.TrackID);
+			++CoalescedTrackEvents;
 		}
+
+		FAefPharusMappedTrackEvent Lost;
+		Lost.Kind = FAefPharusTrackEvent::EKind::Lost;
+		Lost.Data.TrackID = Event.TrackID;
+		ApplyTrackEvent(Lost);
 		return;
 	}
 
-	// Track is valid - spawn actor
-	const FVector WorldPos = TrackToWorld(InputPos, Track);
-	const FAefPharusTrackData TrackData = ConvertTrackData(Track, WorldPos, InputPos);
-
-	PendingSpawns.AddUnique(Track.trackID);
-	TrackDataCache.Add(Track.trackID, TrackData);
+	if (!StagedIndex)
+	{
+		StagedTrackIndices.Add(Event.TrackID, StagedTracks.Add(Event));
+		return;
+	}
 
-	if (Config.bLogTrackerSpawned)
+	// Only the latest state of a track is mapped; a staged New stays New
+	FAefPharusTrackEvent& Staged = StagedTracks[*StagedIndex];
+	const bool bNew = Staged.Kind == FAefPharusTrackEvent::EKind::New;
+	Staged = Event;
+	if (bNew)
 	{
-		// Debug: Show raw TUIO coordinates and transformed world position for mirroring diagnosis
-		UE_LOG(LogAefPharus, Log, TEXT("[%s] Track %d spawned at %s (Speed: %.2f cm/s) | RAW TUIO: (%.3f, %.3f) -> InputPos: (%.3f, %.3f)"),
-			*Config.InstanceName.ToString(), Track.trackID, *WorldPos.ToString(), Track.speed * 100.0f,
-			Track.relPos.x, Track.relPos.y, InputPos.X, InputPos.Y);
+		Staged.Kind = FAefPharusTrackEvent::EKind::New;
 	}
+	++CoalescedTrackEvents;
 }
 
-void UAefPharusInstance::onTrackUpdate(const pharus::TrackRecord& Track)
+void UAefPharusInstance::MapStagedTracks()
 {
-	// Use relPos (TUIO-normalized 0-1 coordinates) instead of currentPos (absolute meters)
-	// TUIO has origin top-left (Y=0 at top), flip Y to match UE coordinate system
-	const FVector2D InputPos = FVector2D(Track.relPos.x, 1.0f - Track.relPos.y);
-	const bool bIsValid = IsTrackPositionValid(InputPos);
-
-	FScopeLock Lock(&PendingOperationsMutex);
+	const int32 NumStaged = StagedTracks.Num();
+	if (NumStaged == 0)
+	{
+		return;
+	}
 
-	const bool bWasOutside = TracksOutsideBounds.Contains(Track.trackID);
+	// Normalized positions of the whole batch, then the wall regions in one lookup pass
+	StagedPositions.SetNumUninitialized(NumStaged, EAllowShrinking::No);
+	for (int32 i = 0; i < NumStaged; ++i)
+	{
+		StagedPositions[i] = NormalizeTrackPosition(StagedTracks[i].InputPos);
+	}
 
-	if (!bIsValid)
+	const bool bRegions = Config.MappingMode == EAefPharusMappingMode::Regions;
+	if (bRegions)
 	{
-		// Track is outside valid bounds - always update timestamp for timeout tracking
-		FAefPharusTrackData* ExistingData = TrackDataCache.Find(Track.trackID);
-		if (ExistingData)
+		StagedRegionIndices.SetNumUninitialized(NumStaged, EAllowShrinking::No);
+		if (Config.WallRegions.Num() > FAefPharusMappingTransforms::MaxWallRegions)
 		{
-			ExistingData->LastUpdateTime = FPlatformTime::Seconds();
-			ExistingData->bIsInsideBoundary = false;  // Track is outside bounds
+			for (int32 i = 0; i < NumStaged; ++i)
+			{
+				StagedRegionIndices[i] = FindWallRegionIndex(StagedPositions[i]);
+			}
 		}
 		else
 		{
-			// Track not in cache yet - add it for timeout tracking
-			FAefPharusTrackData TrackData;
-			TrackData.TrackID = Track.trackID;
-			TrackData.LastUpdateTime = FPlatformTime::Seconds();
-			TrackData.bIsInsideBoundary = false;  // Outside bounds
-			TrackDataCache.Add(Track.trackID, TrackData);
-		}
-		
-		if (!bWasOutside)
-		{
-			// Track moved OUT of bounds - mark and remove actor
-			TracksOutsideBounds.Add(Track.trackID);
-			PendingRemovals.AddUnique(Track.trackID);
-			
-			if (Config.bLogRejectedTracks)
-			{
-				const FVector2D NormalizedPos = NormalizeTrackPosition(InputPos);
-				UE_LOG(LogAefPharus, Warning, 
-					TEXT("[%s] Track %d LEFT valid bounds - position (%.3f, %.3f) normalized (%.3f, %.3f) - removing actor"),
-					*Config.InstanceName.ToString(), Track.trackID, 
-					InputPos.X, InputPos.Y, NormalizedPos.X, NormalizedPos.Y);
-			}
+			Transforms.RegionLookup.FindBatch(StagedPositions, StagedRegionIndices);
 		}
-		// else: already outside, just updated timestamp
-		return;
 	}
 
-	// Track is inside valid bounds
-	if (bWasOutside)
+	for (int32 i = 0; i < NumStaged; ++i)
 	{
-		// Track moved INTO bounds - spawn actor
-		TracksOutsideBounds.Remove(Track.trackID);
-		
-		const FVector WorldPos = TrackToWorld(InputPos, Track);
-		const FAefPharusTrackData TrackData = ConvertTrackData(Track, WorldPos, InputPos);
-		
-		PendingSpawns.AddUnique(Track.trackID);
-		TrackDataCache.Add(Track.trackID, TrackData);
-		
-		if (Config.bLogTrackerSpawned)
+		const FAefPharusTrackEvent& Staged = StagedTracks[i];
+		if (Staged.Kind == FAefPharusTrackEvent::EKind::Lost)
 		{
-			UE_LOG(LogAefPharus, Log, TEXT("[%s] Track %d ENTERED valid bounds - spawning at %s"),
-				*Config.InstanceName.ToString(), Track.trackID, *WorldPos.ToString());
+			continue; // Dropped by a Lost event
 		}
-		return;
-	}
 
-	// Track is inside and was inside - normal update path
-	// Update LastUpdateTime to prevent timeout on static tracks
-	FAefPharusTrackData* ExistingData = TrackDataCache.Find(Track.trackID);
-	if (!ExistingData)
-	{
-		// Edge case: Track was never properly spawned, spawn it now
-		const FVector WorldPos = TrackToWorld(InputPos, Track);
-		const FAefPharusTrackData TrackData = ConvertTrackData(Track, WorldPos, InputPos);
-		
-		PendingSpawns.AddUnique(Track.trackID);
-		TrackDataCache.Add(Track.trackID, TrackData);
-		
-		if (Config.bLogTrackerSpawned)
+		const int32 RegionIndex = bRegions ? StagedRegionIndices[i] : INDEX_NONE;
+
+		FAefPharusMappedTrackEvent Event;
+		Event.Kind = Staged.Kind;
+		Event.InputPos = Staged.InputPos;
+		Event.bInsideBounds = bRegions ? RegionIndex != INDEX_NONE : IsTrackPositionValid(Staged.InputPos);
+
+		if (Event.bInsideBounds)
 		{
-			UE_LOG(LogAefPharus, Log, TEXT("[%s] Track %d spawned (recovery) at %s"),
-				*Config.InstanceName.ToString(), Track.trackID, *WorldPos.ToString());
+			Event.Data = ConvertTrackData(Staged, StagedPositions[i], RegionIndex);
 		}
-		return;
+		else
+		{
+			// Outside bounds - only the timestamp matters (timeout tracking)
+			Event.Data.TrackID = Staged.TrackID;
+			Event.Data.LastUpdateTime = Staged.ReceiveTime;
+			Event.Data.bIsInsideBoundary = false;
+		}
+
+		ApplyTrackEvent(Event);
 	}
 
-	ExistingData->LastUpdateTime = FPlatformTime::Seconds();
+	StagedTracks.Reset();
+	StagedTrackIndices.Reset();
+}
 
-	// ALWAYS recalculate world position (RootOrigin/RootRotation may have changed)
-	const FVector WorldPos = TrackToWorld(InputPos, Track);
-	const FAefPharusTrackData TrackData = ConvertTrackData(Track, WorldPos, InputPos);
-	
-	// Update the cached data (so actor always has correct position relative to RootOrigin)
-	TrackDataCache.FindOrAdd(Track.trackID) = TrackData;
-	
-	// Always queue update - even for static trackers we need to apply RootOrigin changes
-	PendingUpdates.AddUnique(Track.trackID);
+void UAefPharusInstance::ApplyTrackEvent(const FAefPharusMappedTrackEvent& Event)
+{
+	const int32 TrackID = Event.Data.TrackID;
+	const FVector2D& InputPos = Event.InputPos;
+	const bool bWasOutside = TracksOutsideBounds.Contains(TrackID);
 
-	if (Config.bLogTrackerUpdated)
+	// The new stream confirmed a track kept across a network switch
+	if (RebindUnconfirmedTracks.Num() > 0)
 	{
-		UE_LOG(LogAefPharus, VeryVerbose, TEXT("[%s] Track %d updated at %s"),
-			*Config.InstanceName.ToString(), Track.trackID, *WorldPos.ToString());
+		RebindUnconfirmedTracks.Remove(TrackID);
+	}
+
+	switch (Event.Kind)
+	{
+		case FAefPharusTrackEvent::EKind::New:
+		{
+			if (!Event.bInsideBounds)
+			{
+				// Track starts outside valid bounds - remember it but don't spawn
+				// Still add to TrackDataCache for timeout tracking!
+				TracksOutsideBounds.Add(TrackID);
+				TrackDataCache.Add(TrackID, Event.Data);
+
+				if (Config.bLogRejectedTracks)
+				{
+					const FVector2D NormalizedPos = NormalizeTrackPosition(InputPos);
+					UE_LOG(LogAefPharus, Warning, 
+						TEXT("[%s] Track %d outside bounds (new) - position (%.3f, %.3f) normalized (%.3f, %.3f) - waiting for valid position"),
+						*Config.InstanceName.ToString(), TrackID, 
+						InputPos.X, InputPos.Y, NormalizedPos.X, NormalizedPos.Y);
+				}
+				return;
+			}
+
+			// Track is valid - spawn actor
+			PendingSpawns.Add(TrackID);
+			TrackDataCache.Add(TrackID, Event.Data);
+
+			if (Config.bLogTrackerSpawned)
+			{
+				// Debug: Show raw TUIO coordinates and transformed world position for mirroring diagnosis
+				UE_LOG(LogAefPharus, Log, TEXT("[%s] Track %d spawned at %s (Speed: %.2f cm/s) | RAW TUIO: (%.3f, %.3f) -> InputPos: (%.3f, %.3f)"),
+					*Config.InstanceName.ToString(), TrackID, *Event.Data.WorldPosition.ToString(), Event.Data.Speed,
+					InputPos.X, 1.0f - InputPos.Y, InputPos.X, InputPos.Y);
+			}
+			return;
+		}
+
+		case FAefPharusTrackEvent::EKind::Update:
+		{
+			if (!Event.bInsideBounds)
+			{
+				// Track is outside valid bounds - always update timestamp for timeout tracking
+				FAefPharusTrackData* ExistingData = TrackDataCache.Find(TrackID);
+				if (ExistingData)
+				{
+					ExistingData->LastUpdateTime = Event.Data.LastUpdateTime;
+					ExistingData->bIsInsideBoundary = false;  // Track is outside bounds
+				}
+				else
+				{
+					// Track not in cache yet - add it for timeout tracking
+					TrackDataCache.Add(TrackID, Event.Data);
+				}
+
+				if (!bWasOutside)
+				{
+					// Track moved OUT of bounds - mark and remove actor
+					TracksOutsideBounds.Add(TrackID);
+					PendingRemovals.Add(TrackID);
+
+					if (Config.bLogRejectedTracks)
+					{
+						const FVector2D NormalizedPos = NormalizeTrackPosition(InputPos);
+						UE_LOG(LogAefPharus, Warning, 
+							TEXT("[%s] Track %d LEFT valid bounds - position (%.3f, %.3f) normalized (%.3f, %.3f) - removing actor"),
+							*Config.InstanceName.ToString(), TrackID, 
+							InputPos.X, InputPos.Y, NormalizedPos.X, NormalizedPos.Y);
+					}
+				}
+				// else: already outside, just updated timestamp
+				return;
+			}
+
+			// Track is inside valid bounds
+			if (bWasOutside)
+			{
+				// Track moved INTO bounds - spawn actor
+				TracksOutsideBounds.Remove(TrackID);
+				PendingSpawns.Add(TrackID);
+				TrackDataCache.Add(TrackID, Event.Data);
+
+				if (Config.bLogTrackerSpawned)
+				{
+					UE_LOG(LogAefPharus, Log, TEXT("[%s] Track %d ENTERED valid bounds - spawning at %s"),
+						*Config.InstanceName.ToString(), TrackID, *Event.Data.WorldPosition.ToString());
+				}
+				return;
+			}
+
+			// Track is inside and was inside - normal update path
+			FAefPharusTrackData* ExistingData = TrackDataCache.Find(TrackID);
+			if (!ExistingData)
+			{
+				// Edge case: Track was never properly spawned (or its New event was dropped), spawn it now
+				PendingSpawns.Add(TrackID);
+				TrackDataCache.Add(TrackID, Event.Data);
+
+				if (Config.bLogTrackerSpawned)
+				{
+					UE_LOG(LogAefPharus, Log, TEXT("[%s] Track %d spawned (recovery) at %s"),
+						*Config.InstanceName.ToString(), TrackID, *Event.Data.WorldPosition.ToString());
+				}
+				return;
+			}
+
+			// Update the cached data (so actor always has correct position relative to RootOrigin)
+			*ExistingData = Event.Data;
+
+			// Always queue update - even for static trackers we need to apply RootOrigin changes
+			PendingUpdates.Add(TrackID);
+
+			if (Config.bLogTrackerUpdated)
+			{
+				UE_LOG(LogAefPharus, VeryVerbose, TEXT("[%s] Track %d updated at %s"),
+					*Config.InstanceName.ToString(), TrackID, *Event.Data.WorldPosition.ToString());
+			}
+			return;
+		}
+
+		case FAefPharusTrackEvent::EKind::Lost:
+		{
+			// Clean up tracking state
+			TracksOutsideBounds.Remove(TrackID);
+
+			// Only queue removal if track had an actor (was inside bounds)
+			if (!bWasOutside)
+			{
+				PendingRemovals.Add(TrackID);
+			}
+
+			if (Config.bLogTrackerRemoved)
+			{
+				UE_LOG(LogAefPharus, Log, TEXT("[%s] Track %d lost%s"),
+					*Config.InstanceName.ToString(), TrackID,
+					bWasOutside ? TEXT(" (was outside bounds)") : TEXT(""));
+			}
+			return;
+		}
 	}
 }
 
-void UAefPharusInstance::onTrackLost(const pharus::TrackRecord& Track)
+void UAefPharusInstance::ApplyFrameSnapshot()
 {
-	FScopeLock Lock(&PendingOperationsMutex);
-	
-	// Clean up tracking state
-	const bool bWasOutside = TracksOutsideBounds.Contains(Track.trackID);
-	TracksOutsideBounds.Remove(Track.trackID);
-	
-	// Only queue removal if track had an actor (was inside bounds)
-	if (!bWasOutside)
+	const pharus::TrackSnapshot* Snapshot = TrackLinkClient ? TrackLinkClient->acquireSnapshot() : nullptr;
+	if (!Snapshot || !SnapshotDiff.apply(*Snapshot))
 	{
-		PendingRemovals.AddUnique(Track.trackID);
+		return; // No new frame since last tick
 	}
 
-	if (Config.bLogTrackerRemoved)
+	for (const unsigned int TrackID : SnapshotDiff.lostTrackIDs())
 	{
-		UE_LOG(LogAefPharus, Log, TEXT("[%s] Track %d lost%s"),
-			*Config.InstanceName.ToString(), Track.trackID,
-			bWasOutside ? TEXT(" (was outside bounds)") : TEXT(""));
+		pharus::TrackRecord LostTrack;
+		LostTrack.trackID = TrackID;
+		StageTrackEvent(MakeTrackEvent(FAefPharusTrackEvent::EKind::Lost, LostTrack));
+	}
+
+	for (const pharus::TrackRecord* Track : SnapshotDiff.newTracks())
+	{
+		StageTrackEvent(MakeTrackEvent(FAefPharusTrackEvent::EKind::New, *Track));
+	}
+
+	for (const pharus::TrackRecord* Track : SnapshotDiff.updatedTracks())
+	{
+		StageTrackEvent(MakeTrackEvent(FAefPharusTrackEvent::EKind::Update, *Track));
 	}
 }
 
@@ -425,7 +705,6 @@ void UAefPharusInstance::onTrackLost(const pharus::TrackRecord& Track)
 
 bool UAefPharusInstance::GetTrackData(int32 TrackID, FVector& OutPosition, FRotator& OutRotation, bool& bOutIsInsideBoundary)
 {
-	FScopeLock Lock(&PendingOperationsMutex);
 	FAefPharusTrackData* Data = TrackDataCache.Find(TrackID);
 	if (!Data)
 	{
@@ -444,7 +723,6 @@ bool UAefPharusInstance::GetTrackData(int32 TrackID, FVector& OutPosition, FRota
 
 TArray<int32> UAefPharusInstance::GetActiveTrackIDs() const
 {
-	FScopeLock Lock(&PendingOperationsMutex);
 	TArray<int32> TrackIDs;
 	TrackDataCache.GetKeys(TrackIDs);
 	return TrackIDs;
@@ -452,7 +730,6 @@ TArray<int32> UAefPharusInstance::GetActiveTrackIDs() const
 
 int32 UAefPharusInstance::GetActiveTrackCount() const
 {
-	FScopeLock Lock(&PendingOperationsMutex);
 	return TrackDataCache.Num();
 }
 
@@ -465,10 +742,162 @@ AActor* UAefPharusInstance::GetSpawnedActor(int32 TrackID)
 
 bool UAefPharusInstance::IsTrackActive(int32 TrackID) const
 {
-	FScopeLock Lock(&PendingOperationsMutex);
 	return TrackDataCache.Contains(TrackID);
 }
 
+FAefPharusEventQueueStats UAefPharusInstance::GetEventQueueStats() const
+{
+	FAefPharusEventQueueStats Stats;
+	if (TrackEventQueue)
+	{
+		Stats.Capacity = TrackEventQueueCapacity;
+		Stats.Pending = (int32)TrackEventQueue->Count();
+	}
+	Stats.HighWaterMark = TrackEventHighWater.load(std::memory_order_relaxed);
+	Stats.OverflowCount = TrackEventOverflows.load(std::memory_order_relaxed);
+	Stats.CoalescedCount = CoalescedTrackEvents;
+	return Stats;
+}
+
+FAefPharusLatencyStats UAefPharusInstance::GetLatencyStats() const
+{
+	FAefPharusLatencyStats Stats;
+	Stats.bKernelTimestamps = TrackLinkClient && TrackLinkClient->getStatistics().kernelTimestamps;
+	Stats.SampleCount = LatencySamplesMs.Num();
+	if (Stats.SampleCount == 0)
+	{
+		return Stats;
+	}
+
+	TArray<float> Sorted(LatencySamplesMs);
+	Sorted.Sort();
+
+	// Nearest-rank percentile
+	auto Percentile = [&Sorted](float Fraction)
+	{
+		const int32 Rank = FMath::CeilToInt(Fraction * Sorted.Num());
+		return Sorted[FMath::Clamp(Rank - 1, 0, Sorted.Num() - 1)];
+	};
+	Stats.P50Ms = Percentile(0.50f);
+	Stats.P95Ms = Percentile(0.95f);
+	Stats.P99Ms = Percentile(0.99f);
+	Stats.MaxMs = Sorted.Last();
+	return Stats;
+}
+
+void UAefPharusInstance::ResetLatencyStats()
+{
+	LatencySamplesMs.Reset(LatencySampleCapacity);
+	LatencySampleNext = 0;
+}
+
+FAefPharusNetworkStats UAefPharusInstance::GetNetworkStats() const
+{
+	FAefPharusNetworkStats Stats = NetworkStats;
+	if (TrackLinkClient)
+	{
+		const long long LastArrivalNs = TrackLinkClient->getStatistics().lastArrivalNs;
+		Stats.SecondsSinceLastPacket = LastArrivalNs > 0
+			? (float)((double)(pharus::TrackLinkClient::timestampNow() - LastArrivalNs) * 1e-9)
+			: -1.0f;
+	}
+	return Stats;
+}
+
+void UAefPharusInstance::SampleNetworkStats(double Now)
+{
+	const pharus::TrackLinkStatistics Counters = TrackLinkClient->getStatistics();
+	const double Interval = Now - LastNetworkSampleTime;
+	const uint64 Datagrams = Counters.recvDatagrams - LastNetworkCounters.recvDatagrams;
+	const uint64 Bytes = Counters.recvBytes - LastNetworkCounters.recvBytes;
+	const uint64 Frames = Counters.frames - LastNetworkCounters.frames;
+	const uint64 Tracks = Counters.tracks - LastNetworkCounters.tracks;
+	const uint64 Malformed = Counters.malformedFrames - LastNetworkCounters.malformedFrames;
+
+	NetworkStats.SampleInterval = (float)Interval;
+	NetworkStats.PacketsPerSecond = (float)(Datagrams / Interval);
+	NetworkStats.BytesPerSecond = (float)(Bytes / Interval);
+	NetworkStats.FramesPerSecond = (float)(Frames / Interval);
+	NetworkStats.TracksPerPacket = Frames > 0 ? (float)((double)Tracks / Frames) : 0.0f;
+	NetworkStats.JitterMs = (float)(Counters.interArrivalJitterNs * 1e-6);
+	NetworkStats.TotalPackets = (int64)Counters.recvDatagrams;
+	NetworkStats.MalformedPackets = (int64)Counters.malformedFrames;
+	NetworkStats.Senders = Counters.senders;
+	NetworkStats.ReassemblyDrops = (int64)(Counters.reassemblyTimeouts + Counters.reassemblyOverflows + Counters.reassemblyEvictions);
+	NetworkStats.KernelDrops = (int64)Counters.kernelDrops;
+	NetworkStats.ReceiveBufferSize = Counters.receiveBufferSize;
+
+	// Receive cost vs. wakeup delay, to compare busy polling against blocking receives
+	const uint64 DelaySamples = Counters.receiveDelaySamples - LastNetworkCounters.receiveDelaySamples;
+	const uint64 EmptyPolls = Counters.busyPollEmpty - LastNetworkCounters.busyPollEmpty;
+	const uint64 Batches = Counters.recvBatches - LastNetworkCounters.recvBatches;
+	NetworkStats.bBusyPoll = Counters.busyPoll;
+	NetworkStats.ReceiveCpuPercent = (Counters.receiveCpuNs >= 0 && LastNetworkCounters.receiveCpuNs >= 0)
+		? (float)((double)(Counters.receiveCpuNs - LastNetworkCounters.receiveCpuNs) * 1e-7 / Interval)
+		: -1.0f;
+	NetworkStats.ReceiveDelayUs = DelaySamples > 0
+		? (float)((double)(Counters.receiveDelaySumNs - LastNetworkCounters.receiveDelaySumNs) * 1e-3 / DelaySamples)
+		: -1.0f;
+	NetworkStats.EmptyPollRatio = (EmptyPolls + Batches) > 0 ? (float)((double)EmptyPolls / (EmptyPolls + Batches)) : 0.0f;
+	NetworkStats.BridgeRole = Counters.bridgeRole == pharus::BRIDGE_PUBLISH ? EAefPharusBridgeMode::Publish
+		: Counters.bridgeRole == pharus::BRIDGE_SUBSCRIBE ? EAefPharusBridgeMode::Subscribe
+		: EAefPharusBridgeMode::Off;
+	NetworkStats.BridgeSkippedFrames = (int64)Counters.bridgeSkippedFrames;
+
+	LastNetworkCounters = Counters;
+	LastNetworkSampleTime = Now;
+
+	if (Config.bLogNetworkStats)
+	{
+		const FAefPharusNetworkStats Stats = GetNetworkStats();
+		const FString DelayText = Stats.ReceiveDelayUs >= 0.0f ? FString::Printf(TEXT("%.1f us"), Stats.ReceiveDelayUs) : FString(TEXT("n/a"));
+		const FString CpuText = Stats.ReceiveCpuPercent >= 0.0f ? FString::Printf(TEXT("%.1f%%"), Stats.ReceiveCpuPercent) : FString(TEXT("n/a"));
+		UE_LOG(LogAefPharus, Log, TEXT("[%s] Network: %.1f packets/s, %.1f KB/s, %.1f frames/s, %.1f tracks/frame, jitter %.2f ms, last packet %.2f s ago, malformed %llu (+%llu), senders %d, reassembly drops %lld, kernel drops %llu, receive delay %s, receive CPU %s%s%s"),
+			*Config.InstanceName.ToString(),
+			Stats.PacketsPerSecond,
+			Stats.BytesPerSecond / 1024.0f,
+			Stats.FramesPerSecond,
+			Stats.TracksPerPacket,
+			Stats.JitterMs,
+			Stats.SecondsSinceLastPacket,
+			Counters.malformedFrames, Malformed,
+			Stats.Senders, Stats.ReassemblyDrops,
+			Counters.kernelDrops,
+			*DelayText,
+			*CpuText,
+			Stats.bBusyPoll ? TEXT(" (busy-poll)") : TEXT(""),
+			Stats.BridgeRole == EAefPharusBridgeMode::Publish ? TEXT(" (bridge publisher)")
+				: Stats.BridgeRole == EAefPharusBridgeMode::Subscribe ? TEXT(" (bridge subscriber)") : TEXT(""));
+	}
+}
+
+void UAefPharusInstance::RecordLatencySample(int64 ArrivalTimeNs)
+{
+	// Injected tracks carry no arrival time
+	if (ArrivalTimeNs <= 0)
+	{
+		return;
+	}
+
+	// Same wall clock as the receive timestamps; a clock step can make the difference negative
+	const int64 LatencyNs = pharus::TrackLinkClient::timestampNow() - ArrivalTimeNs;
+	if (LatencyNs < 0)
+	{
+		return;
+	}
+
+	const float LatencyMs = (float)((double)LatencyNs * 1e-6);
+	if (LatencySamplesMs.Num() < LatencySampleCapacity)
+	{
+		LatencySamplesMs.Add(LatencyMs);
+	}
+	else
+	{
+		LatencySamplesMs[LatencySampleNext] = LatencyMs;
+		LatencySampleNext = (LatencySampleNext + 1) % LatencySampleCapacity;
+	}
+}
+
 //--------------------------------------------------------------------------------
 // Configuration
 //--------------------------------------------------------------------------------
@@ -490,6 +919,7 @@ bool UAefPharusInstance::UpdateConfig(const FAefPharusInstanceConfig& NewConfig)
 	Config.bInvertY = NewConfig.bInvertY;
 	Config.WallRegions = NewConfig.WallRegions;
 	Config.bDebugVisualization = NewConfig.bDebugVisualization;
+	RefreshTransforms(true);
 
 	UE_LOG(LogAefPharus, Log, TEXT("Configuration updated for instance '%s'"),
 		*Config.InstanceName.ToString());
@@ -525,6 +955,8 @@ bool UAefPharusInstance::UpdateFloorSettings(const FAefPharusInstanceConfig& New
 	Config.SpawnCollisionHandling = NewConfig.SpawnCollisionHandling;
 	Config.bAutoDestroyOnTrackLost = NewConfig.bAutoDestroyOnTrackLost;
 
+	RefreshTransforms(true);
+
 	UE_LOG(LogAefPharus, Log, TEXT("Floor settings updated: Scale=%s, FloorZ=%.2f, Rotation=%.2f, InvertY=%s"),
 		*Config.SimpleScale.ToString(),
 		Config.FloorZ,
@@ -551,6 +983,7 @@ bool UAefPharusInstance::UpdateFloorSettingsSimple(float OriginX, float OriginY,
 	Config.FloorZ = FloorZ;
 	Config.FloorRotation = FloorRotation;
 	Config.bInvertY = bInvertY;
+	RefreshTransforms(true);
 
 	UE_LOG(LogAefPharus, Log, TEXT("Floor settings updated for instance '%s': Scale=(%.2f, %.2f), FloorZ=%.2f, Rotation=%.2f, InvertY=%s"),
 		*Config.InstanceName.ToString(), ScaleX, ScaleY, FloorZ, FloorRotation, bInvertY ? TEXT("true") : TEXT("false"));
@@ -572,6 +1005,12 @@ bool UAefPharusInstance::UpdateWallSettings(const FAefPharusInstanceConfig& NewC
 	// Basic Settings (Enable cannot be changed at runtime)
 	Config.MappingMode = NewConfig.MappingMode;
 
+	// Wall regions (only read from disk in Regions mode)
+	if (NewConfig.WallRegions.Num() > 0)
+	{
+		Config.WallRegions = NewConfig.WallRegions;
+	}
+
 	// Tracking Surface Configuration
 	Config.TrackingSurfaceDimensions = NewConfig.TrackingSurfaceDimensions;
 	Config.bUseNormalizedCoordinates = NewConfig.bUseNormalizedCoordinates;
@@ -580,9 +1019,13 @@ bool UAefPharusInstance::UpdateWallSettings(const FAefPharusInstanceConfig& NewC
 	Config.SpawnCollisionHandling = NewConfig.SpawnCollisionHandling;
 	Config.bAutoDestroyOnTrackLost = NewConfig.bAutoDestroyOnTrackLost;
 
-	UE_LOG(LogAefPharus, Log, TEXT("Wall settings updated: TrackingSurfaceDimensions=%s, UseNormalizedCoords=%s"),
+	// Rebuild the compiled wall regions
+	RefreshTransforms(true);
+
+	UE_LOG(LogAefPharus, Log, TEXT("Wall settings updated: TrackingSurfaceDimensions=%s, UseNormalizedCoords=%s, WallRegions=%d"),
 		*Config.TrackingSurfaceDimensions.ToString(),
-		Config.bUseNormalizedCoordinates ? TEXT("true") : TEXT("false"));
+		Config.bUseNormalizedCoordinates ? TEXT("true") : TEXT("false"),
+		Config.WallRegions.Num());
 
 	return true;
 }
@@ -626,304 +1069,238 @@ bool UAefPharusInstance::RestartWithNewNetwork(const FString& NewBindNIC, int32
 		return false;
 	}
 
-	// Save important state before shutdown
-	TSubclassOf<AActor> SavedSpawnClass = SpawnClass;
-	UWorld* SavedWorldContext = WorldContext;
-	FAefPharusInstanceConfig SavedConfig = Config;
+	// Hot rebind: the new socket binds next to the old one (SO_REUSEADDR / SO_REUSEPORT) and the
+	// clients are swapped once it is bound. Actors, pool and track state stay; tracks are matched by ID in the new stream.
+	FAefPharusInstanceConfig NewConfig = Config;
+	NewConfig.BindNIC = NewBindNIC;
+	NewConfig.UDPPort = NewUDPPort;
 
-	// Update network settings in config
-	SavedConfig.BindNIC = NewBindNIC;
-	SavedConfig.UDPPort = NewUDPPort;
-
-	// Shutdown current connection (will destroy all actors)
-	Shutdown();
-
-	// Reinitialize with new network settings
-	bool bSuccess = Initialize(SavedConfig, SavedWorldContext, SavedSpawnClass);
-
-	if (bSuccess)
+	TUniquePtr<FPendingRebind> NewRebind = MakeUnique<FPendingRebind>();
+	try
 	{
-		UE_LOG(LogAefPharus, Log, TEXT("Instance '%s' restarted: %s:%d"),
-			*Config.InstanceName.ToString(), *NewBindNIC, NewUDPPort);
+		NewRebind->Client = CreateTrackLinkClient(NewConfig, NewRebind->BindNICStorage, NewRebind->MulticastGroupStorage);
 	}
-	else
+	catch (const std::exception& e)
 	{
-		UE_LOG(LogAefPharus, Error, TEXT("Failed to restart instance '%s' with %s:%d"),
-			*SavedConfig.InstanceName.ToString(), *NewBindNIC, NewUDPPort);
+		UE_LOG(LogAefPharus, Error, TEXT("Failed to restart instance '%s' with %s:%d: %hs - keeping %s:%d"),
+			*Config.InstanceName.ToString(), *NewBindNIC, NewUDPPort, e.what(), *Config.BindNIC, Config.UDPPort);
+		return false;
 	}
 
-	return bSuccess;
-}
+	if (PendingRebind)
+	{
+		UE_LOG(LogAefPharus, Log, TEXT("Instance '%s': switch to %s:%d replaced by %s:%d before it was bound"),
+			*Config.InstanceName.ToString(), *PendingRebind->BindNIC, PendingRebind->UDPPort, *NewBindNIC, NewUDPPort);
+	}
 
-//--------------------------------------------------------------------------------
-// Coordinate Transformation (Network Thread)
-//--------------------------------------------------------------------------------
+	// Binding takes about a millisecond; ProcessPendingOperations swaps the clients once it is done
+	NewRebind->BindNIC = NewBindNIC;
+	NewRebind->UDPPort = NewUDPPort;
+	NewRebind->Deadline = FPlatformTime::Seconds() + HotRebindBindTimeout;
+	PendingRebind = MoveTemp(NewRebind);
+
+	UE_LOG(LogAefPharus, Log, TEXT("Instance '%s' switching to %s:%d"),
+		*Config.InstanceName.ToString(), *NewBindNIC, NewUDPPort);
 
-FVector UAefPharusInstance::TrackToWorld(const FVector2D& TrackPos, const pharus::TrackRecord& Track) const
+	return true;
+}
+
+void UAefPharusInstance::UpdatePendingRebind()
 {
-	switch (Config.MappingMode)
+	if (!PendingRebind->Client->getStatistics().socketBound)
 	{
-		case EAefPharusMappingMode::Simple:
-			return TrackToWorldFloor(TrackPos);
-
-		case EAefPharusMappingMode::Regions:
+		// A NIC or port that cannot be bound keeps the working connection
+		if (FPlatformTime::Seconds() >= PendingRebind->Deadline)
 		{
-			EAefPharusWallSide Wall;
-			return TrackToWorldRegions(TrackPos, Wall);
+			UE_LOG(LogAefPharus, Error, TEXT("Failed to restart instance '%s': cannot bind %s:%d within %.1f s - keeping %s:%d"),
+				*Config.InstanceName.ToString(), *PendingRebind->BindNIC, PendingRebind->UDPPort, HotRebindBindTimeout, *Config.BindNIC, Config.UDPPort);
+			PendingRebind.Reset();
 		}
-
-		default:
-			UE_LOG(LogAefPharus, Warning, TEXT("Unknown mapping mode, falling back to Floor"));
-			return TrackToWorldFloor(TrackPos);
+		return;
 	}
+
+	CompleteRebind();
 }
 
-FVector UAefPharusInstance::TrackToWorldFloor(const FVector2D& TrackPos) const
+void UAefPharusInstance::CompleteRebind()
 {
-	// Step 1: Handle coordinate normalization based on explicit flag
-	FVector2D AdjustedPos = TrackPos;
+	const TUniquePtr<FPendingRebind> Rebind = MoveTemp(PendingRebind);
 
-	if (Config.bUseNormalizedCoordinates)
+	// The old receive thread is gone before the new client may produce events (single producer)
+	if (TrackLinkClient)
 	{
-		// Input is already normalized (0-1 range)
-		UE_LOG(LogAefPharus, Verbose, TEXT("[%s] Using normalized floor coordinates (%.3f, %.3f)"),
-			*Config.InstanceName.ToString(), TrackPos.X, TrackPos.Y);
+		TrackLinkClient->unregisterTrackReceiver(this);
+		TrackLinkClient.Reset();
 	}
-	else
-	{
-		// Input is absolute world coordinates - normalize them
-		AdjustedPos.X = TrackPos.X / Config.TrackingSurfaceDimensions.X;
-		AdjustedPos.Y = TrackPos.Y / Config.TrackingSurfaceDimensions.Y;
+	TrackLinkClient = MoveTemp(Rebind->Client);
+	BindNICStorage = MoveTemp(Rebind->BindNICStorage);
+	MulticastGroupStorage = MoveTemp(Rebind->MulticastGroupStorage);
+	Config.BindNIC = Rebind->BindNIC;
+	Config.UDPPort = Rebind->UDPPort;
 
-		UE_LOG(LogAefPharus, Verbose, TEXT("[%s] Normalized floor coordinates (%.3f, %.3f) → (%.3f, %.3f)"),
-			*Config.InstanceName.ToString(), TrackPos.X, TrackPos.Y, AdjustedPos.X, AdjustedPos.Y);
+	if (Config.bUseFrameSnapshots)
+	{
+		// The next snapshot of the new client is diffed against the current tracks
+		SnapshotDiff.rebase();
 	}
-
-	// Step 2: Invert Y if needed
-	// For normalized coordinates (0-1, TUIO-style with origin top-left):
-	//   Use 1.0-Y to flip within the 0-1 range
-	// For absolute coordinates (meters):
-	//   Use -Y to mirror around Y=0
-	if (Config.bInvertY)
+	else if (TrackEventQueue)
 	{
-		if (Config.bUseNormalizedCoordinates)
+		// Apply what the old stream still had queued, then wait for one complete frame of the new one
+		FAefPharusTrackEvent Event;
+		while (TrackEventQueue->Dequeue(Event))
 		{
-			AdjustedPos.Y = 1.0f - AdjustedPos.Y;  // Flip within 0-1 range
+			StageTrackEvent(Event);
 		}
-		else
-		{
-			AdjustedPos.Y = -AdjustedPos.Y;  // Mirror around Y=0
-		}
-	}
-
-	// Step 3: Apply scale
-	FVector2D ScaledPos = AdjustedPos * Config.SimpleScale;
-
-	// Step 4: Apply floor-specific 2D rotation (convert degrees to radians)
-	if (!FMath::IsNearlyZero(Config.FloorRotation))
-	{
-		float RotationRad = FMath::DegreesToRadians(Config.FloorRotation);
-		float CosRot = FMath::Cos(RotationRad);
-		float SinRot = FMath::Sin(RotationRad);
-
-		// Rotate 2D point around origin
-		FVector2D RotatedPos;
-		RotatedPos.X = ScaledPos.X * CosRot - ScaledPos.Y * SinRot;
-		RotatedPos.Y = ScaledPos.X * SinRot + ScaledPos.Y * CosRot;
-		ScaledPos = RotatedPos;
+		MapStagedTracks();
+		RebindUnconfirmedTracks.Reset();
+		TrackDataCache.GetKeys(RebindUnconfirmedTracks);
+		RebindReconcileFrame = TrackLinkClient->getStatistics().frames + 2;
+		TrackLinkClient->registerTrackReceiver(this);
 	}
 
-	// Step 5: Get global root origin and rotation from subsystem
-	FVector RootOrigin = GetRootOrigin();
-	FRotator RootRotation = GetRootOriginRotation();
-
-	// Step 6: Build local position (relative to root origin, before global rotation)
-	// FloorZ is a height offset relative to the local coordinate system
-	FVector LocalPos(ScaledPos.X, ScaledPos.Y, Config.FloorZ);
-
-	// Step 7: Apply global root rotation to transform local position
-	// This rotates the entire tracking coordinate system around the root origin
-	// Full 3D rotation is applied to support tilted stages and complex setups
-	FVector RotatedPos = RootRotation.RotateVector(LocalPos);
+	// Counters start over with the new client
+	LastNetworkCounters = pharus::TrackLinkStatistics();
+	LastNetworkSampleTime = FPlatformTime::Seconds();
+	LastReportedKernelDrops = 0;
 
-	// Step 8: Add root origin to get final world position
-	FVector WorldPos = RootOrigin + RotatedPos;
-
-	UE_LOG(LogAefPharus, Verbose, TEXT("[%s] TrackToWorldFloor: Local=%s, RootRotation=%s, Rotated=%s, Final=%s"),
-		*Config.InstanceName.ToString(), *LocalPos.ToString(), *RootRotation.ToString(), 
-		*RotatedPos.ToString(), *WorldPos.ToString());
-
-	return WorldPos;
+	UE_LOG(LogAefPharus, Log, TEXT("Instance '%s' switched to %s:%d (%d tracks kept)"),
+		*Config.InstanceName.ToString(), *Config.BindNIC, Config.UDPPort, TrackDataCache.Num());
 }
 
-FVector UAefPharusInstance::GetRootOrigin() const
+void UAefPharusInstance::ReconcileAfterRebind()
 {
-	// Get the owning subsystem (this UObject is owned by the subsystem)
-	UAefPharusSubsystem* Subsystem = Cast<UAefPharusSubsystem>(GetOuter());
-	if (Subsystem)
+	// Tracks that left while the clients were swapped: the new stream never reported them
+	const TSet<int32> Missing = MoveTemp(RebindUnconfirmedTracks);
+	RebindUnconfirmedTracks.Reset();
+	int32 Removed = 0;
+	for (const int32 TrackID : Missing)
 	{
-		return Subsystem->GetRootOrigin();
+		if (TrackDataCache.Contains(TrackID))
+		{
+			pharus::TrackRecord LostTrack;
+			LostTrack.trackID = (unsigned int)TrackID;
+			StageTrackEvent(MakeTrackEvent(FAefPharusTrackEvent::EKind::Lost, LostTrack));
+			++Removed;
+		}
 	}
 
-	// Fallback (should never happen in normal operation)
-	UE_LOG(LogAefPharus, Warning, TEXT("[%s] GetRootOrigin: No owning subsystem found - using zero origin"),
-		*Config.InstanceName.ToString());
-	return FVector::ZeroVector;
+	if (Removed > 0)
+	{
+		UE_LOG(LogAefPharus, Log, TEXT("[%s] %d track(s) not in the new stream after the network switch - removed"),
+			*Config.InstanceName.ToString(), Removed);
+	}
 }
 
-FRotator UAefPharusInstance::GetRootOriginRotation() const
+//--------------------------------------------------------------------------------
+// Coordinate Transformation (Game Thread, mapping stage)
+//--------------------------------------------------------------------------------
+
+FVector UAefPharusInstance::TrackToWorld(const FVector2D& InputPos, const FVector2D& NormalizedPos, int32 RegionIndex) const
 {
-	// Get the owning subsystem (this UObject is owned by the subsystem)
-	UAefPharusSubsystem* Subsystem = Cast<UAefPharusSubsystem>(GetOuter());
-	if (Subsystem)
+	switch (Config.MappingMode)
 	{
-		return Subsystem->GetRootOriginRotation();
-	}
+		case EAefPharusMappingMode::Simple:
+			return TrackToWorldFloor(InputPos);
 
-	// Fallback (should never happen in normal operation)
-	UE_LOG(LogAefPharus, Warning, TEXT("[%s] GetRootOriginRotation: No owning subsystem found - using zero rotation"),
-		*Config.InstanceName.ToString());
-	return FRotator::ZeroRotator;
+		case EAefPharusMappingMode::Regions:
+			return TrackToWorldRegions(NormalizedPos, RegionIndex);
+
+		default:
+			UE_LOG(LogAefPharus, Warning, TEXT("Unknown mapping mode, falling back to Floor"));
+			return TrackToWorldFloor(InputPos);
+	}
 }
 
-FVector UAefPharusInstance::TrackToWorldRegions(const FVector2D& TrackPos, EAefPharusWallSide& OutWall) const
+FVector UAefPharusInstance::TrackToWorldFloor(const FVector2D& InputPos) const
 {
-	// Handle coordinate normalization based on explicit flag
-	FVector2D NormalizedPos = TrackPos;
+	// Normalization, InvertY, scale, FloorRotation, FloorZ and the root origin in one affine map,
+	// compiled by RefreshTransforms() whenever one of them changes
+	return Transforms.Floor.ToWorld.TransformPosition(InputPos);
+}
 
-	if (Config.bUseNormalizedCoordinates)
+void UAefPharusInstance::RefreshTransforms(bool bForce)
+{
+	// Root origin as the subsystem published it for this frame
+	const FAefPharusRootTransform Root = RootTransformSource ? RootTransformSource->Read() : FAefPharusRootTransform();
+	if (!bForce && Root.Generation == RootTransform.Generation)
 	{
-		// Input is already normalized (0-1 range)
-		UE_LOG(LogAefPharus, Verbose, TEXT("[%s] Using normalized coordinates (%.3f, %.3f)"),
-			*Config.InstanceName.ToString(), TrackPos.X, TrackPos.Y);
+		return;
 	}
-	else
-	{
-		// Input is absolute world coordinates - normalize them
-		NormalizedPos.X = TrackPos.X / Config.TrackingSurfaceDimensions.X;
-		NormalizedPos.Y = TrackPos.Y / Config.TrackingSurfaceDimensions.Y;
+	RootTransform = Root;
 
-		UE_LOG(LogAefPharus, Verbose, TEXT("[%s] Normalized absolute coordinates (%.3f, %.3f) → (%.3f, %.3f)"),
-			*Config.InstanceName.ToString(), TrackPos.X, TrackPos.Y, NormalizedPos.X, NormalizedPos.Y);
+	if (bForce && Config.WallRegions.Num() > FAefPharusMappingTransforms::MaxWallRegions)
+	{
+		UE_LOG(LogAefPharus, Warning, TEXT("[%s] %d wall regions, only the first %d are precompiled - the others are slower to map"),
+			*Config.InstanceName.ToString(), Config.WallRegions.Num(), FAefPharusMappingTransforms::MaxWallRegions);
 	}
 
-	// Find matching wall region
-	// NOTE: IsTrackPositionValid() should have already rejected invalid positions,
-	//       so this should always find a region. This is a safety fallback.
-	const FAefPharusWallRegion* Region = FindWallRegion(NormalizedPos);
-	if (!Region)
+	Transforms = FAefPharusMappingTransforms::Compile(Config, RootTransform.Origin, RootTransform.Rotation);
+
+	UE_LOG(LogAefPharus, Verbose, TEXT("[%s] Transforms compiled: Floor Origin=%s, AxisX=%s, AxisY=%s, %d wall regions (RootOrigin=%s, RootRotation=%s)"),
+		*Config.InstanceName.ToString(), *Transforms.Floor.ToWorld.Origin.ToString(), *Transforms.Floor.ToWorld.AxisX.ToString(),
+		*Transforms.Floor.ToWorld.AxisY.ToString(), Transforms.NumWalls, *RootTransform.Origin.ToString(), *RootTransform.Rotation.ToString());
+}
+
+FVector UAefPharusInstance::TrackToWorldRegions(const FVector2D& NormalizedPos, int32 RegionIndex) const
+{
+	// NOTE: The mapping stage only maps positions it found a region for (bounds check),
+	//       so this should always be valid. This is a safety fallback.
+	if (!Config.WallRegions.IsValidIndex(RegionIndex))
 	{
-		// This should never happen if IsTrackPositionValid() was called first
 		UE_LOG(LogAefPharus, Error, TEXT("[%s] Track position (%.3f, %.3f) outside all wall regions - this should have been rejected earlier!"),
-			*Config.InstanceName.ToString(), TrackPos.X, TrackPos.Y);
-		OutWall = EAefPharusWallSide::Floor;
+			*Config.InstanceName.ToString(), NormalizedPos.X, NormalizedPos.Y);
 		return FVector::ZeroVector;
 	}
 
-	OutWall = Region->WallSide;
+	const FAefPharusWallRegion* Region = &Config.WallRegions[RegionIndex];
 
 	if (Config.bLogRegionAssignment)
 	{
 		UE_LOG(LogAefPharus, Log, TEXT("[%s] Track assigned to %s wall (NormalizedPos: %.3f, %.3f)"),
 			*Config.InstanceName.ToString(),
-			*UEnum::GetValueAsString(OutWall),
+			*UEnum::GetValueAsString(Region->WallSide),
 			NormalizedPos.X, NormalizedPos.Y);
 	}
 
-	// Use region's transformation method with normalized coordinates, global root origin, rotation, and WallRotation
-	FVector RootOrigin = GetRootOrigin();
-	FRotator RootRotation = GetRootOriginRotation();
-	return Region->TrackToWorld(NormalizedPos, RootOrigin, RootRotation, Config.WallRotation);
+	// Region compiled by RefreshTransforms() (bounds, InvertY, Scale, WallRotation, Origin, wall placement, root origin)
+	const FAefPharusWallTransform* Wall = Transforms.FindWall(RegionIndex);
+	return Wall ? Wall->ToWorld.TransformPosition(NormalizedPos)
+		: Region->TrackToWorld(NormalizedPos, Transforms.RootOrigin, Transforms.RootRotation, Config.WallRotation);
 }
 
-const FAefPharusWallRegion* UAefPharusInstance::FindWallRegion(const FVector2D& TrackPos) const
+int32 UAefPharusInstance::FindWallRegionIndex(const FVector2D& TrackPos) const
 {
-	// Debug: Log number of wall regions
-	UE_LOG(LogAefPharus, Verbose, TEXT("[%s] Checking %d wall regions for position (%.3f, %.3f)"),
-		*Config.InstanceName.ToString(), Config.WallRegions.Num(), TrackPos.X, TrackPos.Y);
-
-	// Check all regions and collect matches (due to overlapping regions)
-	TArray<const FAefPharusWallRegion*> MatchingRegions;
-
-	for (int32 i = 0; i < Config.WallRegions.Num(); ++i)
-	{
-		const FAefPharusWallRegion& Region = Config.WallRegions[i];
-		bool bContains = Region.ContainsTrackPoint(TrackPos);
-
-		UE_LOG(LogAefPharus, Verbose, TEXT("  Region %d (%s): Bounds=(%.3f-%.3f, %.3f-%.3f) Contains=%s"),
-			i, *UEnum::GetValueAsString(Region.WallSide),
-			Region.TrackingBounds.Min.X, Region.TrackingBounds.Max.X,
-			Region.TrackingBounds.Min.Y, Region.TrackingBounds.Max.Y,
-			bContains ? TEXT("YES") : TEXT("NO"));
-
-		if (bContains)
-		{
-			MatchingRegions.Add(&Region);
-		}
-	}
-
-	// If no regions match, return null
-	if (MatchingRegions.Num() == 0)
-	{
-		return nullptr;
-	}
-
-	// If only one region matches, return it
-	if (MatchingRegions.Num() == 1)
-	{
-		return MatchingRegions[0];
-	}
-
-	// Multiple regions match (corner case) - use priority logic
-	// Priority: Front > Right > Back > Left (clockwise priority)
-	for (const FAefPharusWallRegion* Region : MatchingRegions)
-	{
-		if (Region->WallSide == EAefPharusWallSide::Front)
-			return Region;
-	}
-
-	for (const FAefPharusWallRegion* Region : MatchingRegions)
-	{
-		if (Region->WallSide == EAefPharusWallSide::Right)
-			return Region;
-	}
-
-	for (const FAefPharusWallRegion* Region : MatchingRegions)
+	if (Config.WallRegions.Num() > FAefPharusMappingTransforms::MaxWallRegions)
 	{
-		if (Region->WallSide == EAefPharusWallSide::Back)
-			return Region;
+		// Not all regions are in the compiled lookup
+		return FAefPharusWallRegionLookup::FindLinear(Config.WallRegions, TrackPos);
 	}
 
-	for (const FAefPharusWallRegion* Region : MatchingRegions)
-	{
-		if (Region->WallSide == EAefPharusWallSide::Left)
-			return Region;
-	}
+	return Transforms.RegionLookup.Find(TrackPos);
+}
 
-	// Fallback to first match
-	return MatchingRegions[0];
+const FAefPharusWallRegion* UAefPharusInstance::GetAssignedWallRegion(const FAefPharusTrackData& TrackData) const
+{
+	return Config.WallRegions.IsValidIndex(TrackData.AssignedRegionIndex) ? &Config.WallRegions[TrackData.AssignedRegionIndex] : nullptr;
 }
 
 //--------------------------------------------------------------------------------
 // Local Coordinate Transformation (for Relative Spawning)
 //--------------------------------------------------------------------------------
 
-FVector UAefPharusInstance::TrackToLocal(const FVector2D& TrackPos, const pharus::TrackRecord& Track) const
+FVector UAefPharusInstance::TrackToLocal(const FAefPharusTrackData& TrackData) const
 {
 	switch (Config.MappingMode)
 	{
 		case EAefPharusMappingMode::Simple:
-			return TrackToLocalFloor(TrackPos);
+			return TrackToLocalFloor(TrackData.RawPosition);
 
 		case EAefPharusMappingMode::Regions:
-		{
-			EAefPharusWallSide Wall;
-			return TrackToLocalRegions(TrackPos, Wall);
-		}
+			return TrackToLocalRegions(TrackData);
 
 		default:
 			UE_LOG(LogAefPharus, Warning, TEXT("Unknown mapping mode, falling back to Floor"));
-			return TrackToLocalFloor(TrackPos);
+			return TrackToLocalFloor(TrackData.RawPosition);
 	}
 }
 
@@ -931,64 +1308,28 @@ FVector UAefPharusInstance::TrackToLocalFloor(const FVector2D& TrackPos) const
 {
 	// NOTE: TrackPos (from RawPosition) is ALWAYS normalized (0-1 range)
 	// The normalization was already done when storing RawPosition in ConvertTrackData()
-	// So we do NOT apply TrackingSurfaceDimensions normalization here!
-	
-	FVector2D AdjustedPos = TrackPos;
-
-	// Step 1: Invert Y if needed
-	// RawPosition is ALWAYS normalized (0-1), so use 1.0-Y for correct flip
-	if (Config.bInvertY)
-	{
-		AdjustedPos.Y = 1.0f - AdjustedPos.Y;  // Flip within 0-1 range (TUIO origin top-left)
-	}
-
-	// Step 2: Apply scale (converts normalized 0-1 to actual world size in cm)
-	FVector2D ScaledPos = AdjustedPos * Config.SimpleScale;
-
-	// Step 3: Apply floor-specific 2D rotation (convert degrees to radians)
-	if (!FMath::IsNearlyZero(Config.FloorRotation))
-	{
-		float RotationRad = FMath::DegreesToRadians(Config.FloorRotation);
-		float CosRot = FMath::Cos(RotationRad);
-		float SinRot = FMath::Sin(RotationRad);
-
-		// Rotate 2D point around origin
-		FVector2D RotatedPos;
-		RotatedPos.X = ScaledPos.X * CosRot - ScaledPos.Y * SinRot;
-		RotatedPos.Y = ScaledPos.X * SinRot + ScaledPos.Y * CosRot;
-		ScaledPos = RotatedPos;
-	}
-
-	// Step 4: Build LOCAL position (relative to RootOriginActor)
-	// NO RootOrigin/RootRotation applied - actor is attached as child
-	FVector LocalPos(ScaledPos.X, ScaledPos.Y, Config.FloorZ);
-
-	UE_LOG(LogAefPharus, Verbose, TEXT("[%s] TrackToLocalFloor: Input=%s, LocalPos=%s"),
-		*Config.InstanceName.ToString(), *TrackPos.ToString(), *LocalPos.ToString());
-
-	return LocalPos;
+	// ToLocal leaves out TrackingSurfaceDimensions and RootOrigin/RootRotation (actor is attached as child)
+	return Transforms.Floor.ToLocal.TransformPosition(TrackPos);
 }
 
-FVector UAefPharusInstance::TrackToLocalRegions(const FVector2D& TrackPos, EAefPharusWallSide& OutWall) const
+FVector UAefPharusInstance::TrackToLocalRegions(const FAefPharusTrackData& TrackData) const
 {
-	// NOTE: TrackPos (from RawPosition) is ALWAYS normalized (0-1 range)
+	// NOTE: RawPosition is ALWAYS normalized (0-1 range)
 	// The normalization was already done when storing RawPosition in ConvertTrackData()
-	// So we use TrackPos directly for region lookup and transformation
+	const FVector2D& TrackPos = TrackData.RawPosition;
 
-	// Find matching wall region
-	const FAefPharusWallRegion* Region = FindWallRegion(TrackPos);
+	// Region assigned by ConvertTrackData (the one that passed the bounds check and gave the world position)
+	const FAefPharusWallRegion* Region = GetAssignedWallRegion(TrackData);
 	if (!Region)
 	{
 		UE_LOG(LogAefPharus, Error, TEXT("[%s] Track position (%.3f, %.3f) outside all wall regions!"),
 			*Config.InstanceName.ToString(), TrackPos.X, TrackPos.Y);
-		OutWall = EAefPharusWallSide::Floor;
 		return FVector::ZeroVector;
 	}
 
-	OutWall = Region->WallSide;
-
-	// Use region's local transformation method (no RootOrigin/RootRotation)
-	return Region->TrackToLocal(TrackPos);
+	// Region compiled by RefreshTransforms(), without RootOrigin/RootRotation
+	const FAefPharusWallTransform* Wall = Transforms.FindWall(TrackData.AssignedRegionIndex);
+	return Wall ? Wall->ToLocal.TransformPosition(TrackPos) : Region->TrackToLocal(TrackPos, Config.WallRotation);
 }
 
 //--------------------------------------------------------------------------------
@@ -1025,7 +1366,7 @@ bool UAefPharusInstance::IsTrackPositionValid(const FVector2D& InputPos) const
 	// For Regions mode: Check if position falls within any defined wall region
 	if (Config.MappingMode == EAefPharusMappingMode::Regions)
 	{
-		return FindWallRegion(NormalizedPos) != nullptr;
+		return FindWallRegionIndex(NormalizedPos) != INDEX_NONE;
 	}
 
 	// Simple mode: Allow all normalized positions
@@ -1083,16 +1424,12 @@ void UAefPharusInstance::SpawnActorForTrack(int32 TrackID, const pharus::TrackRe
 		}
 	}
 
-	FAefPharusTrackData TrackDataCopy;
+	const FAefPharusTrackData* TrackData = TrackDataCache.Find(TrackID);
+	if (!TrackData)
 	{
-		FScopeLock Lock(&PendingOperationsMutex);
-		FAefPharusTrackData* TrackData = TrackDataCache.Find(TrackID);
-		if (!TrackData)
-		{
-			return;
-		}
-		TrackDataCopy = *TrackData;
+		return;
 	}
+	const FAefPharusTrackData TrackDataCopy = *TrackData;
 
 	AActor* SpawnedActor = nullptr;
 	int32 PoolIndex = INDEX_NONE;
@@ -1206,18 +1543,18 @@ void UAefPharusInstance::SpawnActorForTrack(int32 TrackID, const pharus::TrackRe
 	//--------------------------------------------------------------------------------
 	if (SpawnedActor)
 	{
-		// Get the owning subsystem to check for relative spawning mode
+		// Relative spawning mode from the root transform snapshot
 		// UseRelativeSpawning in [PharusSubsystem] is the master switch
 		// Per-instance bUseRelativeSpawning=false can override to disable for specific instances
-		UAefPharusSubsystem* Subsystem = Cast<UAefPharusSubsystem>(GetOuter());
-		const bool bUseRelativeSpawning = Subsystem && Subsystem->IsRelativeSpawningActive();
+		const bool bUseRelativeSpawning = RootTransform.bRelativeSpawning;
 
 		if (bUseRelativeSpawning)
 		{
 			//--------------------------------------------------------------------------------
 			// RELATIVE SPAWNING MODE: Attach to RootOriginActor, use local coordinates
 			//--------------------------------------------------------------------------------
-			AAefPharusRootOriginActor* RootActor = Subsystem->GetRootOriginActor();
+			UAefPharusSubsystem* Subsystem = Cast<UAefPharusSubsystem>(GetOuter());
+			AAefPharusRootOriginActor* RootActor = Subsystem ? Subsystem->GetRootOriginActor() : nullptr;
 			if (RootActor)
 			{
 				// Calculate LOCAL position (no RootOrigin/RootRotation applied)
@@ -1226,13 +1563,11 @@ void UAefPharusInstance::SpawnActorForTrack(int32 TrackID, const pharus::TrackRe
 				// Get input position from cache (use original tracking coordinates)
 				FVector LocalPos;
 				{
-					FScopeLock Lock(&PendingOperationsMutex);
 					FAefPharusTrackData* CachedData = TrackDataCache.Find(TrackID);
 					if (CachedData)
 					{
 						// Recalculate LOCAL position from raw coordinates
-						pharus::TrackRecord DummyTrack;
-						LocalPos = TrackToLocal(CachedData->RawPosition, DummyTrack);
+						LocalPos = TrackToLocal(*CachedData);
 					}
 					else
 					{
@@ -1257,7 +1592,7 @@ void UAefPharusInstance::SpawnActorForTrack(int32 TrackID, const pharus::TrackRe
 					if (Config.MappingMode == EAefPharusMappingMode::Regions)
 					{
 						// Wall mode: Rotate around wall normal
-						const FAefPharusWallRegion* Region = FindWallRegion(TrackDataCopy.RawPosition);
+						const FAefPharusWallRegion* Region = GetAssignedWallRegion(TrackDataCopy);
 						if (Region)
 						{
 							OrientationRotation = GetWallActorRotation(TrackDataCopy.Orientation, *Region);
@@ -1279,7 +1614,7 @@ void UAefPharusInstance::SpawnActorForTrack(int32 TrackID, const pharus::TrackRe
 					// No orientation - use wall's base rotation for walls, zero for floor
 					if (Config.MappingMode == EAefPharusMappingMode::Regions)
 					{
-						const FAefPharusWallRegion* Region = FindWallRegion(TrackDataCopy.RawPosition);
+						const FAefPharusWallRegion* Region = GetAssignedWallRegion(TrackDataCopy);
 						SpawnedActor->SetActorRelativeRotation(Region ? Region->WorldRotation : FRotator::ZeroRotator);
 					}
 					else
@@ -1305,7 +1640,7 @@ void UAefPharusInstance::SpawnActorForTrack(int32 TrackID, const pharus::TrackRe
 			// Get global root rotation
 			// Actors are oriented RELATIVE TO the RootOriginActor (like being attached to a camera)
 			// Full 3D rotation ensures actors stay correctly aligned when the origin moves/rotates
-			FRotator RootRotation = GetRootOriginRotation();
+			const FRotator RootRotation = RootTransform.Rotation;
 			
 			if (Config.bApplyOrientationFromMovement)
 			{
@@ -1313,7 +1648,7 @@ void UAefPharusInstance::SpawnActorForTrack(int32 TrackID, const pharus::TrackRe
 				if (Config.MappingMode == EAefPharusMappingMode::Regions)
 				{
 					// Wall mode: Rotate around wall normal
-					const FAefPharusWallRegion* Region = FindWallRegion(TrackDataCopy.RawPosition);
+					const FAefPharusWallRegion* Region = GetAssignedWallRegion(TrackDataCopy);
 					if (Region)
 					{
 						OrientationRotation = GetWallActorRotation(TrackDataCopy.Orientation, *Region);
@@ -1337,7 +1672,7 @@ void UAefPharusInstance::SpawnActorForTrack(int32 TrackID, const pharus::TrackRe
 				// No orientation - use wall's base rotation for walls, root rotation for floor
 				if (Config.MappingMode == EAefPharusMappingMode::Regions)
 				{
-					const FAefPharusWallRegion* Region = FindWallRegion(TrackDataCopy.RawPosition);
+					const FAefPharusWallRegion* Region = GetAssignedWallRegion(TrackDataCopy);
 					FRotator WallBaseRotation = Region ? Region->WorldRotation : FRotator::ZeroRotator;
 					SpawnedActor->SetActorRotation(RootRotation + WallBaseRotation);
 				}
@@ -1382,21 +1717,16 @@ void UAefPharusInstance::UpdateActorForTrack(int32 TrackID, const pharus::TrackR
 		Actor = *ActorPtr;
 	}
 
-	FAefPharusTrackData TrackDataCopy;
+	const FAefPharusTrackData* TrackData = TrackDataCache.Find(TrackID);
+	if (!TrackData)
 	{
-		FScopeLock Lock(&PendingOperationsMutex);
-		FAefPharusTrackData* TrackData = TrackDataCache.Find(TrackID);
-		if (!TrackData)
-		{
-			return;
-		}
-		TrackDataCopy = *TrackData;
+		return;
 	}
+	const FAefPharusTrackData TrackDataCopy = *TrackData;
 
-	// Get the owning subsystem to check for relative spawning mode
+	// Relative spawning mode from the root transform snapshot
 	// UseRelativeSpawning in [PharusSubsystem] is the master switch
-	UAefPharusSubsystem* Subsystem = Cast<UAefPharusSubsystem>(GetOuter());
-	const bool bUseRelativeSpawning = Subsystem && Subsystem->IsRelativeSpawningActive();
+	const bool bUseRelativeSpawning = RootTransform.bRelativeSpawning;
 
 	if (bUseRelativeSpawning)
 	{
@@ -1404,8 +1734,7 @@ void UAefPharusInstance::UpdateActorForTrack(int32 TrackID, const pharus::TrackR
 		// RELATIVE SPAWNING MODE: Use local coordinates (actor is attached to RootOriginActor)
 		//--------------------------------------------------------------------------------
 		// Calculate LOCAL position from raw tracking coordinates
-		pharus::TrackRecord DummyTrack;
-		FVector LocalPos = TrackToLocal(TrackDataCopy.RawPosition, DummyTrack);
+		FVector LocalPos = TrackToLocal(TrackDataCopy);
 
 		// Update LOCAL position (relative to RootOriginActor)
 		Actor->SetActorRelativeLocation(LocalPos);
@@ -1417,7 +1746,7 @@ void UAefPharusInstance::UpdateActorForTrack(int32 TrackID, const pharus::TrackR
 			if (Config.MappingMode == EAefPharusMappingMode::Regions)
 			{
 				// Wall mode: Rotate around wall normal
-				const FAefPharusWallRegion* Region = FindWallRegion(TrackDataCopy.RawPosition);
+				const FAefPharusWallRegion* Region = GetAssignedWallRegion(TrackDataCopy);
 				if (Region)
 				{
 					OrientationRotation = GetWallActorRotation(TrackDataCopy.Orientation, *Region);
@@ -1452,7 +1781,7 @@ void UAefPharusInstance::UpdateActorForTrack(int32 TrackID, const pharus::TrackR
 
 		// Update rotation - actors are oriented RELATIVE TO the RootOriginActor
 		// Full 3D rotation ensures actors stay correctly aligned when the origin moves/rotates
-		FRotator RootRotation = GetRootOriginRotation();
+		const FRotator RootRotation = RootTransform.Rotation;
 		
 		if (Config.bApplyOrientationFromMovement && !TrackDataCopy.Orientation.IsNearlyZero())
 		{
@@ -1460,7 +1789,7 @@ void UAefPharusInstance::UpdateActorForTrack(int32 TrackID, const pharus::TrackR
 			if (Config.MappingMode == EAefPharusMappingMode::Regions)
 			{
 				// Wall mode: Rotate around wall normal
-				const FAefPharusWallRegion* Region = FindWallRegion(TrackDataCopy.RawPosition);
+				const FAefPharusWallRegion* Region = GetAssignedWallRegion(TrackDataCopy);
 				if (Region)
 				{
 					OrientationRotation = GetWallActorRotation(TrackDataCopy.Orientation, *Region);
@@ -1493,7 +1822,7 @@ void UAefPharusInstance::UpdateActorForTrack(int32 TrackID, const pharus::TrackR
 			FRotator BaseRotation = RootRotation;
 			if (Config.MappingMode == EAefPharusMappingMode::Regions)
 			{
-				const FAefPharusWallRegion* Region = FindWallRegion(TrackDataCopy.RawPosition);
+				const FAefPharusWallRegion* Region = GetAssignedWallRegion(TrackDataCopy);
 				if (Region)
 				{
 					BaseRotation = RootRotation + Region->WorldRotation;
@@ -1511,6 +1840,9 @@ void UAefPharusInstance::UpdateActorForTrack(int32 TrackID, const pharus::TrackR
 		}
 	}
 
+	// Transform is applied: the frame has reached the scene
+	RecordLatencySample(TrackDataCopy.ArrivalTimeNs);
+
 	// Broadcast update event
 	OnTrackUpdated.Broadcast(TrackID, TrackDataCopy);
 }
@@ -1602,14 +1934,11 @@ void UAefPharusInstance::DestroyActorForTrack(int32 TrackID, const FString& Reas
 		SpawnedActors.Remove(TrackID);
 	}
 
-	{
-		FScopeLock Lock(&PendingOperationsMutex);
-		TrackDataCache.Remove(TrackID);
-		// NOTE: Do NOT remove from TracksOutsideBounds here!
-		// If track left bounds, we want to keep tracking that state
-		// so we can re-spawn when it comes back.
-		// TracksOutsideBounds is only cleaned up in onTrackLost().
-	}
+	TrackDataCache.Remove(TrackID);
+	// NOTE: Do NOT remove from TracksOutsideBounds here!
+	// If track left bounds, we want to keep tracking that state
+	// so we can re-spawn when it comes back.
+	// TracksOutsideBounds is only cleaned up when the track is lost.
 
 	// Broadcast lost event
 	OnTrackLost.Broadcast(TrackID);
@@ -1626,35 +1955,91 @@ bool UAefPharusInstance::ProcessPendingOperations(float DeltaTime)
 		return true; // Keep ticking
 	}
 
-	TArray<int32> LocalSpawns, LocalUpdates, LocalRemovals;
-	TMap<int32, pharus::TrackRecord> LocalTrackData;
+	// Network switch: swap in the new client once its socket is bound (never waited for)
+	if (PendingRebind)
+	{
+		UpdatePendingRebind();
+	}
+
+	// Root transform snapshot is read once per tick; the mappings are recompiled only when it changed
+	RefreshTransforms(false);
+
+	if (Config.bUseFrameSnapshots)
+	{
+		// One coherent tracker frame per tick
+		ApplyFrameSnapshot();
+		MapStagedTracks();
+	}
+	else if (TrackEventQueue)
+	{
+		// Drain events from the network thread without blocking it.
+		// Bounded by the capacity so a fast producer cannot keep us here forever.
+		// Frames are counted after their events are queued: read before draining
+		const bool bReconcile = RebindUnconfirmedTracks.Num() > 0 && TrackLinkClient
+			&& TrackLinkClient->getStatistics().frames >= RebindReconcileFrame;
+
+		FAefPharusTrackEvent Event;
+		bool bQueueDrained = false;
+		for (int32 Drained = 0; Drained < TrackEventQueueCapacity; ++Drained)
+		{
+			if (!TrackEventQueue->Dequeue(Event))
+			{
+				bQueueDrained = true;
+				break;
+			}
+			StageTrackEvent(Event);
+		}
+
+		// Map only the latest state of each track, once per tick
+		MapStagedTracks();
+
+		// After a network switch, once a complete frame of the new stream is applied
+		if (bReconcile && bQueueDrained)
+		{
+			ReconcileAfterRebind();
+		}
+	}
 
-	// Copy pending operations under lock
+	const int32 Overflows = TrackEventOverflows.load(std::memory_order_relaxed);
+	if (Overflows != LastReportedOverflows)
 	{
-		FScopeLock Lock(&PendingOperationsMutex);
-		LocalSpawns = PendingSpawns;
-		LocalUpdates = PendingUpdates;
-		LocalRemovals = PendingRemovals;
+		UE_LOG(LogAefPharus, Warning, TEXT("[%s] Track event queue full - dropped %d event(s) (capacity %d, consider raising TrackEventQueueSize)"),
+			*Config.InstanceName.ToString(), Overflows - LastReportedOverflows, TrackEventQueueCapacity);
+		LastReportedOverflows = Overflows;
+	}
 
-		// Clear pending arrays
-		PendingSpawns.Empty();
-		PendingUpdates.Empty();
-		PendingRemovals.Empty();
+	// Network statistics: rates over the configured interval
+	const double Now = FPlatformTime::Seconds();
+	if (TrackLinkClient && Now - LastNetworkSampleTime >= FMath::Max(0.5f, Config.NetworkStatsInterval))
+	{
+		SampleNetworkStats(Now);
+	}
+
+	// Datagrams lost before we ever saw them: the socket receive buffer overflowed
+	if (TrackLinkClient)
+	{
+		const uint64 KernelDrops = TrackLinkClient->getStatistics().kernelDrops;
+		if (KernelDrops > LastReportedKernelDrops)
+		{
+			UE_LOG(LogAefPharus, Warning, TEXT("[%s] Socket receive buffer full - kernel dropped %llu datagram(s) (consider raising ReceiveBufferSize)"),
+				*Config.InstanceName.ToString(), KernelDrops - LastReportedKernelDrops);
+			LastReportedKernelDrops = KernelDrops;
+		}
 	}
 
 	// Process removals FIRST to avoid conflicts with spawns
 	// (e.g., track leaves and re-enters bounds in same frame)
-	for (int32 TrackID : LocalRemovals)
+	for (int32 TrackID : PendingRemovals)
 	{
 		// Skip if track is also in spawns (re-entered bounds)
-		if (!LocalSpawns.Contains(TrackID))
+		if (!PendingSpawns.Contains(TrackID))
 		{
 			DestroyActorForTrack(TrackID, TEXT("LeftBounds"));
 		}
 	}
 
 	// Process spawns
-	for (int32 TrackID : LocalSpawns)
+	for (int32 TrackID : PendingSpawns)
 	{
 		FAefPharusTrackData* TrackData = TrackDataCache.Find(TrackID);
 		if (TrackData)
@@ -1666,10 +2051,10 @@ bool UAefPharusInstance::ProcessPendingOperations(float DeltaTime)
 	}
 
 	// Process updates
-	for (int32 TrackID : LocalUpdates)
+	for (int32 TrackID : PendingUpdates)
 	{
 		// Skip if track was just spawned (already has latest data)
-		if (!LocalSpawns.Contains(TrackID))
+		if (!PendingSpawns.Contains(TrackID))
 		{
 			pharus::TrackRecord DummyTrack;
 			DummyTrack.trackID = TrackID;
@@ -1677,6 +2062,10 @@ bool UAefPharusInstance::ProcessPendingOperations(float DeltaTime)
 		}
 	}
 
+	PendingSpawns.Reset();
+	PendingUpdates.Reset();
+	PendingRemovals.Reset();
+
 	// Check for timed-out tracks (no UDP packets received)
 	// This detects when simulator stops sending (crash/close) vs. person standing still
 	if (Config.TrackLostTimeout > 0.0f)
@@ -1684,29 +2073,26 @@ bool UAefPharusInstance::ProcessPendingOperations(float DeltaTime)
 		double CurrentTime = FPlatformTime::Seconds();
 		TArray<int32> TimedOutTracks;
 
+		// Check all active tracks for timeout
+		for (const auto& Pair : TrackDataCache)
 		{
-			FScopeLock Lock(&PendingOperationsMutex);
-			// Check all active tracks for timeout
-			for (const auto& Pair : TrackDataCache)
+			double TimeSinceLastUpdate = CurrentTime - Pair.Value.LastUpdateTime;
+			if (TimeSinceLastUpdate > Config.TrackLostTimeout)
 			{
-				double TimeSinceLastUpdate = CurrentTime - Pair.Value.LastUpdateTime;
-				if (TimeSinceLastUpdate > Config.TrackLostTimeout)
-				{
-					TimedOutTracks.Add(Pair.Key);
+				TimedOutTracks.Add(Pair.Key);
 
-					if (Config.bLogTrackerRemoved)
-					{
-						UE_LOG(LogAefPharus, Warning, TEXT("[%s] Track %d timed out (no UDP updates for %.1fs) - treating as lost"),
-							*Config.InstanceName.ToString(), Pair.Key, TimeSinceLastUpdate);
-					}
+				if (Config.bLogTrackerRemoved)
+				{
+					UE_LOG(LogAefPharus, Warning, TEXT("[%s] Track %d timed out (no UDP updates for %.1fs) - treating as lost"),
+						*Config.InstanceName.ToString(), Pair.Key, TimeSinceLastUpdate);
 				}
 			}
-			
-			// Also clean up TracksOutsideBounds for timed-out tracks
-			for (int32 TrackID : TimedOutTracks)
-			{
-				TracksOutsideBounds.Remove(TrackID);
-			}
+		}
+
+		// Also clean up TracksOutsideBounds for timed-out tracks
+		for (int32 TrackID : TimedOutTracks)
+		{
+			TracksOutsideBounds.Remove(TrackID);
 		}
 
 		// Process timed-out tracks as if they were lost
@@ -1723,61 +2109,36 @@ bool UAefPharusInstance::ProcessPendingOperations(float DeltaTime)
 // Helper Functions
 //--------------------------------------------------------------------------------
 
-FAefPharusTrackData UAefPharusInstance::ConvertTrackData(const pharus::TrackRecord& Track, const FVector& WorldPos, const FVector2D& InputPos) const
+FAefPharusTrackData UAefPharusInstance::ConvertTrackData(const FAefPharusTrackEvent& Event, const FVector2D& NormalizedPos, int32 RegionIndex) const
 {
 	FAefPharusTrackData Data;
-	Data.TrackID = Track.trackID;
-	Data.WorldPosition = WorldPos;
-	Data.Speed = Track.speed * 100.0f; // m/s → cm/s
+	Data.TrackID = Event.TrackID;
+	Data.WorldPosition = TrackToWorld(Event.InputPos, NormalizedPos, RegionIndex);
+	Data.Speed = Event.Speed * 100.0f; // m/s → cm/s
 
 	// Apply transformations to orientation for Simple mode
-	FVector2D TrackOrientation(Track.orientation.x, Track.orientation.y);
+	FVector2D TrackOrientation = Event.Orientation;
 	if (Config.MappingMode == EAefPharusMappingMode::Simple)
 	{
-		// Invert Y if needed (fixes left/right swap in orientation)
-		if (Config.bInvertY)
-		{
-			TrackOrientation.Y = -TrackOrientation.Y;
-		}
-
-		// Apply rotation
-		if (!FMath::IsNearlyZero(Config.FloorRotation))
-		{
-			float RotationRad = FMath::DegreesToRadians(Config.FloorRotation);
-			float CosRot = FMath::Cos(RotationRad);
-			float SinRot = FMath::Sin(RotationRad);
-
-			// Rotate orientation vector
-			FVector2D RotatedOrientation;
-			RotatedOrientation.X = TrackOrientation.X * CosRot - TrackOrientation.Y * SinRot;
-			RotatedOrientation.Y = TrackOrientation.X * SinRot + TrackOrientation.Y * CosRot;
-			TrackOrientation = RotatedOrientation;
-		}
+		// InvertY (fixes left/right swap in orientation) and FloorRotation, compiled
+		TrackOrientation = Transforms.Floor.TransformOrientation(TrackOrientation);
 	}
 
 	Data.Orientation = TrackOrientation;
 	Data.Velocity = FVector(TrackOrientation.X, TrackOrientation.Y, 0.0f) * Data.Speed;
 
-	// RawPosition should be normalized (0-1) for FindWallRegion
-	// If input is already normalized, use it directly; otherwise normalize it
-	if (Config.bUseNormalizedCoordinates)
-	{
-		Data.RawPosition = InputPos; // Already normalized
-	}
-	else
-	{
-		// Normalize absolute coordinates
-		Data.RawPosition.X = InputPos.X / Config.TrackingSurfaceDimensions.X;
-		Data.RawPosition.Y = InputPos.Y / Config.TrackingSurfaceDimensions.Y;
-	}
+	// RawPosition is normalized (0-1) for the wall region lookup and TrackToLocal
+	Data.RawPosition = NormalizedPos;
 
-	// Update timestamp for timeout detection (UDP packet received)
-	Data.LastUpdateTime = FPlatformTime::Seconds();
+	// Timestamp for timeout detection (UDP packet received)
+	Data.LastUpdateTime = Event.ReceiveTime;
+	Data.ArrivalTimeNs = Event.ArrivalTimeNs;
 
-	// Determine assigned wall for Regions mode
+	// Assigned wall for Regions mode (region found by the mapping stage)
 	if (Config.MappingMode == EAefPharusMappingMode::Regions)
 	{
-		const FAefPharusWallRegion* Region = FindWallRegion(Data.RawPosition);
+		Data.AssignedRegionIndex = RegionIndex;
+		const FAefPharusWallRegion* Region = GetAssignedWallRegion(Data);
 		Data.AssignedWall = Region ? Region->WallSide : EAefPharusWallSide::Floor;
 	}
 	else
@@ -1861,7 +2222,9 @@ void UAefPharusInstance::DebugInjectTrack(float NormalizedX, float NormalizedY,
 	UE_LOG(LogAefPharus, Log, TEXT("[%s] DEBUG: Injecting track %d at (%.3f, %.3f)"),
 		*Config.InstanceName.ToString(), TrackID, NormalizedX, NormalizedY);
 
-	onTrackNew(Track);
+	// Game thread: map and apply directly, the event queue has a single (network) producer
+	StageTrackEvent(MakeTrackEvent(FAefPharusTrackEvent::EKind::New, Track));
+	MapStagedTracks();
 }
 
 //--------------------------------------------------------------------------------
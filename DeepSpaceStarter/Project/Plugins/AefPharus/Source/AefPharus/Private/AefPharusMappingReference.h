@@ -0,0 +1,111 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2025
+
+   AefPharus - Reference Mappings
+
+   The per-track mapping chains as the instance evaluated them before they
+   were compiled (AefPharusTransforms.h). The benchmarks time the compiled
+   maps against them, the automation tests check that both agree.
+  ========================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AefPharusTypes.h"
+
+namespace AefPharusMappingReference
+{
+	/**
+	 * Floor mapping as TrackToWorldFloor used to do it for every track: normalize, InvertY,
+	 * scale, FloorRotation (degrees to sin/cos), root rotation and root origin.
+	 * The two subsystem lookups per track (Cast<>(GetOuter()) plus logging) are not included.
+	 * With normalized input and no root transform this is the old TrackToLocalFloor.
+	 */
+	inline FVector MapFloorPerTrack(const FAefPharusInstanceConfig& Config, const FVector2D& TrackPos, const FVector& RootOrigin, const FRotator& RootRotation)
+	{
+		FVector2D AdjustedPos = TrackPos;
+		if (!Config.bUseNormalizedCoordinates)
+		{
+			AdjustedPos.X = TrackPos.X / Config.TrackingSurfaceDimensions.X;
+			AdjustedPos.Y = TrackPos.Y / Config.TrackingSurfaceDimensions.Y;
+		}
+		if (Config.bInvertY)
+		{
+			AdjustedPos.Y = Config.bUseNormalizedCoordinates ? 1.0f - AdjustedPos.Y : -AdjustedPos.Y;
+		}
+
+		FVector2D ScaledPos = AdjustedPos * Config.SimpleScale;
+		if (!FMath::IsNearlyZero(Config.FloorRotation))
+		{
+			const float RotationRad = FMath::DegreesToRadians(Config.FloorRotation);
+			const float CosRot = FMath::Cos(RotationRad);
+			const float SinRot = FMath::Sin(RotationRad);
+			ScaledPos = FVector2D(ScaledPos.X * CosRot - ScaledPos.Y * SinRot, ScaledPos.X * SinRot + ScaledPos.Y * CosRot);
+		}
+
+		const FVector LocalPos(ScaledPos.X, ScaledPos.Y, Config.FloorZ);
+		return RootOrigin + RootRotation.RotateVector(LocalPos);
+	}
+
+	/**
+	 * Wall region mapping as FAefPharusWallRegion::TrackToWorld used to do it for every track:
+	 * region bounds, InvertY, scale, 2D rotation, origin, wall rotation and position, root.
+	 * With no root transform this is the old TrackToLocal.
+	 */
+	inline FVector MapWallPerTrack(const FAefPharusWallRegion& Region, const FVector2D& TrackPos, const FVector& RootOrigin, const FRotator& RootRotation, float GlobalWallRotation)
+	{
+		FVector2D LocalPos = (TrackPos - Region.TrackingBounds.Min) / Region.TrackingBounds.GetSize();
+		if (Region.bInvertY)
+		{
+			LocalPos.Y = 1.0f - LocalPos.Y;
+		}
+
+		FVector2D ScaledPos = LocalPos * Region.Scale;
+		const float TotalRotation = GlobalWallRotation + Region.Rotation2D;
+		if (!FMath::IsNearlyZero(TotalRotation))
+		{
+			const float RotationRad = FMath::DegreesToRadians(TotalRotation);
+			const float CosRot = FMath::Cos(RotationRad);
+			const float SinRot = FMath::Sin(RotationRad);
+			ScaledPos = FVector2D(ScaledPos.X * CosRot - ScaledPos.Y * SinRot, ScaledPos.X * SinRot + ScaledPos.Y * CosRot);
+		}
+
+		const FVector2D OffsetPos = ScaledPos + Region.Origin;
+		const FVector WallLocalWorld = Region.WorldPosition + Region.WorldRotation.RotateVector(FVector(OffsetPos.X, 0.0f, OffsetPos.Y));
+		return RootOrigin + RootRotation.RotateVector(WallLocalWorld);
+	}
+
+	/**
+	 * Region lookup as UAefPharusInstance::FindWallRegion used to do it: collect every match into
+	 * a TArray, then one pass per wall side for the Front > Right > Back > Left priority.
+	 */
+	inline int32 FindWallRegionPerTrack(const TArray<FAefPharusWallRegion>& Regions, const FVector2D& TrackPos)
+	{
+		TArray<int32> MatchingRegions;
+		for (int32 i = 0; i < Regions.Num(); ++i)
+		{
+			if (Regions[i].ContainsTrackPoint(TrackPos))
+			{
+				MatchingRegions.Add(i);
+			}
+		}
+
+		if (MatchingRegions.Num() <= 1)
+		{
+			return MatchingRegions.Num() == 1 ? MatchingRegions[0] : INDEX_NONE;
+		}
+
+		const EAefPharusWallSide Priority[] = { EAefPharusWallSide::Front, EAefPharusWallSide::Right, EAefPharusWallSide::Back, EAefPharusWallSide::Left };
+		for (const EAefPharusWallSide WallSide : Priority)
+		{
+			for (const int32 Region : MatchingRegions)
+			{
+				if (Regions[Region].WallSide == WallSide)
+				{
+					return Region;
+				}
+			}
+		}
+		return MatchingRegions[0];
+	}
+}
@@ -13,6 +13,7 @@
 #include "Engine/World.h"
 #include "Misc/Paths.h"
 #include "Misc/ConfigCacheIni.h"
+#include "HAL/PlatformMisc.h"
 
 //--------------------------------------------------------------------------------
 // USubsystem Interface
@@ -27,6 +28,20 @@ void UAefPharusSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	// Load configuration
 	LoadConfigurationFromIni();
 
+	// Root origin snapshot for the instances, refreshed every frame (follows a moving RootOriginActor)
+	PublishRootTransform();
+	RootTransformTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UAefPharusSubsystem::TickRootTransform),
+		0.0f // Every frame
+	);
+
+	// Shared network I/O for all instances (created before any instance binds its socket)
+	if (NetworkIOThreads > 0)
+	{
+		NetworkReactor = MakeUnique<pharus::TrackLinkReactor>(NetworkIOThreads,
+			MakeNetworkThreadOptions(NetworkIOThreadPriority, NetworkIOThreadAffinityMask));
+	}
+
 	// Read AutoStartSystem flag from config (default: true for backward compatibility)
 	FString ConfigPath = GetConfigFilePath();
 	bAutoStartSystem = true;  // Default to auto-start
@@ -126,6 +141,12 @@ void UAefPharusSubsystem::Deinitialize()
 		World->GetTimerManager().ClearTimer(DelayedInitTimerHandle);
 	}
 
+	if (RootTransformTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(RootTransformTickHandle);
+		RootTransformTickHandle.Reset();
+	}
+
 	// Shutdown all instances
 	for (auto& Pair : TrackerInstances)
 	{
@@ -136,6 +157,9 @@ void UAefPharusSubsystem::Deinitialize()
 	}
 	TrackerInstances.Empty();
 
+	// All TrackLink clients are gone now - stop the shared network threads
+	NetworkReactor.Reset();
+
 	Super::Deinitialize();
 }
 
@@ -156,6 +180,7 @@ FAefPharusCreateInstanceResult UAefPharusSubsystem::CreateTrackerInstance(const
 		UE_LOG(LogAefPharus, Log, TEXT("  UDPPort: %d"), Config.UDPPort);
 		UE_LOG(LogAefPharus, Log, TEXT("  bIsMulticast: %s"), Config.bIsMulticast ? TEXT("true") : TEXT("false"));
 		UE_LOG(LogAefPharus, Log, TEXT("  MulticastGroup: %s"), *Config.MulticastGroup);
+		UE_LOG(LogAefPharus, Log, TEXT("  Protocol: %s"), *UEnum::GetValueAsString(Config.Protocol));
 		UE_LOG(LogAefPharus, Log, TEXT("  MappingMode: %s"), *UEnum::GetValueAsString(Config.MappingMode));
 		UE_LOG(LogAefPharus, Log, TEXT("  SpawnClass: %s"), SpawnClass ? *SpawnClass->GetName() : TEXT("None"));
 		UE_LOG(LogAefPharus, Log, TEXT("========================================"));
@@ -464,6 +489,7 @@ void UAefPharusSubsystem::SetRootOrigin(FVector Origin)
 {
 	RootOrigin = Origin;
 	UE_LOG(LogAefPharus, Log, TEXT("Root origin set to: %s"), *RootOrigin.ToString());
+	PublishRootTransform();
 }
 
 FVector UAefPharusSubsystem::GetRootOrigin() const
@@ -471,14 +497,10 @@ FVector UAefPharusSubsystem::GetRootOrigin() const
 	// If using dynamic actor and actor is valid, return its position
 	if (bUsePharusRootOriginActor && PharusRootOriginActor.IsValid())
 	{
-		FVector ActorOrigin = PharusRootOriginActor->GetOriginLocation();
-		UE_LOG(LogAefPharus, Verbose, TEXT("GetRootOrigin: Using actor origin = %s"), *ActorOrigin.ToString());
-		return ActorOrigin;
+		return PharusRootOriginActor->GetOriginLocation();
 	}
 
 	// Return static origin (from config or SetRootOrigin)
-	UE_LOG(LogAefPharus, Verbose, TEXT("GetRootOrigin: Using static origin = %s, bUsePharusRootOriginActor=%s"), 
-		*RootOrigin.ToString(), bUsePharusRootOriginActor ? TEXT("true") : TEXT("false"));
 	return RootOrigin;
 }
 
@@ -497,6 +519,7 @@ void UAefPharusSubsystem::SetRootOriginRotation(FRotator Rotation)
 {
 	RootRotation = Rotation;
 	UE_LOG(LogAefPharus, Log, TEXT("Root origin rotation set to: %s"), *RootRotation.ToString());
+	PublishRootTransform();
 }
 
 FRotator UAefPharusSubsystem::GetRootOriginRotation() const
@@ -504,13 +527,10 @@ FRotator UAefPharusSubsystem::GetRootOriginRotation() const
 	// If using dynamic actor and actor is valid, return its rotation
 	if (bUsePharusRootOriginActor && PharusRootOriginActor.IsValid())
 	{
-		FRotator ActorRotation = PharusRootOriginActor->GetOriginRotation();
-		UE_LOG(LogAefPharus, Verbose, TEXT("GetRootOriginRotation: Using actor rotation = %s"), *ActorRotation.ToString());
-		return ActorRotation;
+		return PharusRootOriginActor->GetOriginRotation();
 	}
 
 	// Return static rotation (from config or SetRootOriginRotation)
-	UE_LOG(LogAefPharus, Verbose, TEXT("GetRootOriginRotation: Using static rotation = %s"), *RootRotation.ToString());
 	return RootRotation;
 }
 
@@ -554,6 +574,8 @@ void UAefPharusSubsystem::RegisterRootOriginActor(AAefPharusRootOriginActor* Roo
 			*RootOrigin.ToString(), *RootRotation.ToString());
 		UE_LOG(LogAefPharus, Log, TEXT("  -> Set UsePharusRootOriginActor=true in config to use this actor's transform."));
 	}
+
+	PublishRootTransform();
 }
 
 void UAefPharusSubsystem::UnregisterRootOriginActor(AAefPharusRootOriginActor* RootActor)
@@ -568,6 +590,7 @@ void UAefPharusSubsystem::UnregisterRootOriginActor(AAefPharusRootOriginActor* R
 	{
 		PharusRootOriginActor.Reset();
 		UE_LOG(LogAefPharus, Log, TEXT("PharusRootOriginActor '%s' unregistered"), *RootActor->GetName());
+		PublishRootTransform();
 	}
 }
 
@@ -586,6 +609,168 @@ bool UAefPharusSubsystem::IsRelativeSpawningActive() const
 	return bUseRelativeSpawning && bUsePharusRootOriginActor && PharusRootOriginActor.IsValid();
 }
 
+void UAefPharusSubsystem::PublishRootTransform()
+{
+	// The only place the RootOriginActor is read for the instances, once per frame
+	FAefPharusRootTransform Sample;
+	Sample.Origin = GetRootOrigin();
+	Sample.Rotation = GetRootOriginRotation();
+	Sample.bRelativeSpawning = IsRelativeSpawningActive();
+
+	if (RootTransform.Generation != 0 && Sample.Origin == RootTransform.Origin && Sample.Rotation == RootTransform.Rotation
+		&& Sample.bRelativeSpawning == RootTransform.bRelativeSpawning)
+	{
+		return;
+	}
+
+	// Generation 0 means "never published"
+	Sample.Generation = FMath::Max(RootTransform.Generation + 1, 1u);
+	RootTransform = Sample;
+	PublishedRootTransform.Write(RootTransform);
+
+	UE_LOG(LogAefPharus, Verbose, TEXT("Root transform published: Origin=%s, Rotation=%s, RelativeSpawning=%s (generation %u)"),
+		*RootTransform.Origin.ToString(), *RootTransform.Rotation.ToString(),
+		RootTransform.bRelativeSpawning ? TEXT("true") : TEXT("false"), RootTransform.Generation);
+}
+
+bool UAefPharusSubsystem::TickRootTransform(float DeltaTime)
+{
+	PublishRootTransform();
+	return true; // Keep ticking
+}
+
+pharus::TrackLinkReactor* UAefPharusSubsystem::GetNetworkReactor() const
+{
+	return NetworkReactor.Get();
+}
+
+pharus::TrackLinkThreadOptions UAefPharusSubsystem::MakeNetworkThreadOptions(EAefPharusThreadPriority Priority, int64 AffinityMask, const FString& ThreadName)
+{
+	pharus::TrackLinkThreadOptions Options;
+	Options.name = TCHAR_TO_UTF8(*ThreadName);
+
+	switch (Priority)
+	{
+	case EAefPharusThreadPriority::Lowest:				Options.priority = TPri_Lowest; break;
+	case EAefPharusThreadPriority::BelowNormal:			Options.priority = TPri_BelowNormal; break;
+	case EAefPharusThreadPriority::SlightlyBelowNormal:	Options.priority = TPri_SlightlyBelowNormal; break;
+	case EAefPharusThreadPriority::AboveNormal:			Options.priority = TPri_AboveNormal; break;
+	case EAefPharusThreadPriority::Highest:				Options.priority = TPri_Highest; break;
+	case EAefPharusThreadPriority::TimeCritical:		Options.priority = TPri_TimeCritical; break;
+	default:											Options.priority = TPri_Normal; break;
+	}
+
+	// A mask without any existing core would leave the thread nowhere to run
+	const int32 NumCores = FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+	const uint64 AvailableMask = NumCores >= 64 ? ~0ull : ((1ull << NumCores) - 1);
+	const uint64 RequestedMask = (uint64)AffinityMask;
+	if (RequestedMask != 0 && (RequestedMask & AvailableMask) == 0)
+	{
+		UE_LOG(LogAefPharus, Warning, TEXT("Thread affinity mask 0x%llx names none of the %d logical cores, ignoring it"), RequestedMask, NumCores);
+	}
+	else if ((RequestedMask & ~AvailableMask) != 0)
+	{
+		UE_LOG(LogAefPharus, Warning, TEXT("Thread affinity mask 0x%llx names cores beyond the %d available, using 0x%llx"),
+			RequestedMask, NumCores, RequestedMask & AvailableMask);
+	}
+	Options.affinityMask = RequestedMask & AvailableMask;
+	return Options;
+}
+
+void UAefPharusSubsystem::ParseThreadSettingsFromIni(const FString& SectionName, const FString& ConfigPath, const TCHAR* Prefix,
+	EAefPharusThreadPriority& OutPriority, int64& OutAffinityMask)
+{
+	const FString PriorityKey = FString::Printf(TEXT("%sPriority"), Prefix);
+	FString PriorityStr;
+	if (GConfig->GetString(*SectionName, *PriorityKey, PriorityStr, ConfigPath))
+	{
+		const int64 Value = StaticEnum<EAefPharusThreadPriority>()->GetValueByNameString(PriorityStr.TrimStartAndEnd());
+		if (Value != INDEX_NONE)
+		{
+			OutPriority = (EAefPharusThreadPriority)Value;
+		}
+		else
+		{
+			UE_LOG(LogAefPharus, Warning, TEXT("[%s] Unknown %s '%s' (Lowest, BelowNormal, SlightlyBelowNormal, Normal, AboveNormal, Highest, TimeCritical)"),
+				*SectionName, *PriorityKey, *PriorityStr);
+		}
+	}
+
+	// Read as string so masks can be written in hex
+	const FString MaskKey = FString::Printf(TEXT("%sAffinityMask"), Prefix);
+	FString MaskStr;
+	if (GConfig->GetString(*SectionName, *MaskKey, MaskStr, ConfigPath))
+	{
+		MaskStr.TrimStartAndEndInline();
+		TCHAR* End = nullptr;
+		const uint64 Mask = FCString::Strtoui64(*MaskStr, &End, 0);
+		if (!MaskStr.IsEmpty() && End && *End == TEXT('\0'))
+		{
+			OutAffinityMask = (int64)Mask;
+		}
+		else
+		{
+			UE_LOG(LogAefPharus, Warning, TEXT("[%s] Invalid %s '%s' (expected a bit mask, e.g. 0xF0)"), *SectionName, *MaskKey, *MaskStr);
+		}
+	}
+}
+
+void UAefPharusSubsystem::ParseBridgeSettingsFromIni(const FString& SectionName, const FString& ConfigPath,
+	EAefPharusBridgeMode& OutMode, FString& OutName)
+{
+	FString ModeStr;
+	if (GConfig->GetString(*SectionName, TEXT("BridgeMode"), ModeStr, ConfigPath))
+	{
+		const int64 Value = StaticEnum<EAefPharusBridgeMode>()->GetValueByNameString(ModeStr.TrimStartAndEnd());
+		if (Value != INDEX_NONE)
+		{
+			OutMode = (EAefPharusBridgeMode)Value;
+		}
+		else
+		{
+			UE_LOG(LogAefPharus, Warning, TEXT("[%s] Unknown BridgeMode '%s' (Off, Publish, Subscribe, Auto)"), *SectionName, *ModeStr);
+		}
+	}
+
+	FString NameStr;
+	if (GConfig->GetString(*SectionName, TEXT("BridgeName"), NameStr, ConfigPath))
+	{
+		OutName = NameStr.TrimStartAndEnd();
+	}
+}
+
+void UAefPharusSubsystem::ParseProtocolSettingsFromIni(const FString& SectionName, const FString& ConfigPath,
+	EAefPharusProtocol& OutProtocol, FVector2D& OutTuioAreaSize)
+{
+	FString ProtocolStr;
+	if (GConfig->GetString(*SectionName, TEXT("Protocol"), ProtocolStr, ConfigPath))
+	{
+		const int64 Value = StaticEnum<EAefPharusProtocol>()->GetValueByNameString(ProtocolStr.TrimStartAndEnd());
+		if (Value != INDEX_NONE)
+		{
+			OutProtocol = (EAefPharusProtocol)Value;
+		}
+		else
+		{
+			UE_LOG(LogAefPharus, Warning, TEXT("[%s] Unknown Protocol '%s' (TrackLink, Tuio)"), *SectionName, *ProtocolStr);
+		}
+	}
+
+	FString AreaStr;
+	if (GConfig->GetString(*SectionName, TEXT("TuioAreaSize"), AreaStr, ConfigPath))
+	{
+		FVector2D Area;
+		if (Area.InitFromString(AreaStr) && Area.X > 0.0 && Area.Y > 0.0)
+		{
+			OutTuioAreaSize = Area;
+		}
+		else
+		{
+			UE_LOG(LogAefPharus, Warning, TEXT("[%s] Invalid TuioAreaSize '%s' (expected meters, e.g. (X=15.0,Y=8.3))"), *SectionName, *AreaStr);
+		}
+	}
+}
+
 //--------------------------------------------------------------------------------
 // Configuration Loading
 //--------------------------------------------------------------------------------
@@ -656,6 +841,15 @@ void UAefPharusSubsystem::LoadConfigurationFromIni()
 		bUseRelativeSpawning = false;
 	}
 
+	// NetworkIOThreads: shared network threads servicing all instances (default: 1, 0 = one thread per instance)
+	GConfig->GetInt(TEXT("PharusSubsystem"), TEXT("NetworkIOThreads"), NetworkIOThreads, ConfigPath);
+	NetworkIOThreads = FMath::Clamp(NetworkIOThreads, 0, 16);
+	ParseThreadSettingsFromIni(TEXT("PharusSubsystem"), ConfigPath, TEXT("NetworkIOThread"), NetworkIOThreadPriority, NetworkIOThreadAffinityMask);
+	UE_LOG(LogAefPharus, Log, TEXT("Network I/O: %s"), NetworkIOThreads > 0
+		? *FString::Printf(TEXT("%d shared thread(s), priority %s, affinity 0x%llx"), NetworkIOThreads,
+			*StaticEnum<EAefPharusThreadPriority>()->GetNameStringByValue((int64)NetworkIOThreadPriority), (uint64)NetworkIOThreadAffinityMask)
+		: TEXT("one receive thread per instance"));
+
 	// Log origin mode
 	if (bUsePharusRootOriginActor)
 	{
@@ -821,6 +1015,18 @@ FAefPharusInstanceConfig UAefPharusSubsystem::ParseInstanceConfigFromIni(const F
 	GConfig->GetInt(*SectionName, TEXT("UDPPort"), Config.UDPPort, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("IsMulticast"), Config.bIsMulticast, ConfigPath);
 	GConfig->GetString(*SectionName, TEXT("MulticastGroup"), Config.MulticastGroup, ConfigPath);
+	ParseProtocolSettingsFromIni(SectionName, ConfigPath, Config.Protocol, Config.TuioAreaSize);
+	GConfig->GetInt(*SectionName, TEXT("ReceiveBufferSize"), Config.ReceiveBufferSize, ConfigPath);
+	GConfig->GetInt(*SectionName, TEXT("ReceiveWorkers"), Config.ReceiveWorkers, ConfigPath);
+	GConfig->GetBool(*SectionName, TEXT("BusyPoll"), Config.bBusyPoll, ConfigPath);
+	GConfig->GetInt(*SectionName, TEXT("BusyPollSpinMicroseconds"), Config.BusyPollSpinMicroseconds, ConfigPath);
+	GConfig->GetInt(*SectionName, TEXT("BusyPollYieldMicroseconds"), Config.BusyPollYieldMicroseconds, ConfigPath);
+	GConfig->GetInt(*SectionName, TEXT("BusyPollSocketMicroseconds"), Config.BusyPollSocketMicroseconds, ConfigPath);
+	ParseThreadSettingsFromIni(SectionName, ConfigPath, TEXT("ReceiveThread"), Config.ReceiveThreadPriority, Config.ReceiveThreadAffinityMask);
+	GConfig->GetBool(*SectionName, TEXT("CaptureTraffic"), Config.bCaptureTraffic, ConfigPath);
+	GConfig->GetString(*SectionName, TEXT("ReplayFile"), Config.ReplayFile, ConfigPath);
+	GConfig->GetFloat(*SectionName, TEXT("ReplaySpeed"), Config.ReplaySpeed, ConfigPath);
+	ParseBridgeSettingsFromIni(SectionName, ConfigPath, Config.BridgeMode, Config.BridgeName);
 
 	// Mapping mode
 	FString MappingModeStr;
@@ -937,12 +1143,15 @@ FAefPharusInstanceConfig UAefPharusSubsystem::ParseInstanceConfigFromIni(const F
 	GConfig->GetBool(*SectionName, TEXT("UseRelativeSpawning"), Config.bUseRelativeSpawning, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("LiveAdjustments"), Config.bLiveAdjustments, ConfigPath);
 	GConfig->GetFloat(*SectionName, TEXT("TrackLostTimeout"), Config.TrackLostTimeout, ConfigPath);
+	GConfig->GetBool(*SectionName, TEXT("UseFrameSnapshots"), Config.bUseFrameSnapshots, ConfigPath);
+	GConfig->GetInt(*SectionName, TEXT("TrackEventQueueSize"), Config.TrackEventQueueSize, ConfigPath);
 
 	// Logging & Debug
 	GConfig->GetBool(*SectionName, TEXT("LogTrackerSpawned"), Config.bLogTrackerSpawned, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("LogTrackerUpdated"), Config.bLogTrackerUpdated, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("LogTrackerRemoved"), Config.bLogTrackerRemoved, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("LogNetworkStats"), Config.bLogNetworkStats, ConfigPath);
+	GConfig->GetFloat(*SectionName, TEXT("NetworkStatsInterval"), Config.NetworkStatsInterval, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("LogRegionAssignment"), Config.bLogRegionAssignment, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("LogRejectedTracks"), Config.bLogRejectedTracks, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("DebugVisualization"), Config.bDebugVisualization, ConfigPath);
@@ -1181,6 +1390,18 @@ bool UAefPharusSubsystem::GetFloorSettingsFromDisk(FName InstanceName, FAefPharu
 	GConfig->GetInt(*SectionName, TEXT("UDPPort"), DiskConfig.UDPPort, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("IsMulticast"), DiskConfig.bIsMulticast, ConfigPath);
 	GConfig->GetString(*SectionName, TEXT("MulticastGroup"), DiskConfig.MulticastGroup, ConfigPath);
+	ParseProtocolSettingsFromIni(SectionName, ConfigPath, DiskConfig.Protocol, DiskConfig.TuioAreaSize);
+	GConfig->GetInt(*SectionName, TEXT("ReceiveBufferSize"), DiskConfig.ReceiveBufferSize, ConfigPath);
+	GConfig->GetInt(*SectionName, TEXT("ReceiveWorkers"), DiskConfig.ReceiveWorkers, ConfigPath);
+	GConfig->GetBool(*SectionName, TEXT("BusyPoll"), DiskConfig.bBusyPoll, ConfigPath);
+	GConfig->GetInt(*SectionName, TEXT("BusyPollSpinMicroseconds"), DiskConfig.BusyPollSpinMicroseconds, ConfigPath);
+	GConfig->GetInt(*SectionName, TEXT("BusyPollYieldMicroseconds"), DiskConfig.BusyPollYieldMicroseconds, ConfigPath);
+	GConfig->GetInt(*SectionName, TEXT("BusyPollSocketMicroseconds"), DiskConfig.BusyPollSocketMicroseconds, ConfigPath);
+	ParseThreadSettingsFromIni(SectionName, ConfigPath, TEXT("ReceiveThread"), DiskConfig.ReceiveThreadPriority, DiskConfig.ReceiveThreadAffinityMask);
+	GConfig->GetBool(*SectionName, TEXT("CaptureTraffic"), DiskConfig.bCaptureTraffic, ConfigPath);
+	GConfig->GetString(*SectionName, TEXT("ReplayFile"), DiskConfig.ReplayFile, ConfigPath);
+	GConfig->GetFloat(*SectionName, TEXT("ReplaySpeed"), DiskConfig.ReplaySpeed, ConfigPath);
+	ParseBridgeSettingsFromIni(SectionName, ConfigPath, DiskConfig.BridgeMode, DiskConfig.BridgeName);
 
 	// Coordinate System Settings (Origin is now global via [PharusSubsystem].GlobalOrigin)
 	FString ScaleStr;
@@ -1257,12 +1478,15 @@ bool UAefPharusSubsystem::GetFloorSettingsFromDisk(FName InstanceName, FAefPharu
 	GConfig->GetBool(*SectionName, TEXT("ApplyOrientationFromMovement"), DiskConfig.bApplyOrientationFromMovement, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("LiveAdjustments"), DiskConfig.bLiveAdjustments, ConfigPath);
 	GConfig->GetFloat(*SectionName, TEXT("TrackLostTimeout"), DiskConfig.TrackLostTimeout, ConfigPath);
+	GConfig->GetBool(*SectionName, TEXT("UseFrameSnapshots"), DiskConfig.bUseFrameSnapshots, ConfigPath);
+	GConfig->GetInt(*SectionName, TEXT("TrackEventQueueSize"), DiskConfig.TrackEventQueueSize, ConfigPath);
 
 	// Logging & Debug
 	GConfig->GetBool(*SectionName, TEXT("LogTrackerSpawned"), DiskConfig.bLogTrackerSpawned, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("LogTrackerUpdated"), DiskConfig.bLogTrackerUpdated, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("LogTrackerRemoved"), DiskConfig.bLogTrackerRemoved, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("LogNetworkStats"), DiskConfig.bLogNetworkStats, ConfigPath);
+	GConfig->GetFloat(*SectionName, TEXT("NetworkStatsInterval"), DiskConfig.NetworkStatsInterval, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("LogRegionAssignment"), DiskConfig.bLogRegionAssignment, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("DebugVisualization"), DiskConfig.bDebugVisualization, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("DebugDrawBounds"), DiskConfig.bDebugDrawBounds, ConfigPath);
@@ -1316,6 +1540,18 @@ bool UAefPharusSubsystem::GetWallSettingsFromDisk(FName InstanceName, FAefPharus
 	GConfig->GetInt(*SectionName, TEXT("UDPPort"), DiskConfig.UDPPort, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("IsMulticast"), DiskConfig.bIsMulticast, ConfigPath);
 	GConfig->GetString(*SectionName, TEXT("MulticastGroup"), DiskConfig.MulticastGroup, ConfigPath);
+	ParseProtocolSettingsFromIni(SectionName, ConfigPath, DiskConfig.Protocol, DiskConfig.TuioAreaSize);
+	GConfig->GetInt(*SectionName, TEXT("ReceiveBufferSize"), DiskConfig.ReceiveBufferSize, ConfigPath);
+	GConfig->GetInt(*SectionName, TEXT("ReceiveWorkers"), DiskConfig.ReceiveWorkers, ConfigPath);
+	GConfig->GetBool(*SectionName, TEXT("BusyPoll"), DiskConfig.bBusyPoll, ConfigPath);
+	GConfig->GetInt(*SectionName, TEXT("BusyPollSpinMicroseconds"), DiskConfig.BusyPollSpinMicroseconds, ConfigPath);
+	GConfig->GetInt(*SectionName, TEXT("BusyPollYieldMicroseconds"), DiskConfig.BusyPollYieldMicroseconds, ConfigPath);
+	GConfig->GetInt(*SectionName, TEXT("BusyPollSocketMicroseconds"), DiskConfig.BusyPollSocketMicroseconds, ConfigPath);
+	ParseThreadSettingsFromIni(SectionName, ConfigPath, TEXT("ReceiveThread"), DiskConfig.ReceiveThreadPriority, DiskConfig.ReceiveThreadAffinityMask);
+	GConfig->GetBool(*SectionName, TEXT("CaptureTraffic"), DiskConfig.bCaptureTraffic, ConfigPath);
+	GConfig->GetString(*SectionName, TEXT("ReplayFile"), DiskConfig.ReplayFile, ConfigPath);
+	GConfig->GetFloat(*SectionName, TEXT("ReplaySpeed"), DiskConfig.ReplaySpeed, ConfigPath);
+	ParseBridgeSettingsFromIni(SectionName, ConfigPath, DiskConfig.BridgeMode, DiskConfig.BridgeName);
 
 	// Tracking Surface Configuration
 	FString TrackingSurfaceDimensionsStr;
@@ -1379,12 +1615,15 @@ bool UAefPharusSubsystem::GetWallSettingsFromDisk(FName InstanceName, FAefPharus
 	GConfig->GetBool(*SectionName, TEXT("ApplyOrientationFromMovement"), DiskConfig.bApplyOrientationFromMovement, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("LiveAdjustments"), DiskConfig.bLiveAdjustments, ConfigPath);
 	GConfig->GetFloat(*SectionName, TEXT("TrackLostTimeout"), DiskConfig.TrackLostTimeout, ConfigPath);
+	GConfig->GetBool(*SectionName, TEXT("UseFrameSnapshots"), DiskConfig.bUseFrameSnapshots, ConfigPath);
+	GConfig->GetInt(*SectionName, TEXT("TrackEventQueueSize"), DiskConfig.TrackEventQueueSize, ConfigPath);
 
 	// Logging & Debug
 	GConfig->GetBool(*SectionName, TEXT("LogTrackerSpawned"), DiskConfig.bLogTrackerSpawned, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("LogTrackerUpdated"), DiskConfig.bLogTrackerUpdated, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("LogTrackerRemoved"), DiskConfig.bLogTrackerRemoved, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("LogNetworkStats"), DiskConfig.bLogNetworkStats, ConfigPath);
+	GConfig->GetFloat(*SectionName, TEXT("NetworkStatsInterval"), DiskConfig.NetworkStatsInterval, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("LogRegionAssignment"), DiskConfig.bLogRegionAssignment, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("LogRejectedTracks"), DiskConfig.bLogRejectedTracks, ConfigPath);
 	GConfig->GetBool(*SectionName, TEXT("DebugVisualization"), DiskConfig.bDebugVisualization, ConfigPath);
@@ -0,0 +1,261 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2025
+
+   AefPharus - Compiled Coordinate Transforms Implementation
+  ========================================================================*/
+
+#include "AefPharusTransforms.h"
+#include "AefPharusTypes.h"
+
+#include <algorithm>
+
+//--------------------------------------------------------------------------------
+// FAefPharusTrackAffine
+//--------------------------------------------------------------------------------
+
+FAefPharusTrackAffine FAefPharusTrackAffine::Then(const FRotator& Rotation, const FVector& Translation) const
+{
+	// Rotation is linear: rotating the columns rotates every mapped point
+	FAefPharusTrackAffine Result;
+	Result.Origin = Rotation.RotateVector(Origin) + Translation;
+	Result.AxisX = Rotation.RotateVector(AxisX);
+	Result.AxisY = Rotation.RotateVector(AxisY);
+	return Result;
+}
+
+//--------------------------------------------------------------------------------
+// FAefPharusFloorTransform
+//--------------------------------------------------------------------------------
+
+namespace
+{
+	/**
+	 * Floor chain (InvertY, SimpleScale, FloorRotation, FloorZ) for an input that is
+	 * divided by Normalize first. InvertY flips within 0-1 for normalized input and
+	 * mirrors around 0 for absolute input, like TrackToWorldFloor always did.
+	 */
+	FAefPharusTrackAffine CompileFloorChain(const FAefPharusInstanceConfig& Config, const FVector2D& Normalize, bool bFlipWithinUnit, float CosRot, float SinRot)
+	{
+		// Y after normalization and InvertY: OffsetY + SlopeY * Input.Y
+		const double SlopeY = Config.bInvertY ? -Normalize.Y : Normalize.Y;
+		const double OffsetY = Config.bInvertY && bFlipWithinUnit ? 1.0 : 0.0;
+
+		const double ScaleX = Config.SimpleScale.X * Normalize.X;
+		const double ScaleY = Config.SimpleScale.Y * SlopeY;
+		const double ScaledOffsetY = Config.SimpleScale.Y * OffsetY;
+
+		FAefPharusTrackAffine Affine;
+		Affine.AxisX = FVector(ScaleX * CosRot, ScaleX * SinRot, 0.0);
+		Affine.AxisY = FVector(-ScaleY * SinRot, ScaleY * CosRot, 0.0);
+		Affine.Origin = FVector(-ScaledOffsetY * SinRot, ScaledOffsetY * CosRot, Config.FloorZ);
+		return Affine;
+	}
+
+	/** Priority of overlapping regions, lower wins: Front > Right > Back > Left > others */
+	int32 RegionPriority(EAefPharusWallSide WallSide)
+	{
+		switch (WallSide)
+		{
+			case EAefPharusWallSide::Front: return 0;
+			case EAefPharusWallSide::Right: return 1;
+			case EAefPharusWallSide::Back: return 2;
+			case EAefPharusWallSide::Left: return 3;
+			default: return 4;
+		}
+	}
+
+	/** Cos/sin of a rotation in degrees, exactly (1, 0) when it is nearly zero (the chain skipped it) */
+	void RotationCosSin(float Degrees, float& OutCos, float& OutSin)
+	{
+		OutCos = 1.0f;
+		OutSin = 0.0f;
+		if (!FMath::IsNearlyZero(Degrees))
+		{
+			const float RotationRad = FMath::DegreesToRadians(Degrees);
+			OutCos = FMath::Cos(RotationRad);
+			OutSin = FMath::Sin(RotationRad);
+		}
+	}
+}
+
+FAefPharusFloorTransform FAefPharusFloorTransform::Compile(const FAefPharusInstanceConfig& Config, const FVector& RootOrigin, const FRotator& RootRotation)
+{
+	float CosRot;
+	float SinRot;
+	RotationCosSin(Config.FloorRotation, CosRot, SinRot);
+
+	FAefPharusFloorTransform Transform;
+
+	// World: input as received, normalized by the surface size unless it already is
+	const FVector2D Normalize = Config.bUseNormalizedCoordinates
+		? FVector2D(1.0f, 1.0f)
+		: FVector2D(1.0f / Config.TrackingSurfaceDimensions.X, 1.0f / Config.TrackingSurfaceDimensions.Y);
+	Transform.ToWorld = CompileFloorChain(Config, Normalize, Config.bUseNormalizedCoordinates, CosRot, SinRot)
+		.Then(RootRotation, RootOrigin);
+
+	// Local: RawPosition is always normalized, no root (actor is attached to the root origin actor)
+	Transform.ToLocal = CompileFloorChain(Config, FVector2D(1.0f, 1.0f), true, CosRot, SinRot);
+
+	// Orientation: InvertY mirrors, then FloorRotation
+	const float Mirror = Config.bInvertY ? -1.0f : 1.0f;
+	Transform.OrientationX = FVector2D(CosRot, SinRot);
+	Transform.OrientationY = FVector2D(-SinRot * Mirror, CosRot * Mirror);
+
+	return Transform;
+}
+
+//--------------------------------------------------------------------------------
+// FAefPharusWallTransform
+//--------------------------------------------------------------------------------
+
+FAefPharusWallTransform FAefPharusWallTransform::Compile(const FAefPharusWallRegion& Region, float GlobalWallRotation, const FVector& RootOrigin, const FRotator& RootRotation)
+{
+	// Steps 1-3: position within the region bounds (0-1), InvertY (1-Y), Scale
+	//   WallX = ScaleX * Position.X + OffsetX
+	//   WallY = ScaleY * Position.Y + OffsetY
+	const FVector2D RegionSize = Region.TrackingBounds.GetSize();
+	const double Flip = Region.bInvertY ? -1.0 : 1.0;
+	const double ScaleX = Region.Scale.X / RegionSize.X;
+	const double ScaleY = Region.Scale.Y * Flip / RegionSize.Y;
+	const double OffsetX = -Region.Scale.X * Region.TrackingBounds.Min.X / RegionSize.X;
+	const double OffsetY = Region.Scale.Y * ((Region.bInvertY ? 1.0 : 0.0) - Flip * Region.TrackingBounds.Min.Y / RegionSize.Y);
+
+	// Step 4: global WallRotation + per-region Rotation2D, on scaled coordinates
+	float CosRot;
+	float SinRot;
+	RotationCosSin(GlobalWallRotation + Region.Rotation2D, CosRot, SinRot);
+
+	// Step 5: Origin offset. The wall plane is (X, 0, Y) in wall space
+	const FVector WallAxisX(ScaleX * CosRot, 0.0, ScaleX * SinRot);
+	const FVector WallAxisY(-ScaleY * SinRot, 0.0, ScaleY * CosRot);
+	const FVector WallOrigin(OffsetX * CosRot - OffsetY * SinRot + Region.Origin.X, 0.0, OffsetX * SinRot + OffsetY * CosRot + Region.Origin.Y);
+
+	// Steps 6-8: wall rotation and position (relative to the root origin)
+	FAefPharusTrackAffine Wall;
+	Wall.Origin = WallOrigin;
+	Wall.AxisX = WallAxisX;
+	Wall.AxisY = WallAxisY;
+
+	FAefPharusWallTransform Transform;
+	Transform.ToLocal = Wall.Then(Region.WorldRotation, Region.WorldPosition);
+
+	// Steps 9-10: root rotation and origin
+	Transform.ToWorld = Transform.ToLocal.Then(RootRotation, RootOrigin);
+	return Transform;
+}
+
+//--------------------------------------------------------------------------------
+// FAefPharusWallRegionLookup
+//--------------------------------------------------------------------------------
+
+int32 FAefPharusWallRegionLookup::Find(const FVector2D& Position) const
+{
+	// Number of cuts at or left of X, counted without branches (a NaN ends up in slab 0, which is empty)
+	int32 Slab = 0;
+	for (int32 i = 0; i < NumCuts; ++i)
+	{
+		Slab += Cuts[i] <= Position.X ? 1 : 0;
+	}
+
+	for (int32 i = SlabStart[Slab]; i < SlabStart[Slab + 1]; ++i)
+	{
+		const int32 Region = SlabRegions[i];
+		if (Position.X > Min[Region].X && Position.X < Max[Region].X && Position.Y > Min[Region].Y && Position.Y < Max[Region].Y)
+		{
+			return Region;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void FAefPharusWallRegionLookup::FindBatch(TArrayView<const FVector2D> Positions, TArrayView<int32> OutRegionIndices) const
+{
+	check(OutRegionIndices.Num() >= Positions.Num());
+	for (int32 i = 0; i < Positions.Num(); ++i)
+	{
+		OutRegionIndices[i] = Find(Positions[i]);
+	}
+}
+
+FAefPharusWallRegionLookup FAefPharusWallRegionLookup::Compile(const TArray<FAefPharusWallRegion>& Regions)
+{
+	FAefPharusWallRegionLookup Lookup;
+	const int32 NumRegions = FMath::Min(Regions.Num(), MaxRegions);
+
+	for (int32 Region = 0; Region < NumRegions; ++Region)
+	{
+		Lookup.Min[Region] = Regions[Region].TrackingBounds.Min;
+		Lookup.Max[Region] = Regions[Region].TrackingBounds.Max;
+		Lookup.Cuts[Lookup.NumCuts++] = Lookup.Min[Region].X;
+		Lookup.Cuts[Lookup.NumCuts++] = Lookup.Max[Region].X;
+	}
+	std::sort(Lookup.Cuts, Lookup.Cuts + Lookup.NumCuts);
+	Lookup.NumCuts = (int32)(std::unique(Lookup.Cuts, Lookup.Cuts + Lookup.NumCuts) - Lookup.Cuts);
+
+	// Priority order once, then every slab takes the regions spanning it in that order
+	int32 ByPriority[MaxRegions];
+	for (int32 Region = 0; Region < NumRegions; ++Region)
+	{
+		ByPriority[Region] = Region;
+	}
+	std::stable_sort(ByPriority, ByPriority + NumRegions, [&Regions](int32 A, int32 B)
+	{
+		return RegionPriority(Regions[A].WallSide) < RegionPriority(Regions[B].WallSide);
+	});
+
+	int32 NumSlabRegions = 0;
+	for (int32 Slab = 0; Slab <= Lookup.NumCuts; ++Slab)
+	{
+		Lookup.SlabStart[Slab] = (uint8)NumSlabRegions;
+		// The outer slabs (left of the first cut, right of the last) are spanned by no region
+		if (Slab > 0 && Slab < Lookup.NumCuts)
+		{
+			for (int32 i = 0; i < NumRegions; ++i)
+			{
+				const int32 Region = ByPriority[i];
+				if (Lookup.Min[Region].X <= Lookup.Cuts[Slab - 1] && Lookup.Max[Region].X >= Lookup.Cuts[Slab])
+				{
+					Lookup.SlabRegions[NumSlabRegions++] = (uint8)Region;
+				}
+			}
+		}
+	}
+	Lookup.SlabStart[Lookup.NumCuts + 1] = (uint8)NumSlabRegions;
+	return Lookup;
+}
+
+int32 FAefPharusWallRegionLookup::FindLinear(const TArray<FAefPharusWallRegion>& Regions, const FVector2D& Position)
+{
+	int32 Best = INDEX_NONE;
+	int32 BestPriority = MAX_int32;
+	for (int32 Region = 0; Region < Regions.Num(); ++Region)
+	{
+		const int32 Priority = RegionPriority(Regions[Region].WallSide);
+		if (Priority < BestPriority && Regions[Region].ContainsTrackPoint(Position))
+		{
+			Best = Region;
+			BestPriority = Priority;
+		}
+	}
+	return Best;
+}
+
+//--------------------------------------------------------------------------------
+// FAefPharusMappingTransforms
+//--------------------------------------------------------------------------------
+
+FAefPharusMappingTransforms FAefPharusMappingTransforms::Compile(const FAefPharusInstanceConfig& Config, const FVector& InRootOrigin, const FRotator& InRootRotation)
+{
+	FAefPharusMappingTransforms Transforms;
+	Transforms.RootOrigin = InRootOrigin;
+	Transforms.RootRotation = InRootRotation;
+	Transforms.Floor = FAefPharusFloorTransform::Compile(Config, InRootOrigin, InRootRotation);
+	Transforms.RegionLookup = FAefPharusWallRegionLookup::Compile(Config.WallRegions);
+
+	Transforms.NumWalls = FMath::Min(Config.WallRegions.Num(), MaxWallRegions);
+	for (int32 i = 0; i < Transforms.NumWalls; ++i)
+	{
+		Transforms.Walls[i] = FAefPharusWallTransform::Compile(Config.WallRegions[i], Config.WallRotation, InRootOrigin, InRootRotation);
+	}
+	return Transforms;
+}
@@ -0,0 +1,287 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2025
+
+   AefPharus - Compiled Coordinate Transform Tests
+
+   The compiled maps (AefPharusTransforms.h) against the per-track reference
+   chains (AefPharusMappingReference.h) they replace.
+   Run with: Automation RunTests Pharus.Transforms
+  ========================================================================*/
+
+#include "AefPharusMappingReference.h"
+#include "AefPharusTransforms.h"
+#include "AefPharusTypes.h"
+#include "Misc/AutomationTest.h"
+
+#include <limits>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AefPharusTransformsTests
+{
+	/** Largest accepted distance between a compiled and a reference position, in cm */
+	constexpr double ToleranceCm = 0.01;
+
+	/** Grid over the tracking surface (0-1, times Range) and a margin around it */
+	TArray<FVector2D> SamplePositions(const FVector2D& Range)
+	{
+		constexpr int32 Steps = 12;
+		TArray<FVector2D> Positions;
+		for (int32 Y = -1; Y <= Steps + 1; ++Y)
+		{
+			for (int32 X = -1; X <= Steps + 1; ++X)
+			{
+				Positions.Add(FVector2D(X * Range.X / Steps, Y * Range.Y / Steps));
+			}
+		}
+		return Positions;
+	}
+
+	/** Compares Actual(Position) with Expected(Position) over Positions, one error per case on deviation */
+	template <typename ExpectedFuncType, typename ActualFuncType>
+	void TestMapping(FAutomationTestBase& Test, const FString& Case, const TArray<FVector2D>& Positions, ExpectedFuncType&& Expected, ActualFuncType&& Actual)
+	{
+		double MaxDeviation = 0.0;
+		FVector2D WorstPosition = FVector2D::ZeroVector;
+		for (const FVector2D& Position : Positions)
+		{
+			const double Deviation = FVector::Dist(Expected(Position), Actual(Position));
+			if (!(Deviation <= MaxDeviation))
+			{
+				MaxDeviation = Deviation;
+				WorstPosition = Position;
+			}
+		}
+
+		if (!(MaxDeviation <= ToleranceCm))
+		{
+			Test.AddError(FString::Printf(TEXT("%s: deviates %.4f cm from the reference at (%.3f, %.3f), tolerance %.4f cm"),
+				*Case, MaxDeviation, WorstPosition.X, WorstPosition.Y, ToleranceCm));
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------
+// Floor (Simple mode)
+//--------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAefPharusFloorTransformTest, "Pharus.Transforms.FloorMapping",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAefPharusFloorTransformTest::RunTest(const FString& Parameters)
+{
+	using namespace AefPharusTransformsTests;
+
+	const FVector RootOrigin(250.0f, -120.0f, 35.0f);
+	const FRotator RootRotation(5.0f, 30.0f, -10.0f);
+	const float FloorRotations[] = { 0.0f, 37.5f, 90.0f, -120.0f };
+
+	for (const bool bNormalized : { true, false })
+	{
+		for (const bool bInvertY : { false, true })
+		{
+			for (const float FloorRotation : FloorRotations)
+			{
+				FAefPharusInstanceConfig Config;
+				Config.SimpleScale = FVector2D(1000.0f, 1500.0f);
+				Config.FloorZ = 10.0f;
+				Config.FloorRotation = FloorRotation;
+				Config.bInvertY = bInvertY;
+				Config.bUseNormalizedCoordinates = bNormalized;
+				Config.TrackingSurfaceDimensions = FVector2D(10.0f, 15.0f);
+
+				const FAefPharusFloorTransform Transform = FAefPharusFloorTransform::Compile(Config, RootOrigin, RootRotation);
+				const FString Case = FString::Printf(TEXT("%s, InvertY %d, FloorRotation %.1f"), bNormalized ? TEXT("normalized") : TEXT("absolute"), bInvertY, FloorRotation);
+
+				// World: input as received
+				TestMapping(*this, Case + TEXT(", ToWorld"), SamplePositions(bNormalized ? FVector2D(1.0f, 1.0f) : Config.TrackingSurfaceDimensions),
+					[&](const FVector2D& Position) { return AefPharusMappingReference::MapFloorPerTrack(Config, Position, RootOrigin, RootRotation); },
+					[&](const FVector2D& Position) { return Transform.ToWorld.TransformPosition(Position); });
+
+				// Local: RawPosition is normalized whatever the input was, and there is no root transform
+				FAefPharusInstanceConfig NormalizedConfig = Config;
+				NormalizedConfig.bUseNormalizedCoordinates = true;
+				TestMapping(*this, Case + TEXT(", ToLocal"), SamplePositions(FVector2D(1.0f, 1.0f)),
+					[&](const FVector2D& Position) { return AefPharusMappingReference::MapFloorPerTrack(NormalizedConfig, Position, FVector::ZeroVector, FRotator::ZeroRotator); },
+					[&](const FVector2D& Position) { return Transform.ToLocal.TransformPosition(Position); });
+			}
+		}
+	}
+
+	return true;
+}
+
+//--------------------------------------------------------------------------------
+// Wall regions (Regions mode)
+//--------------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAefPharusWallTransformTest, "Pharus.Transforms.WallMapping",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAefPharusWallTransformTest::RunTest(const FString& Parameters)
+{
+	using namespace AefPharusTransformsTests;
+
+	const FVector RootOrigin(250.0f, -120.0f, 35.0f);
+	const FRotator RootRotation(5.0f, 30.0f, -10.0f);
+	const float WallRotations[] = { 0.0f, 15.0f, -90.0f };
+	const float Rotations2D[] = { 0.0f, -15.0f, 45.0f };
+
+	// A region off the surface origin, with an Origin offset and a tilted wall
+	FAefPharusWallRegion Region;
+	Region.TrackingBounds = FBox2D(FVector2D(0.1f, 0.2f), FVector2D(0.4f, 0.9f));
+	Region.WorldPosition = FVector(1500.0f, 200.0f, 50.0f);
+	Region.WorldRotation = FRotator(10.0f, 90.0f, 5.0f);
+	Region.Scale = FVector2D(1000.0f, 400.0f);
+	Region.Origin = FVector2D(-500.0f, 20.0f);
+
+	for (const bool bInvertY : { false, true })
+	{
+		for (const float WallRotation : WallRotations)
+		{
+			for (const float Rotation2D : Rotations2D)
+			{
+				Region.bInvertY = bInvertY;
+				Region.Rotation2D = Rotation2D;
+
+				const FAefPharusWallTransform Transform = FAefPharusWallTransform::Compile(Region, WallRotation, RootOrigin, RootRotation);
+				const FString Case = FString::Printf(TEXT("InvertY %d, WallRotation %.1f, Rotation2D %.1f"), bInvertY, WallRotation, Rotation2D);
+
+				TestMapping(*this, Case + TEXT(", ToWorld"), SamplePositions(FVector2D(1.0f, 1.0f)),
+					[&](const FVector2D& Position) { return AefPharusMappingReference::MapWallPerTrack(Region, Position, RootOrigin, RootRotation, WallRotation); },
+					[&](const FVector2D& Position) { return Transform.ToWorld.TransformPosition(Position); });
+
+				// Local: same chain without the root transform, WallRotation included
+				TestMapping(*this, Case + TEXT(", ToLocal"), SamplePositions(FVector2D(1.0f, 1.0f)),
+					[&](const FVector2D& Position) { return AefPharusMappingReference::MapWallPerTrack(Region, Position, FVector::ZeroVector, FRotator::ZeroRotator, WallRotation); },
+					[&](const FVector2D& Position) { return Transform.ToLocal.TransformPosition(Position); });
+			}
+		}
+	}
+
+	return true;
+}
+
+//--------------------------------------------------------------------------------
+// Wall region lookup
+//--------------------------------------------------------------------------------
+
+namespace AefPharusTransformsTests
+{
+	FAefPharusWallRegion MakeRegion(EAefPharusWallSide WallSide, float MinX, float MinY, float MaxX, float MaxY)
+	{
+		FAefPharusWallRegion Region;
+		Region.WallSide = WallSide;
+		Region.TrackingBounds = FBox2D(FVector2D(MinX, MinY), FVector2D(MaxX, MaxY));
+		return Region;
+	}
+
+	/**
+	 * Grid in steps of 1/32 over and around the tracking surface. Region bounds in multiples of
+	 * 1/32 are exact in float, so the grid hits every edge and corner exactly.
+	 */
+	TArray<FVector2D> EdgePositions()
+	{
+		TArray<FVector2D> Positions;
+		for (int32 Y = -2; Y <= 34; ++Y)
+		{
+			for (int32 X = -2; X <= 34; ++X)
+			{
+				Positions.Add(FVector2D(X / 32.0f, Y / 32.0f));
+			}
+		}
+		return Positions;
+	}
+
+	/** Find() and FindBatch() against FindLinear() and FindLinear() against the per-track search, one error per case */
+	void TestLookup(FAutomationTestBase& Test, const FString& Case, const TArray<FAefPharusWallRegion>& Regions, const TArray<FVector2D>& Positions)
+	{
+		// The table holds the first MaxRegions regions only
+		TArray<FAefPharusWallRegion> Compiled = Regions;
+		Compiled.SetNum(FMath::Min(Regions.Num(), FAefPharusWallRegionLookup::MaxRegions));
+		const FAefPharusWallRegionLookup Lookup = FAefPharusWallRegionLookup::Compile(Regions);
+
+		TArray<int32> Batch;
+		Batch.SetNumUninitialized(Positions.Num());
+		Lookup.FindBatch(Positions, Batch);
+
+		for (int32 i = 0; i < Positions.Num(); ++i)
+		{
+			const FVector2D& Position = Positions[i];
+			const int32 Expected = AefPharusMappingReference::FindWallRegionPerTrack(Regions, Position);
+			const int32 Linear = FAefPharusWallRegionLookup::FindLinear(Regions, Position);
+			const int32 CompiledExpected = FAefPharusWallRegionLookup::FindLinear(Compiled, Position);
+			const int32 Found = Lookup.Find(Position);
+			if (Linear != Expected || Found != CompiledExpected || Batch[i] != Found)
+			{
+				Test.AddError(FString::Printf(TEXT("%s: at (%f, %f) per track %d, FindLinear %d, Find %d (expected %d), FindBatch %d"),
+					*Case, Position.X, Position.Y, Expected, Linear, Found, CompiledExpected, Batch[i]));
+				return;
+			}
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAefPharusWallRegionLookupTest, "Pharus.Transforms.WallRegionLookup",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAefPharusWallRegionLookupTest::RunTest(const FString& Parameters)
+{
+	using namespace AefPharusTransformsTests;
+
+	// Four walls side by side, sharing their edges
+	TArray<FAefPharusWallRegion> SideBySide;
+	SideBySide.Add(MakeRegion(EAefPharusWallSide::Front, 0.0f, 0.0f, 0.25f, 1.0f));
+	SideBySide.Add(MakeRegion(EAefPharusWallSide::Right, 0.25f, 0.0f, 0.5f, 1.0f));
+	SideBySide.Add(MakeRegion(EAefPharusWallSide::Back, 0.5f, 0.0f, 0.75f, 1.0f));
+	SideBySide.Add(MakeRegion(EAefPharusWallSide::Left, 0.75f, 0.0f, 1.0f, 1.0f));
+	TestLookup(*this, TEXT("side by side"), SideBySide, EdgePositions());
+
+	const FAefPharusWallRegionLookup SideBySideLookup = FAefPharusWallRegionLookup::Compile(SideBySide);
+	TestEqual(TEXT("Inside the second region"), SideBySideLookup.Find(FVector2D(0.375f, 0.5f)), 1);
+	TestEqual(TEXT("On a shared edge (bounds are exclusive)"), SideBySideLookup.Find(FVector2D(0.25f, 0.5f)), INDEX_NONE);
+	TestEqual(TEXT("On the outer bound"), SideBySideLookup.Find(FVector2D(0.125f, 0.0f)), INDEX_NONE);
+
+	// Overlapping walls, listed against their priority: Left, Back, Right, Front
+	TArray<FAefPharusWallRegion> Overlapping;
+	Overlapping.Add(MakeRegion(EAefPharusWallSide::Left, 0.0f, 0.0f, 0.625f, 0.625f));
+	Overlapping.Add(MakeRegion(EAefPharusWallSide::Back, 0.25f, 0.125f, 0.875f, 0.75f));
+	Overlapping.Add(MakeRegion(EAefPharusWallSide::Right, 0.375f, 0.25f, 1.0f, 0.875f));
+	Overlapping.Add(MakeRegion(EAefPharusWallSide::Front, 0.5f, 0.375f, 0.75f, 1.0f));
+	TestLookup(*this, TEXT("overlapping"), Overlapping, EdgePositions());
+
+	const FAefPharusWallRegionLookup OverlappingLookup = FAefPharusWallRegionLookup::Compile(Overlapping);
+	TestEqual(TEXT("All four overlap: Front"), OverlappingLookup.Find(FVector2D(0.5625f, 0.5f)), 3);
+	TestEqual(TEXT("Left, Back and Right overlap: Right"), OverlappingLookup.Find(FVector2D(0.4375f, 0.3125f)), 2);
+	TestEqual(TEXT("Left and Back overlap: Back"), OverlappingLookup.Find(FVector2D(0.3125f, 0.1875f)), 1);
+	TestEqual(TEXT("On Front's edge inside Right: Right"), OverlappingLookup.Find(FVector2D(0.5f, 0.5f)), 2);
+
+	// More regions than the table holds: Find() covers the first MaxRegions, FindLinear() all of them
+	TArray<FAefPharusWallRegion> Many;
+	const EAefPharusWallSide Sides[] = { EAefPharusWallSide::Left, EAefPharusWallSide::Back, EAefPharusWallSide::Floor, EAefPharusWallSide::Right, EAefPharusWallSide::Front };
+	for (int32 i = 0; i < FAefPharusWallRegionLookup::MaxRegions + 4; ++i)
+	{
+		const float MinX = (i % 6) / 8.0f;
+		const float MinY = (i / 6) / 4.0f;
+		Many.Add(MakeRegion(Sides[i % UE_ARRAY_COUNT(Sides)], MinX, MinY, MinX + 0.375f, MinY + 0.5f));
+	}
+	TestLookup(*this, TEXT("more than MaxRegions"), Many, EdgePositions());
+
+	// NaN and infinity are in no region
+	const float NaN = std::numeric_limits<float>::quiet_NaN();
+	const float Infinity = std::numeric_limits<float>::infinity();
+	const TArray<FVector2D> Invalid =
+	{
+		FVector2D(NaN, 0.5f), FVector2D(0.5f, NaN), FVector2D(NaN, NaN),
+		FVector2D(Infinity, 0.5f), FVector2D(-Infinity, 0.5f), FVector2D(0.5f, Infinity),
+	};
+	TestLookup(*this, TEXT("NaN and infinity"), Overlapping, Invalid);
+	for (const FVector2D& Position : Invalid)
+	{
+		TestEqual(FString::Printf(TEXT("Find(%f, %f)"), Position.X, Position.Y), OverlappingLookup.Find(Position), INDEX_NONE);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
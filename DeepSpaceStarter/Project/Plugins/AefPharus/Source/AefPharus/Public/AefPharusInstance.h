@@ -18,9 +18,65 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "AefPharusTypes.h"
+#include "AefPharusTransforms.h"
 #include "TrackLink.h"
+#include "TrackSnapshot.h"
+#include "Containers/CircularQueue.h"
+#include <atomic>
 #include "AefPharusInstance.generated.h"
 
+/**
+ * Track event handed from the network thread to the game thread
+ *
+ * Produced by the ITrackReceiver callbacks (or read from a frame snapshot), consumed by
+ * ProcessPendingOperations. Carries the track as decoded: bounds, mapping and orientation
+ * are left to the game thread's mapping stage, so the network thread neither touches the
+ * instance's track state nor maps tracks that are overwritten before the next tick.
+ */
+struct FAefPharusTrackEvent
+{
+	enum class EKind : uint8
+	{
+		New,
+		Update,
+		Lost
+	};
+
+	EKind Kind = EKind::Update;
+
+	int32 TrackID = 0;
+
+	/** Input position as received (Y flipped to UE convention) */
+	FVector2D InputPos = FVector2D::ZeroVector;
+
+	/** Heading as received (tracking space) and speed in m/s */
+	FVector2D Orientation = FVector2D::ZeroVector;
+	float Speed = 0.0f;
+
+	/** FPlatformTime::Seconds() when the track was received (TrackLostTimeout) */
+	double ReceiveTime = 0.0;
+
+	/** See pharus::TrackRecord::arrivalTimeNs */
+	int64 ArrivalTimeNs = 0;
+};
+
+/**
+ * Track event after the mapping stage (game thread)
+ */
+struct FAefPharusMappedTrackEvent
+{
+	FAefPharusTrackEvent::EKind Kind = FAefPharusTrackEvent::EKind::Update;
+
+	/** Was the track inside valid bounds? (New/Update) */
+	bool bInsideBounds = false;
+
+	/** Input position as received, for logging */
+	FVector2D InputPos = FVector2D::ZeroVector;
+
+	/** Converted track data; only TrackID and LastUpdateTime are set when outside bounds */
+	FAefPharusTrackData Data;
+};
+
 /**
  * Pharus Tracker Instance
  *
@@ -116,6 +172,31 @@ public:
 	UFUNCTION(BlueprintPure, Category = "AEF|Pharus")
 	bool IsTrackActive(int32 TrackID) const;
 
+	/**
+	 * Get fill level and overflow count of the network → game thread event queue
+	 * Overflows mean the game thread did not keep up; raise TrackEventQueueSize if they grow.
+	 */
+	UFUNCTION(BlueprintPure, Category = "AEF|Pharus|Stats")
+	FAefPharusEventQueueStats GetEventQueueStats() const;
+
+	/**
+	 * Get end-to-end latency percentiles (UDP arrival → actor transform applied)
+	 * Based on the last LatencySampleCapacity actor updates. Also available as console command Pharus.Latency.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AEF|Pharus|Stats")
+	FAefPharusLatencyStats GetLatencyStats() const;
+
+	/** Discard all latency samples collected so far */
+	UFUNCTION(BlueprintCallable, Category = "AEF|Pharus|Stats")
+	void ResetLatencyStats();
+
+	/**
+	 * Get receive path statistics (packet/byte rates, tracks per frame, malformed frames, jitter)
+	 * Rates are refreshed every NetworkStatsInterval seconds, SecondsSinceLastPacket is always current.
+	 */
+	UFUNCTION(BlueprintPure, Category = "AEF|Pharus|Stats")
+	FAefPharusNetworkStats GetNetworkStats() const;
+
 	//--------------------------------------------------------------------------------
 	// Configuration
 	//--------------------------------------------------------------------------------
@@ -168,15 +249,22 @@ public:
 	bool UpdateWallSettings(const FAefPharusInstanceConfig& NewConfig);
 
 	/**
-	 * Restart tracker with new network settings (requires LiveAdjustments enabled)
-	 * WARNING: Will disconnect, destroy all actors, and reconnect!
+	 * Switch the tracker to new network settings (requires LiveAdjustments enabled)
+	 * Binds the new socket next to the old one without blocking; the clients are swapped on the
+	 * first tick after the new socket is bound. Actors, actor pool and track state are kept;
+	 * tracks continue by ID once the new stream arrives. If the new address cannot be bound within
+	 * HotRebindBindTimeout, the switch is abandoned (logged) and the old connection kept.
 	 * @param NewBindNIC New network interface IP
 	 * @param NewUDPPort New UDP port
-	 * @return true if restart succeeded
+	 * @return true if the switch started, see IsNetworkSwitchPending(); false keeps the old connection
 	 */
 	UFUNCTION(BlueprintCallable, Category = "AEF|Pharus")
 	bool RestartWithNewNetwork(const FString& NewBindNIC, int32 NewUDPPort);
 
+	/** Is a RestartWithNewNetwork() still waiting for the new socket to bind? */
+	UFUNCTION(BlueprintPure, Category = "AEF|Pharus")
+	bool IsNetworkSwitchPending() const { return PendingRebind.IsValid(); }
+
 	/**
 	 * Set the SpawnClass for this tracker instance at runtime.
 	 * New tracks will use this class for spawning. Existing tracks are not affected.
@@ -221,6 +309,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AEF|Pharus|Debug")
 	void DebugInjectTrack(float NormalizedX, float NormalizedY, int32 TrackID = -1);
 
+	/** Where bCaptureTraffic writes captures and relative ReplayFile paths start: Saved/Pharus/Captures */
+	static FString GetCaptureDirectory();
+
 private:
 	//--------------------------------------------------------------------------------
 	// Network & Threading
@@ -235,9 +326,113 @@ private:
 	/** Persistent storage for MulticastGroup string (TrackLinkClient stores pointer to this) */
 	TArray<ANSICHAR> MulticastGroupStorage;
 
+	/**
+	 * Create a TrackLinkClient for InConfig (throws std::exception on failure)
+	 * The client keeps pointers into OutBindNIC / OutMulticastGroup, they must outlive it.
+	 */
+	TUniquePtr<pharus::TrackLinkClient> CreateTrackLinkClient(const FAefPharusInstanceConfig& InConfig, TArray<ANSICHAR>& OutBindNIC, TArray<ANSICHAR>& OutMulticastGroup) const;
+
+	/** Longest a network switch waits for the new socket to bind before it is abandoned, in seconds */
+	static constexpr double HotRebindBindTimeout = 0.5;
+
+	/** Network switch waiting for its client to bind; the active client keeps receiving meanwhile */
+	struct FPendingRebind
+	{
+		TUniquePtr<pharus::TrackLinkClient> Client;
+
+		/** The pending client points into these, the active client into BindNICStorage / MulticastGroupStorage */
+		TArray<ANSICHAR> BindNICStorage;
+		TArray<ANSICHAR> MulticastGroupStorage;
+
+		FString BindNIC;
+		int32 UDPPort = 0;
+
+		/** FPlatformTime::Seconds() after which the switch is abandoned */
+		double Deadline = 0.0;
+	};
+
+	/** Game thread only, null unless a switch is pending */
+	TUniquePtr<FPendingRebind> PendingRebind;
+
+	/** Swap in the pending client once it is bound, or drop it after HotRebindBindTimeout */
+	void UpdatePendingRebind();
+
+	/** Replace the active client with the bound pending one */
+	void CompleteRebind();
+
+	/** Callback mode: tracks kept across a network switch the new stream has not reported yet (game thread only) */
+	TSet<int32> RebindUnconfirmedTracks;
+
+	/** Callback mode: client frame count after which unconfirmed tracks are treated as lost */
+	uint64 RebindReconcileFrame = 0;
+
+	/** Treat tracks kept across a network switch that the new stream did not report as lost */
+	void ReconcileAfterRebind();
+
 	/** Is this instance currently running? */
 	bool bIsRunning;
 
+	/**
+	 * Track events from the network thread (single producer) to the game thread (single consumer)
+	 * Created before and destroyed after TrackLinkClient, so the producer never sees it invalid.
+	 */
+	TUniquePtr<TCircularQueue<FAefPharusTrackEvent>> TrackEventQueue;
+
+	/** Requested capacity of TrackEventQueue */
+	int32 TrackEventQueueCapacity = 0;
+
+	/** Events dropped because TrackEventQueue was full (written by the network thread) */
+	std::atomic<int32> TrackEventOverflows{0};
+
+	/** Highest TrackEventQueue fill level seen (written by the network thread) */
+	std::atomic<int32> TrackEventHighWater{0};
+
+	/** Overflow count already reported to the log (game thread only) */
+	int32 LastReportedOverflows = 0;
+
+	/** New/Update events received since the last tick, latest one per track, in arrival order (game thread only) */
+	TArray<FAefPharusTrackEvent> StagedTracks;
+
+	/** TrackID → index into StagedTracks */
+	TMap<int32, int32> StagedTrackIndices;
+
+	/** Normalized positions and wall regions of StagedTracks, kept between ticks to avoid allocations */
+	TArray<FVector2D> StagedPositions;
+	TArray<int32> StagedRegionIndices;
+
+	/** Events superseded by a newer one of the same track before they were mapped (game thread only) */
+	int32 CoalescedTrackEvents = 0;
+
+	/** Kernel socket drop count already reported to the log (game thread only) */
+	uint64 LastReportedKernelDrops = 0;
+
+	/** Compares consecutive frame snapshots (bUseFrameSnapshots, game thread only) */
+	pharus::TrackSnapshotDiff SnapshotDiff;
+
+	/** Latency samples kept for GetLatencyStats() */
+	static constexpr int32 LatencySampleCapacity = 4096;
+
+	/** Ring of the most recent latencies in ms (game thread only) */
+	TArray<float> LatencySamplesMs;
+
+	/** Next ring slot to overwrite once LatencySamplesMs is full */
+	int32 LatencySampleNext = 0;
+
+	/** Record the latency of an actor update whose frame arrived at ArrivalTimeNs */
+	void RecordLatencySample(int64 ArrivalTimeNs);
+
+	/** Latest network statistics sample (game thread only) */
+	FAefPharusNetworkStats NetworkStats;
+
+	/** Client counters at the previous sample, rates are computed from the difference */
+	pharus::TrackLinkStatistics LastNetworkCounters;
+
+	/** FPlatformTime::Seconds() of the previous sample */
+	double LastNetworkSampleTime = 0.0;
+
+	/** Read the client counters, update NetworkStats and log it if bLogNetworkStats */
+	void SampleNetworkStats(double Now);
+
 	//--------------------------------------------------------------------------------
 	// Configuration & Context
 	//--------------------------------------------------------------------------------
@@ -266,69 +461,79 @@ private:
 	UPROPERTY()
 	TMap<int32, AActor*> SpawnedActors;
 
-	/** Track data cache for Blueprint access */
+	/** Track data cache for Blueprint access (game thread only) */
 	TMap<int32, FAefPharusTrackData> TrackDataCache;
 
 	/** Mutex for thread-safe actor spawning */
 	mutable FCriticalSection ActorSpawnMutex;
 
-	/** Pending spawn operations (processed on game thread) */
-	TArray<int32> PendingSpawns;
-	TArray<int32> PendingUpdates;
-	TArray<int32> PendingRemovals;
+	/** Pending actor operations collected from the event queue (game thread only) */
+	TSet<int32> PendingSpawns;
+	TSet<int32> PendingUpdates;
+	TSet<int32> PendingRemovals;
 
-	/** Tracks that are known but currently outside valid bounds (no actor spawned) */
+	/** Tracks that are known but currently outside valid bounds (no actor spawned, game thread only) */
 	TSet<int32> TracksOutsideBounds;
 
-	/** Mutex for pending operation lists */
-	mutable FCriticalSection PendingOperationsMutex;
-
 	//--------------------------------------------------------------------------------
 	// Coordinate Transformation
 	//--------------------------------------------------------------------------------
 
+	/** Floor and wall region mappings compiled from Config and the root origin (game thread only) */
+	FAefPharusMappingTransforms Transforms;
+
+	/** Owning subsystem's root transform snapshot (set in Initialize(), outlives this instance) */
+	const TAefPharusSeqLock<FAefPharusRootTransform>* RootTransformSource = nullptr;
+
+	/** Root transform the mappings were last compiled with (game thread) */
+	FAefPharusRootTransform RootTransform;
+
 	/**
-	 * Transform 2D tracking position to 3D world position
-	 * Dispatches to appropriate mapping mode handler
+	 * Recompile the floor and wall region mappings (game thread)
+	 * @param bForce Recompile even if the root origin did not move (Config changed)
 	 */
-	FVector TrackToWorld(const FVector2D& TrackPos, const pharus::TrackRecord& Track) const;
+	void RefreshTransforms(bool bForce);
 
 	/**
-	 * Floor mapping: Direct 2D→3D with scale and offset
-	 * Uses global root origin from subsystem
+	 * Transform 2D tracking position to 3D world position
+	 * Dispatches to appropriate mapping mode handler
+	 * @param InputPos Input position as received
+	 * @param NormalizedPos The same, normalized (NormalizeTrackPosition)
+	 * @param RegionIndex Wall region containing NormalizedPos (Regions mode, FindWallRegionIndex)
 	 */
-	FVector TrackToWorldFloor(const FVector2D& TrackPos) const;
+	FVector TrackToWorld(const FVector2D& InputPos, const FVector2D& NormalizedPos, int32 RegionIndex) const;
 
 	/**
-	 * Get the global root origin from the owning subsystem
-	 * @return Global origin in world space (cm)
+	 * Floor mapping: Direct 2D→3D with scale and offset
+	 * Uses the compiled floor transform (global root origin included)
 	 */
-	FVector GetRootOrigin() const;
+	FVector TrackToWorldFloor(const FVector2D& InputPos) const;
 
 	/**
-	 * Get the global root origin rotation from the owning subsystem
-	 * @return Global rotation in world space
+	 * Regions mapping: transform to 3D through the already assigned wall region
 	 */
-	FRotator GetRootOriginRotation() const;
+	FVector TrackToWorldRegions(const FVector2D& NormalizedPos, int32 RegionIndex) const;
 
 	/**
-	 * Regions mapping: Determine wall and transform to 3D
+	 * Find which wall region contains the given track point
+	 * Overlaps resolve Front > Right > Back > Left; allocation-free (compiled region lookup)
+	 * @param TrackPos Normalized tracking position (0-1)
+	 * @return Index into Config.WallRegions, INDEX_NONE if no region contains the point
 	 */
-	FVector TrackToWorldRegions(const FVector2D& TrackPos, EAefPharusWallSide& OutWall) const;
+	int32 FindWallRegionIndex(const FVector2D& TrackPos) const;
 
 	/**
-	 * Find which wall region contains the given track point
+	 * Wall region assigned to a track by ConvertTrackData (no lookup)
 	 */
-	const FAefPharusWallRegion* FindWallRegion(const FVector2D& TrackPos) const;
+	const FAefPharusWallRegion* GetAssignedWallRegion(const FAefPharusTrackData& TrackData) const;
 
 	/**
 	 * Transform 2D tracking position to LOCAL 3D position (relative to RootOriginActor)
 	 * Used when bUseRelativeSpawning=true - skips RootOrigin/RootRotation application
-	 * @param TrackPos Tracking position
-	 * @param Track Track record for wall region lookup
+	 * @param TrackData Converted track (RawPosition, and AssignedRegionIndex in Regions mode)
 	 * @return Local position relative to RootOriginActor
 	 */
-	FVector TrackToLocal(const FVector2D& TrackPos, const pharus::TrackRecord& Track) const;
+	FVector TrackToLocal(const FAefPharusTrackData& TrackData) const;
 
 	/**
 	 * Floor mapping: Calculate LOCAL position (no RootOrigin/RootRotation)
@@ -336,9 +541,9 @@ private:
 	FVector TrackToLocalFloor(const FVector2D& TrackPos) const;
 
 	/**
-	 * Regions mapping: Calculate LOCAL position (no RootOrigin/RootRotation)
+	 * Regions mapping: Calculate LOCAL position (no RootOrigin/RootRotation) in the track's assigned region
 	 */
-	FVector TrackToLocalRegions(const FVector2D& TrackPos, EAefPharusWallSide& OutWall) const;
+	FVector TrackToLocalRegions(const FAefPharusTrackData& TrackData) const;
 
 	//--------------------------------------------------------------------------------
 	// Bounds Validation
@@ -391,17 +596,57 @@ private:
 	/** Tick delegate handle */
 	FTSTicker::FDelegateHandle TickDelegateHandle;
 
+	//--------------------------------------------------------------------------------
+	// Track Events
+	//--------------------------------------------------------------------------------
+
+	/**
+	 * Build a track event from a received record (network thread)
+	 * Copies the decoded values only, touches no instance state.
+	 */
+	static FAefPharusTrackEvent MakeTrackEvent(FAefPharusTrackEvent::EKind Kind, const pharus::TrackRecord& Track);
+
+	/**
+	 * Push an event to the game thread (network thread, never blocks)
+	 * Counts the event as overflow if the queue is full.
+	 */
+	void EnqueueTrackEvent(const FAefPharusTrackEvent& Event);
+
+	/**
+	 * Take an event into the mapping stage (game thread only)
+	 * New/Update replace an earlier event of the same track that is not mapped yet; Lost is
+	 * applied at once and drops it.
+	 */
+	void StageTrackEvent(const FAefPharusTrackEvent& Event);
+
+	/**
+	 * Mapping stage: bounds check, world position and orientation of all staged tracks in one
+	 * pass, then apply them in arrival order (game thread only, once per tick)
+	 */
+	void MapStagedTracks();
+
+	/**
+	 * Apply one mapped event to the track state and pending operations (game thread only)
+	 */
+	void ApplyTrackEvent(const FAefPharusMappedTrackEvent& Event);
+
+	/**
+	 * Apply the latest frame snapshot, if there is a new one (game thread only)
+	 * Lost tracks are applied first, then new, then updated ones.
+	 */
+	void ApplyFrameSnapshot();
+
 	//--------------------------------------------------------------------------------
 	// Helpers
 	//--------------------------------------------------------------------------------
 
 	/**
-	 * Convert Pharus TrackRecord to FAefPharusTrackData
-	 * @param Track The pharus track record
-	 * @param WorldPos Calculated world position
-	 * @param InputPos Input tracking coordinates (will be normalized if needed for RawPosition)
+	 * Convert a received track inside valid bounds to FAefPharusTrackData (world position, orientation, wall)
+	 * @param Event The received track
+	 * @param NormalizedPos Event.InputPos normalized (becomes RawPosition)
+	 * @param RegionIndex Wall region containing NormalizedPos (Regions mode)
 	 */
-	FAefPharusTrackData ConvertTrackData(const pharus::TrackRecord& Track, const FVector& WorldPos, const FVector2D& InputPos) const;
+	FAefPharusTrackData ConvertTrackData(const FAefPharusTrackEvent& Event, const FVector2D& NormalizedPos, int32 RegionIndex) const;
 
 	/**
 	 * Get FRotator from movement direction (Floor mode - Yaw rotation around World Z)
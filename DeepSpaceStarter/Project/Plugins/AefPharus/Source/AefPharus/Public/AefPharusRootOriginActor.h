@@ -58,7 +58,7 @@ class UAefPharusSubsystem;
  * - Duplicate actors log an error and are ignored
  *
  * Dynamic Origin:
- * - Actor position is queried every frame via GetRootOrigin()
+ * - Actor position is sampled once per frame by the subsystem (GetRootTransformSnapshot())
  * - Useful for moving stages, tracking on vehicles, etc.
  * - For static origin, use SetRootOrigin() API or GlobalOrigin config instead
  */
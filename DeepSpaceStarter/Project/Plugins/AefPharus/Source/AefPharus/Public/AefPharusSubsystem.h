@@ -17,6 +17,8 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "AefPharusTypes.h"
 #include "AefPharusInstance.h"
+#include "Containers/Ticker.h"
+#include "TrackLinkReactor.h"
 #include "AefPharusSubsystem.generated.h"
 
 // Forward declaration
@@ -269,6 +271,33 @@ public:
 	UFUNCTION(BlueprintPure, Category = "AEF|Pharus|Origin")
 	bool IsRelativeSpawningActive() const;
 
+	/**
+	 * Root origin, rotation and relative spawning as published for the current game frame
+	 * Safe from any thread; never touches the RootOriginActor
+	 */
+	FAefPharusRootTransform GetRootTransformSnapshot() const { return PublishedRootTransform.Read(); }
+
+	/** The seqlock behind GetRootTransformSnapshot(), for instances (lives as long as the subsystem) */
+	const TAefPharusSeqLock<FAefPharusRootTransform>& GetPublishedRootTransform() const { return PublishedRootTransform; }
+
+	//--------------------------------------------------------------------------------
+	// Network I/O
+	//--------------------------------------------------------------------------------
+
+	/**
+	 * Get the shared network I/O reactor servicing all tracker instances
+	 * @return Reactor, or nullptr if NetworkIOThreads=0 (one receive thread per instance)
+	 */
+	pharus::TrackLinkReactor* GetNetworkReactor() const;
+
+	/**
+	 * Thread options for a Pharus network thread
+	 * @param Priority Scheduling priority
+	 * @param AffinityMask Logical cores, one bit per core, 0 = any; bits beyond the available cores are dropped
+	 * @param ThreadName Name shown in Unreal Insights (empty = default of the receiver)
+	 */
+	static pharus::TrackLinkThreadOptions MakeNetworkThreadOptions(EAefPharusThreadPriority Priority, int64 AffinityMask, const FString& ThreadName = FString());
+
 private:
 	// Debugging
 	bool bIsPharusDebug;
@@ -294,6 +323,16 @@ private:
 	/** Flag to track if delayed init has been executed */
 	bool bDelayedInitExecuted = false;
 
+	/** Number of shared network I/O threads ([PharusSubsystem] NetworkIOThreads, 0 = one thread per instance) */
+	int32 NetworkIOThreads = 1;
+
+	/** Priority and core affinity of the shared network I/O threads ([PharusSubsystem] NetworkIOThreadPriority / NetworkIOThreadAffinityMask) */
+	EAefPharusThreadPriority NetworkIOThreadPriority = EAefPharusThreadPriority::Normal;
+	int64 NetworkIOThreadAffinityMask = 0;
+
+	/** Shared network I/O reactor (must outlive all instances' TrackLink clients) */
+	TUniquePtr<pharus::TrackLinkReactor> NetworkReactor;
+
 	//--------------------------------------------------------------------------------
 	// Root Origin State
 	//--------------------------------------------------------------------------------
@@ -316,6 +355,24 @@ private:
 	UPROPERTY()
 	TWeakObjectPtr<AAefPharusRootOriginActor> PharusRootOriginActor;
 
+	/** Root transform published once per game frame (read by instances, any thread) */
+	TAefPharusSeqLock<FAefPharusRootTransform> PublishedRootTransform;
+
+	/** Last published value (game thread) */
+	FAefPharusRootTransform RootTransform;
+
+	/** Ticker that publishes the root transform every frame */
+	FTSTicker::FDelegateHandle RootTransformTickHandle;
+
+	/**
+	 * Sample the root origin (actor or static) and publish it if it changed (game thread)
+	 * Called every frame and right after anything that changes the root origin
+	 */
+	void PublishRootTransform();
+
+	/** FTSTicker callback for PublishRootTransform() */
+	bool TickRootTransform(float DeltaTime);
+
 	//--------------------------------------------------------------------------------
 	// Configuration Loading
 	//--------------------------------------------------------------------------------
@@ -344,6 +401,34 @@ private:
 	 */
 	TArray<FAefPharusWallRegion> ParseWallRegionsFromIni(const FString& BaseSectionName) const;
 
+	/**
+	 * Parse "<Prefix>Priority" and "<Prefix>AffinityMask" (decimal or 0x hex) from INI
+	 * @param SectionName INI section name
+	 * @param ConfigPath INI file
+	 * @param Prefix Key prefix (e.g., "ReceiveThread")
+	 * Keys that are missing or invalid leave the output values unchanged
+	 */
+	static void ParseThreadSettingsFromIni(const FString& SectionName, const FString& ConfigPath, const TCHAR* Prefix,
+		EAefPharusThreadPriority& OutPriority, int64& OutAffinityMask);
+
+	/**
+	 * Parse "BridgeMode" and "BridgeName" from INI
+	 * @param SectionName INI section name
+	 * @param ConfigPath INI file
+	 * Keys that are missing or invalid leave the output values unchanged
+	 */
+	static void ParseBridgeSettingsFromIni(const FString& SectionName, const FString& ConfigPath,
+		EAefPharusBridgeMode& OutMode, FString& OutName);
+
+	/**
+	 * Parse "Protocol" and "TuioAreaSize" (X=...,Y=...) from INI
+	 * @param SectionName INI section name
+	 * @param ConfigPath INI file
+	 * Keys that are missing or invalid leave the output values unchanged
+	 */
+	static void ParseProtocolSettingsFromIni(const FString& SectionName, const FString& ConfigPath,
+		EAefPharusProtocol& OutProtocol, FVector2D& OutTuioAreaSize);
+
 	/**
 	 * Parse a single wall region from INI
 	 * @param SectionName Section name (e.g., "Pharus.Wall")
@@ -0,0 +1,229 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2025
+
+   AefPharus - Compiled Coordinate Transforms
+
+   The mapping from tracking coordinates to world space (normalization,
+   InvertY, scale, 2D rotation, wall placement, root origin) is linear in the
+   track position. It is compiled into an affine map whenever its inputs
+   change, so mapping a track costs two multiply-adds instead of the whole chain.
+  ========================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+#include <utility>
+
+struct FAefPharusInstanceConfig;
+struct FAefPharusWallRegion;
+
+/**
+ * Affine map from a 2D tracking position to a 3D position
+ *
+ *   Result = Origin + AxisX * Position.X + AxisY * Position.Y
+ */
+struct AEFPHARUS_API FAefPharusTrackAffine
+{
+	FVector Origin = FVector::ZeroVector;
+	FVector AxisX = FVector::ForwardVector;
+	FVector AxisY = FVector::RightVector;
+
+	FORCEINLINE FVector TransformPosition(const FVector2D& Position) const
+	{
+		return Origin + AxisX * Position.X + AxisY * Position.Y;
+	}
+
+	/** This map followed by a rotation and a translation (e.g. the root origin) */
+	FAefPharusTrackAffine Then(const FRotator& Rotation, const FVector& Translation) const;
+};
+
+/**
+ * Floor (Simple mode) mapping of an instance, compiled from its config and the root origin
+ */
+struct AEFPHARUS_API FAefPharusFloorTransform
+{
+	/** Input position as received (normalized or meters, see bUseNormalizedCoordinates) → world */
+	FAefPharusTrackAffine ToWorld;
+
+	/** RawPosition (always normalized) → local to the root origin actor (relative spawning) */
+	FAefPharusTrackAffine ToLocal;
+
+	/** Track orientation → floor orientation (InvertY, FloorRotation): X * OrientationX + Y * OrientationY */
+	FVector2D OrientationX = FVector2D(1.0f, 0.0f);
+	FVector2D OrientationY = FVector2D(0.0f, 1.0f);
+
+	FORCEINLINE FVector2D TransformOrientation(const FVector2D& Orientation) const
+	{
+		return OrientationX * Orientation.X + OrientationY * Orientation.Y;
+	}
+
+	/** Compile the floor mapping of Config placed at the root origin */
+	static FAefPharusFloorTransform Compile(const FAefPharusInstanceConfig& Config, const FVector& RootOrigin, const FRotator& RootRotation);
+};
+
+/**
+ * Regions mode mapping of one wall region, compiled from the region and the root origin
+ *
+ * Both maps take the position normalized to the whole tracking surface (0-1) and include
+ * the region bounds, InvertY, Scale, WallRotation + Rotation2D, Origin, WorldRotation and
+ * WorldPosition.
+ */
+struct AEFPHARUS_API FAefPharusWallTransform
+{
+	/** Normalized tracking position → world */
+	FAefPharusTrackAffine ToWorld;
+
+	/** Normalized tracking position → local to the root origin actor (relative spawning) */
+	FAefPharusTrackAffine ToLocal;
+
+	static FAefPharusWallTransform Compile(const FAefPharusWallRegion& Region, float GlobalWallRotation, const FVector& RootOrigin, const FRotator& RootRotation);
+};
+
+/**
+ * Wall region lookup compiled from the region bounds, with the Front > Right > Back > Left
+ * priority for overlapping regions already resolved
+ *
+ * The X axis is cut at every region's Min.X and Max.X; each slab between two cuts lists the
+ * regions spanning it in priority order. A lookup finds the slab and returns the first listed
+ * region that contains the point (same strict bounds test as FAefPharusWallRegion::ContainsTrackPoint).
+ * Nothing is allocated.
+ */
+struct AEFPHARUS_API FAefPharusWallRegionLookup
+{
+	/** Regions beyond this are not in the table, see FindLinear() */
+	static constexpr int32 MaxRegions = 8;
+
+	/** @return Index of the region containing Position, INDEX_NONE if there is none */
+	int32 Find(const FVector2D& Position) const;
+
+	/** Find() for every position, e.g. all tracks of a frame. OutRegionIndices must be as long as Positions */
+	void FindBatch(TArrayView<const FVector2D> Positions, TArrayView<int32> OutRegionIndices) const;
+
+	/** Compile the first MaxRegions regions */
+	static FAefPharusWallRegionLookup Compile(const TArray<FAefPharusWallRegion>& Regions);
+
+	/** Same result as Find() for any number of regions, by testing each of them (no allocation either) */
+	static int32 FindLinear(const TArray<FAefPharusWallRegion>& Regions, const FVector2D& Position);
+
+private:
+	static constexpr int32 MaxCuts = 2 * MaxRegions;
+
+	/** Region bounds, by region index */
+	FVector2D Min[MaxRegions];
+	FVector2D Max[MaxRegions];
+
+	/** Sorted distinct Min.X / Max.X of all regions; slab S lies between Cuts[S - 1] and Cuts[S] */
+	double Cuts[MaxCuts];
+	int32 NumCuts = 0;
+
+	/** Regions spanning slab S, by priority: SlabRegions[SlabStart[S]] .. SlabRegions[SlabStart[S + 1] - 1] */
+	uint8 SlabStart[MaxCuts + 2] = {};
+	uint8 SlabRegions[(MaxCuts + 1) * MaxRegions];
+};
+
+/**
+ * Global root origin as the subsystem publishes it once per game frame
+ *
+ * Sampled on the game thread from the root origin actor or the static origin, so readers never
+ * touch the actor. Generation changes whenever one of the values does.
+ */
+struct AEFPHARUS_API FAefPharusRootTransform
+{
+	FVector Origin = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	/** UseRelativeSpawning, UsePharusRootOriginActor and a registered actor */
+	bool bRelativeSpawning = false;
+
+	uint32 Generation = 0;
+};
+
+/**
+ * Everything an instance maps tracks with, compiled from its config and the root origin
+ *
+ * Fixed size and trivially copyable: recompiling allocates nothing.
+ */
+struct AEFPHARUS_API FAefPharusMappingTransforms
+{
+	/** Wall regions beyond this are mapped through FAefPharusWallRegion::TrackToWorld() */
+	static constexpr int32 MaxWallRegions = FAefPharusWallRegionLookup::MaxRegions;
+
+	FAefPharusFloorTransform Floor;
+
+	/** Region of a normalized tracking position (first MaxWallRegions regions) */
+	FAefPharusWallRegionLookup RegionLookup;
+
+	/** Same order as FAefPharusInstanceConfig::WallRegions */
+	FAefPharusWallTransform Walls[MaxWallRegions];
+	int32 NumWalls = 0;
+
+	/** Root transform the world maps were compiled with */
+	FVector RootOrigin = FVector::ZeroVector;
+	FRotator RootRotation = FRotator::ZeroRotator;
+
+	/** Compiled wall region, nullptr if RegionIndex is not compiled */
+	FORCEINLINE const FAefPharusWallTransform* FindWall(int32 RegionIndex) const
+	{
+		return RegionIndex >= 0 && RegionIndex < FMath::Min(NumWalls, MaxWallRegions) ? &Walls[RegionIndex] : nullptr;
+	}
+
+	static FAefPharusMappingTransforms Compile(const FAefPharusInstanceConfig& Config, const FVector& InRootOrigin, const FRotator& InRootRotation);
+};
+
+/**
+ * Single-writer seqlock around a trivially copyable value
+ *
+ * The writer never waits; a reader copies the value and copies it again if the
+ * writer changed it meanwhile. Meant for values written rarely and read often from
+ * other threads (the root transform the subsystem publishes every frame).
+ *
+ * Read(Func) runs Func on the shared value instead of copying all of it. Func may see
+ * a half-written value (its result is then discarded and Func runs again), so it must
+ * not follow pointers or indices out of the value without checking them.
+ */
+template <typename T>
+class TAefPharusSeqLock
+{
+public:
+	/** Only ever called from one thread at a time */
+	void Write(const T& InValue)
+	{
+		const uint32 Sequence = Version.load(std::memory_order_relaxed);
+		Version.store(Sequence + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		Value = InValue;
+		Version.store(Sequence + 2, std::memory_order_release);
+	}
+
+	T Read() const
+	{
+		return Read([](const T& Shared) { return Shared; });
+	}
+
+	template <typename FuncType>
+	auto Read(FuncType&& Func) const -> decltype(Func(std::declval<const T&>()))
+	{
+		uint32 Before;
+		uint32 After;
+		for (;;)
+		{
+			Before = Version.load(std::memory_order_acquire);
+			if ((Before & 1) == 0)
+			{
+				auto Result = Func(Value);
+				std::atomic_thread_fence(std::memory_order_acquire);
+				After = Version.load(std::memory_order_relaxed);
+				if (Before == After)
+				{
+					return Result;
+				}
+			}
+		}
+	}
+
+private:
+	/** Odd while the writer changes Value */
+	std::atomic<uint32> Version{0};
+	T Value;
+};
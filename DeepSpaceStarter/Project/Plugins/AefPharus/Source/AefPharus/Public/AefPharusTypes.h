@@ -15,6 +15,7 @@
 #include "CoreMinimal.h"
 #include "Engine/EngineTypes.h"
 #include "AefPharus.h"
+#include "AefPharusTransforms.h"
 #include "AefPharusTypes.generated.h"
 
 //--------------------------------------------------------------------------------
@@ -44,6 +45,47 @@ enum class EAefPharusWallSide : uint8
 	Ceiling		UMETA(DisplayName = "Ceiling")
 };
 
+/** Scheduling priority of the network receive threads (maps to EThreadPriority) */
+UENUM(BlueprintType)
+enum class EAefPharusThreadPriority : uint8
+{
+	Lowest				UMETA(DisplayName = "Lowest"),
+	BelowNormal			UMETA(DisplayName = "Below Normal"),
+	SlightlyBelowNormal	UMETA(DisplayName = "Slightly Below Normal"),
+	Normal				UMETA(DisplayName = "Normal"),
+	AboveNormal			UMETA(DisplayName = "Above Normal"),
+	Highest				UMETA(DisplayName = "Highest"),
+	TimeCritical		UMETA(DisplayName = "Time Critical")
+};
+
+/** Role of an instance in the shared-memory track bridge between processes on one host (maps to pharus::BridgeMode) */
+UENUM(BlueprintType)
+enum class EAefPharusBridgeMode : uint8
+{
+	/** Receive from the network, share nothing */
+	Off			UMETA(DisplayName = "Off"),
+
+	/** Receive from the network and publish every frame for the other processes */
+	Publish		UMETA(DisplayName = "Publish"),
+
+	/** Never open a socket, read the frames another process publishes */
+	Subscribe	UMETA(DisplayName = "Subscribe"),
+
+	/** Publish if no other process does, otherwise subscribe; take over when the publisher quits */
+	Auto		UMETA(DisplayName = "Auto")
+};
+
+/** Protocol the tracker sends on the instance's port (maps to pharus::TrackProtocol) */
+UENUM(BlueprintType)
+enum class EAefPharusProtocol : uint8
+{
+	/** Pharus' binary TrackLink frames (tracklink sender) */
+	TrackLink	UMETA(DisplayName = "TrackLink"),
+
+	/** TUIO 1.1 over OSC: /tuio/2Dcur, /tuio/2Dobj, /tuio/2Dblb (tuiosender or any TUIO tracker) */
+	Tuio		UMETA(DisplayName = "TUIO")
+};
+
 //--------------------------------------------------------------------------------
 // DATA STRUCTURES
 //--------------------------------------------------------------------------------
@@ -112,6 +154,9 @@ struct AEFPHARUS_API FAefPharusWallRegion
 	 * - (1,1) = top-right corner of wall
 	 * - Origin offset shifts the coordinate system (like Floor SimpleOrigin)
 	 * 
+	 * Compiles the region on every call; instances map through FAefPharusMappingTransforms,
+	 * which compiles it once (see FAefPharusWallTransform::Compile for the steps).
+	 * 
 	 * @param TrackPos Normalized tracking position (0-1 within full tracking surface)
 	 * @param RootOrigin Global root origin from subsystem
 	 * @param RootRotation Global root rotation from subsystem
@@ -120,83 +165,7 @@ struct AEFPHARUS_API FAefPharusWallRegion
 	 */
 	FVector TrackToWorld(const FVector2D& TrackPos, const FVector& RootOrigin, const FRotator& RootRotation, float GlobalWallRotation = 0.0f) const
 	{
-		// Step 1: Normalize position within region bounds (0-1)
-		FVector2D RegionSize = TrackingBounds.GetSize();
-		FVector2D LocalPos = (TrackPos - TrackingBounds.Min) / RegionSize;
-
-		UE_LOG(LogAefPharus, Verbose, TEXT("  [Wall Transform Step 1] LocalPos within region: %s (TrackPos=%s, Bounds.Min=%s, RegionSize=%s)"),
-			*LocalPos.ToString(), *TrackPos.ToString(), *TrackingBounds.Min.ToString(), *RegionSize.ToString());
-
-		// Step 2: Apply InvertY if enabled
-		if (bInvertY)
-		{
-			LocalPos.Y = 1.0f - LocalPos.Y;  // Flip Y: 0→1, 1→0
-			UE_LOG(LogAefPharus, Verbose, TEXT("  [Wall Transform Step 2] After InvertY: %s"), *LocalPos.ToString());
-		}
-
-		// Step 3: Apply scale FIRST (converts 0-1 to actual wall dimensions in cm)
-		// This must happen BEFORE rotation to match Floor behavior
-		FVector2D ScaledPos = LocalPos * Scale;
-
-		UE_LOG(LogAefPharus, Verbose, TEXT("  [Wall Transform Step 3] After Scale: %s (Scale=%s)"),
-			*ScaledPos.ToString(), *Scale.ToString());
-
-		// Step 4: Apply GLOBAL wall rotation AFTER scale (from Config.WallRotation)
-		// This is analogous to FloorRotation for floor tracking
-		// Applied on scaled coordinates (cm), consistent with Floor behavior
-		float TotalRotation = GlobalWallRotation + Rotation2D;
-		if (!FMath::IsNearlyZero(TotalRotation))
-		{
-			float RotationRad = FMath::DegreesToRadians(TotalRotation);
-			float CosRot = FMath::Cos(RotationRad);
-			float SinRot = FMath::Sin(RotationRad);
-
-			FVector2D RotatedPos;
-			RotatedPos.X = ScaledPos.X * CosRot - ScaledPos.Y * SinRot;
-			RotatedPos.Y = ScaledPos.X * SinRot + ScaledPos.Y * CosRot;
-			ScaledPos = RotatedPos;
-
-			UE_LOG(LogAefPharus, Verbose, TEXT("  [Wall Transform Step 4] After 2D Rotation (Global=%.1f° + Region=%.1f° = %.1f°): %s"), 
-				GlobalWallRotation, Rotation2D, TotalRotation, *ScaledPos.ToString());
-		}
-
-		// Step 5: Apply Origin offset (consistent with Floor mapping)
-		// Origin shifts the coordinate system relative to wall anchor point
-		// For corner-based mapping: Origin=(0,0) means (0,0) maps to wall corner
-		// For center-based mapping: Origin=(-Scale/2) shifts (0,0) to corner
-		FVector2D OffsetPos = ScaledPos + Origin;
-
-		UE_LOG(LogAefPharus, Verbose, TEXT("  [Wall Transform Step 5] After Origin offset: %s (Origin=%s)"),
-			*OffsetPos.ToString(), *Origin.ToString());
-
-		// Step 6: Build 3D position on wall plane
-		// Wall local space: X=horizontal along wall, Y=0 (wall surface), Z=vertical
-		FVector LocalWallPos(OffsetPos.X, 0.0f, OffsetPos.Y);
-
-		UE_LOG(LogAefPharus, Verbose, TEXT("  [Wall Transform Step 6] LocalWallPos (wall-local): %s"), *LocalWallPos.ToString());
-
-		// Step 7: Apply wall's own rotation to get wall-relative world position
-		// WorldRotation defines how this specific wall is oriented
-		FVector WallRotatedPos = WorldRotation.RotateVector(LocalWallPos);
-		
-		// Step 8: Add wall's WorldPosition to get position in wall's local coordinate system
-		FVector WallLocalWorld = WorldPosition + WallRotatedPos;
-
-		UE_LOG(LogAefPharus, Verbose, TEXT("  [Wall Transform Step 7-8] WallRotatedPos=%s, WallLocalWorld=%s"),
-			*WallRotatedPos.ToString(), *WallLocalWorld.ToString());
-
-		// Step 9: Apply global root rotation to entire wall system
-		// This rotates the wall position around the root origin
-		// Full 3D rotation is applied to support tilted stages and complex setups
-		FVector GlobalRotatedPos = RootRotation.RotateVector(WallLocalWorld);
-
-		// Step 10: Add root origin to get final world position
-		FVector WorldPos = RootOrigin + GlobalRotatedPos;
-
-		UE_LOG(LogAefPharus, Verbose, TEXT("  [Wall Transform Step 9-10] RootRotation=%s, GlobalRotated=%s, Final=%s"),
-			*RootRotation.ToString(), *GlobalRotatedPos.ToString(), *WorldPos.ToString());
-
-		return WorldPos;
+		return FAefPharusWallTransform::Compile(*this, GlobalWallRotation, RootOrigin, RootRotation).ToWorld.TransformPosition(TrackPos);
 	}
 
 	/**
@@ -210,53 +179,7 @@ struct AEFPHARUS_API FAefPharusWallRegion
 	 */
 	FVector TrackToLocal(const FVector2D& TrackPos, float GlobalWallRotation = 0.0f) const
 	{
-		// Steps 1-8 are identical to TrackToWorld (region normalization, wall transform)
-		
-		// Step 1: Normalize position within region bounds (0-1)
-		FVector2D RegionSize = TrackingBounds.GetSize();
-		FVector2D LocalPos = (TrackPos - TrackingBounds.Min) / RegionSize;
-
-		// Step 2: Apply InvertY if enabled
-		if (bInvertY)
-		{
-			LocalPos.Y = 1.0f - LocalPos.Y;
-		}
-
-		// Step 3: Apply scale FIRST (converts 0-1 to actual wall dimensions in cm)
-		// This must happen BEFORE rotation to match Floor behavior
-		FVector2D ScaledPos = LocalPos * Scale;
-
-		// Step 4: Apply global + per-region 2D rotation AFTER scale
-		float TotalRotation = GlobalWallRotation + Rotation2D;
-		if (!FMath::IsNearlyZero(TotalRotation))
-		{
-			float RotationRad = FMath::DegreesToRadians(TotalRotation);
-			float CosRot = FMath::Cos(RotationRad);
-			float SinRot = FMath::Sin(RotationRad);
-
-			FVector2D RotatedPos;
-			RotatedPos.X = ScaledPos.X * CosRot - ScaledPos.Y * SinRot;
-			RotatedPos.Y = ScaledPos.X * SinRot + ScaledPos.Y * CosRot;
-			ScaledPos = RotatedPos;
-		}
-
-		// Step 5: Apply Origin offset
-		FVector2D OffsetPos = ScaledPos + Origin;
-
-		// Step 6: Build 3D position on wall plane
-		FVector LocalWallPos(OffsetPos.X, 0.0f, OffsetPos.Y);
-
-		// Step 7: Apply wall's own rotation
-		FVector WallRotatedPos = WorldRotation.RotateVector(LocalWallPos);
-		
-		// Step 8: Add wall's WorldPosition to get LOCAL position
-		// This is the position relative to RootOriginActor (NO RootRotation applied!)
-		FVector RelativePos = WorldPosition + WallRotatedPos;
-
-		UE_LOG(LogAefPharus, Verbose, TEXT("  [Wall TrackToLocal] WallPos=%s, WallRotated=%s, RelativePos=%s"),
-			*WorldPosition.ToString(), *WallRotatedPos.ToString(), *RelativePos.ToString());
-
-		return RelativePos;
+		return FAefPharusWallTransform::Compile(*this, GlobalWallRotation, FVector::ZeroVector, FRotator::ZeroRotator).ToLocal.TransformPosition(TrackPos);
 	}
 };
 
@@ -299,6 +222,10 @@ struct AEFPHARUS_API FAefPharusTrackData
 	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Track")
 	EAefPharusWallSide AssignedWall = EAefPharusWallSide::Floor;
 
+	/** Index of the assigned region in the instance's WallRegions (Regions mode, -1 if none) */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Track")
+	int32 AssignedRegionIndex = INDEX_NONE;
+
 	/** Last time this track received an update (for timeout detection) */
 	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Track")
 	double LastUpdateTime = 0.0;
@@ -309,6 +236,169 @@ struct AEFPHARUS_API FAefPharusTrackData
 	 */
 	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Track")
 	bool bIsInsideBoundary = true;
+
+	/** Arrival time of the UDP frame that carried this update (ns since Unix epoch, 0 if unknown)
+	 *  Kernel receive timestamp where the platform supports it, see GetLatencyStats()
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Track")
+	int64 ArrivalTimeNs = 0;
+};
+
+/**
+ * Track Event Queue Statistics
+ *
+ * Fill level of the lock-free queue that hands track events
+ * from the network thread to the game thread.
+ */
+USTRUCT(BlueprintType)
+struct AEFPHARUS_API FAefPharusEventQueueStats
+{
+	GENERATED_BODY()
+
+	/** Maximum number of events the queue can hold */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	int32 Capacity = 0;
+
+	/** Events currently waiting for the game thread */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	int32 Pending = 0;
+
+	/** Highest number of waiting events seen since the instance started */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	int32 HighWaterMark = 0;
+
+	/** Events dropped because the queue was full */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	int32 OverflowCount = 0;
+
+	/** Track updates replaced by a newer one of the same track before they were mapped */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	int32 CoalescedCount = 0;
+};
+
+/**
+ * Track Latency Statistics
+ *
+ * Time from a frame arriving at the network card until its transform
+ * was applied to the track actor, over the most recent samples.
+ */
+USTRUCT(BlueprintType)
+struct AEFPHARUS_API FAefPharusLatencyStats
+{
+	GENERATED_BODY()
+
+	/** Number of samples the percentiles are based on */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	int32 SampleCount = 0;
+
+	/** Median latency (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	float P50Ms = 0.0f;
+
+	/** 95th percentile latency (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	float P95Ms = 0.0f;
+
+	/** 99th percentile latency (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	float P99Ms = 0.0f;
+
+	/** Highest latency among the samples (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	float MaxMs = 0.0f;
+
+	/** Arrival times come from the kernel (SO_TIMESTAMPNS); otherwise they are taken
+	 *  after the receive call and socket queueing time is not included */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	bool bKernelTimestamps = false;
+};
+
+/**
+ * Network Statistics
+ *
+ * Receive path of one tracker instance. Rates cover the last sampling
+ * interval (NetworkStatsInterval), totals count since the instance started.
+ */
+USTRUCT(BlueprintType)
+struct AEFPHARUS_API FAefPharusNetworkStats
+{
+	GENERATED_BODY()
+
+	/** Length of the interval the rates were measured over (s), 0 before the first sample */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	float SampleInterval = 0.0f;
+
+	/** UDP datagrams received per second */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	float PacketsPerSecond = 0.0f;
+
+	/** Payload bytes received per second */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	float BytesPerSecond = 0.0f;
+
+	/** Complete tracker frames parsed per second (a frame usually is one datagram) */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	float FramesPerSecond = 0.0f;
+
+	/** Average number of tracks per frame */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	float TracksPerPacket = 0.0f;
+
+	/** Smoothed variation of the time between frames (ms); high values mean bursty delivery */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	float JitterMs = 0.0f;
+
+	/** Seconds since the last datagram arrived, -1 if none arrived yet */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	float SecondsSinceLastPacket = -1.0f;
+
+	/** Datagrams received since the instance started */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	int64 TotalPackets = 0;
+
+	/** Frames dropped for broken 'T'/'t' framing or truncated records since the instance started */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	int64 MalformedPackets = 0;
+
+	/** Senders (IP and port) that delivered to the port within the last second; more than 1 means several trackers share it */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	int32 Senders = 0;
+
+	/** Incomplete multi-datagram frames dropped by the reassembly (timeout, oversize or sender table full) since the instance started */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	int64 ReassemblyDrops = 0;
+
+	/** Datagrams the kernel dropped on a full receive buffer (Linux only, see ReceiveBufferSize) */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	int64 KernelDrops = 0;
+
+	/** Socket receive buffer granted by the system (bytes) */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	int32 ReceiveBufferSize = 0;
+
+	/** Receive thread busy-polls (bBusyPoll) */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	bool bBusyPoll = false;
+
+	/** CPU time of the receive thread(s) over the interval, in percent of one core; -1 when the socket is serviced by the shared network thread or the platform cannot tell */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	float ReceiveCpuPercent = -1.0f;
+
+	/** Mean time datagrams waited in the socket until the receive thread picked them up (microseconds), -1 without kernel timestamps */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	float ReceiveDelayUs = -1.0f;
+
+	/** Busy-poll: share of receive attempts over the interval that found the socket empty (0-1) */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	float EmptyPollRatio = 0.0f;
+
+	/** Current role in the track bridge: Publish, Subscribe, or Off (not bridged, or waiting for a publisher) */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	EAefPharusBridgeMode BridgeRole = EAefPharusBridgeMode::Off;
+
+	/** Subscriber: published frames the bridge thread missed since the instance started (the publisher was faster than it could read) */
+	UPROPERTY(BlueprintReadOnly, Category = "AEF|Pharus|Stats")
+	int64 BridgeSkippedFrames = 0;
 };
 
 /**
@@ -354,6 +444,106 @@ struct AEFPHARUS_API FAefPharusInstanceConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Network")
 	FString MulticastGroup = "239.1.1.1";
 
+	/** What the tracker sends on UDPPort: TrackLink frames (default) or TUIO (Pharus' tuiosender sends to port 3333) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Network")
+	EAefPharusProtocol Protocol = EAefPharusProtocol::TrackLink;
+
+	/**
+	 * TUIO only: size of the tracking area in meters. TUIO sends positions relative to the area (0-1);
+	 * this turns them into meters and velocities into m/s. Pharus: the width and height of its mappingspace.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Network")
+	FVector2D TuioAreaSize = FVector2D(15.0f, 8.3f);
+
+	/**
+	 * Socket receive buffer (SO_RCVBUF) in bytes, 0 = system default.
+	 * Absorbs tracker bursts while the receiver is busy; what the kernel actually grants is logged
+	 * on startup (on Linux it is capped by net.core.rmem_max). Datagrams dropped because the buffer
+	 * was full are logged as warnings and counted in the client statistics.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Network", meta = (ClampMin = "0"))
+	int32 ReceiveBufferSize = 4194304;
+
+	/**
+	 * Sockets receiving on UDPPort in parallel (SO_REUSEPORT), each with its own receive worker.
+	 * Unicast with several senders only: the system assigns every sender to one socket, so a single
+	 * sender never spreads over workers and multicast copies every datagram to every socket.
+	 * Linux only. Requires bUseFrameSnapshots; the workers' frames are merged into one snapshot per tick.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Network", meta = (ClampMin = "1", ClampMax = "16"))
+	int32 ReceiveWorkers = 1;
+
+	/**
+	 * Low-latency receive: poll the socket without blocking instead of sleeping until the system wakes the thread.
+	 * Costs up to one CPU core per receive thread while the tracker sends. Uses a dedicated receive thread
+	 * (NetworkIOThreads does not apply). Compare ReceiveCpuPercent / ReceiveDelayUs in GetNetworkStats().
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Network")
+	bool bBusyPoll = false;
+
+	/** Busy-poll: spin on the socket for this long after each datagram (microseconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Network", meta = (ClampMin = "0", EditCondition = "bBusyPoll"))
+	int32 BusyPollSpinMicroseconds = 2000;
+
+	/**
+	 * Busy-poll: after spinning, keep polling with a thread yield in between for this long (microseconds)
+	 * before falling back to a blocking wait. Spin + yield should cover the tracker frame interval.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Network", meta = (ClampMin = "0", EditCondition = "bBusyPoll"))
+	int32 BusyPollYieldMicroseconds = 50000;
+
+	/** Busy-poll: SO_BUSY_POLL time (microseconds), the kernel polls the network device queue itself. Linux only, 0 = off */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Network", meta = (ClampMin = "0", EditCondition = "bBusyPoll"))
+	int32 BusyPollSocketMicroseconds = 0;
+
+	/**
+	 * Priority of the instance's own receive thread ("PharusReceive <InstanceName>").
+	 * Applies with NetworkIOThreads=0, BusyPoll or ReceiveWorkers > 1; shared network threads use
+	 * [PharusSubsystem] NetworkIOThreadPriority instead.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Network")
+	EAefPharusThreadPriority ReceiveThreadPriority = EAefPharusThreadPriority::Normal;
+
+	/**
+	 * Logical cores the instance's own receive thread may run on, one bit per core (ini accepts hex, e.g. 0xF0).
+	 * 0 = any core. Keep it off the render and RHI thread cores on nDisplay nodes.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Network", meta = (ClampMin = "0"))
+	int64 ReceiveThreadAffinityMask = 0;
+
+	/**
+	 * Record every received datagram with its arrival time and sender to
+	 * Saved/Pharus/Captures/<InstanceName>_<date-time>.tlcap (memory-mapped, append-only),
+	 * to re-run a venue session later with ReplayFile. Uses one receive socket (ReceiveWorkers does not apply).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Network")
+	bool bCaptureTraffic = false;
+
+	/**
+	 * Parse a capture file instead of listening on the network; empty = live tracking.
+	 * Relative paths start in Saved/Pharus/Captures. Network settings and bCaptureTraffic do not apply.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Network")
+	FString ReplayFile;
+
+	/** Replay speed relative to the capture: 1 = as recorded, 4 = four times faster, 0 = as fast as possible */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Network", meta = (ClampMin = "0"))
+	float ReplaySpeed = 1.0f;
+
+	/**
+	 * Share this tracker with the other processes on the host (nDisplay nodes, editor next to a game).
+	 * One publisher receives and parses, the others map its frames from shared memory read-only instead
+	 * of competing for the unicast port or each parsing multicast. Auto lets the processes elect the
+	 * publisher among themselves and replaces a publisher that quits or crashes.
+	 * Uses a dedicated thread (NetworkIOThreads and ReceiveWorkers do not apply), not with ReplayFile.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Network")
+	EAefPharusBridgeMode BridgeMode = EAefPharusBridgeMode::Off;
+
+	/** Shared memory name of the bridge; empty = AefPharus_<UDPPort>. All processes sharing a tracker must use the same name. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Network")
+	FString BridgeName;
+
 	//--------------------------------------------------------------------------------
 	// Mapping Configuration
 	//--------------------------------------------------------------------------------
@@ -484,6 +674,23 @@ struct AEFPHARUS_API FAefPharusInstanceConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Performance", meta = (ClampMin = "0.0", ClampMax = "60.0"))
 	float TrackLostTimeout = 3.0f;
 
+	/**
+	 * Read tracks as whole frames instead of per-track callbacks.
+	 * Once per tick the latest completely received tracker frame is picked up and diffed against
+	 * the previous one (new/updated/lost). Frames arriving faster than the game ticks are skipped.
+	 * When disabled, every track of every frame goes through the event queue (TrackEventQueueSize).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Performance")
+	bool bUseFrameSnapshots = true;
+
+	/**
+	 * Capacity of the lock-free queue handing track events from the network thread to the game thread.
+	 * Every received track produces one event per frame. When the game thread stalls longer than the
+	 * queue can buffer, further events are dropped and counted (see GetEventQueueStats).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Performance", meta = (ClampMin = "64", ClampMax = "65536"))
+	int32 TrackEventQueueSize = 4096;
+
 	//--------------------------------------------------------------------------------
 	// Logging & Debug
 	//--------------------------------------------------------------------------------
@@ -500,10 +707,14 @@ struct AEFPHARUS_API FAefPharusInstanceConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Logging")
 	bool bLogTrackerRemoved = true;
 
-	/** Log network packet statistics */
+	/** Log network packet statistics every NetworkStatsInterval seconds (see GetNetworkStats) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Logging")
 	bool bLogNetworkStats = false;
 
+	/** Seconds between network statistics samples (rates are averaged over this interval) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Logging", meta = (ClampMin = "0.5", ClampMax = "300.0"))
+	float NetworkStatsInterval = 5.0f;
+
 	/** Log wall region assignment (for debugging Regions mode) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AEF|Pharus|Logging")
 	bool bLogRegionAssignment = false;
@@ -0,0 +1,447 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace pharus
+{
+
+//! Open Sound Control 1.0 encoding
+/** A packet is a message or a bundle. A message is a NUL-terminated address, a type tag
+  * string (',' followed by one character per argument) and the arguments; a bundle is
+  * "#bundle", a 64 bit time tag and size-prefixed elements (messages or bundles).
+  * Strings are padded with NULs to a multiple of 4 bytes, numbers are big-endian. */
+namespace osc
+{
+    static constexpr char BUNDLE_TAG[8] = { '#', 'b', 'u', 'n', 'd', 'l', 'e', '\0' };
+    //! "#bundle" + time tag
+    static constexpr int BUNDLE_HEADER_SIZE = 16;
+    //! Time tag meaning "immediately"
+    static constexpr uint64_t IMMEDIATELY = 1;
+
+    inline uint32_t readUInt32(const char* p)
+    {
+        const unsigned char* b = reinterpret_cast<const unsigned char*>(p);
+        return ((uint32_t)b[0] << 24) | ((uint32_t)b[1] << 16) | ((uint32_t)b[2] << 8) | (uint32_t)b[3];
+    }
+
+    inline int32_t readInt32(const char* p)
+    {
+        return (int32_t)readUInt32(p);
+    }
+
+    inline float readFloat(const char* p)
+    {
+        const uint32_t bits = readUInt32(p);
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    inline void writeUInt32(char* p, uint32_t value)
+    {
+        p[0] = (char)(value >> 24);
+        p[1] = (char)(value >> 16);
+        p[2] = (char)(value >> 8);
+        p[3] = (char)value;
+    }
+
+    //! Bytes a string of length characters takes, NUL and padding included
+    inline int paddedSize(int length)
+    {
+        return (length + 4) & ~3;
+    }
+
+    //! Padded size of the string at p, -1 if it is not terminated and padded within size bytes
+    inline int stringSize(const char* p, int size)
+    {
+        const char* end = size > 0 ? static_cast<const char*>(memchr(p, '\0', (size_t)size)) : nullptr;
+        if (!end)
+            return -1;
+        const int padded = paddedSize((int)(end - p));
+        return padded <= size ? padded : -1;
+    }
+
+    //! Bytes of an argument of type tag, starting at p; -1 if the type is unknown or it does not fit
+    inline int argumentSize(char tag, const char* p, int size)
+    {
+        switch (tag)
+        {
+        case 'i': case 'f': case 'c': case 'r': case 'm':
+            return size >= 4 ? 4 : -1;
+        case 'h': case 't': case 'd':
+            return size >= 8 ? 8 : -1;
+        case 's': case 'S':
+            return stringSize(p, size);
+        case 'b':
+        {
+            if (size < 4)
+                return -1;
+            const uint32_t length = readUInt32(p);
+            if (length > (uint32_t)(size - 4))
+                return -1;
+            const int padded = 4 + (((int)length + 3) & ~3);
+            return padded <= size ? padded : -1;
+        }
+        case 'T': case 'F': case 'N': case 'I':
+            return 0;
+        default:
+            return -1;
+        }
+    }
+}
+
+//! Non-owning view of one OSC message
+/** Validated when decoded: every argument lies within the message, so reading them is
+  * never out of bounds. Only valid as long as the buffer it points into. */
+class OscMessageView
+{
+public:
+    //! Sequential access to the arguments
+    /** A read of the wrong type fails and leaves the reader where it is. */
+    class Reader
+    {
+    public:
+        //! Type tag of the next argument, '\0' after the last one
+        char type() const { return *tag; }
+        bool atEnd() const { return *tag == '\0'; }
+
+        bool readInt(int32_t& out)
+        {
+            if (*tag != 'i')
+                return false;
+            out = osc::readInt32(pos);
+            advance(4);
+            return true;
+        }
+
+        //! Reads an 'f', or an 'i' converted to float
+        bool readFloat(float& out)
+        {
+            if (*tag == 'f')
+                out = osc::readFloat(pos);
+            else if (*tag == 'i')
+                out = (float)osc::readInt32(pos);
+            else
+                return false;
+            advance(4);
+            return true;
+        }
+
+        //! Reads an 's' or 'S'; out points into the buffer and is NUL-terminated
+        bool readString(const char*& out)
+        {
+            if (*tag != 's' && *tag != 'S')
+                return false;
+            out = pos;
+            advance(osc::stringSize(pos, (int)(end - pos)));
+            return true;
+        }
+
+        //! Skips the next argument of any type
+        bool skip()
+        {
+            if (*tag == '\0')
+                return false;
+            advance(osc::argumentSize(*tag, pos, (int)(end - pos)));
+            return true;
+        }
+
+    private:
+        friend class OscMessageView;
+
+        Reader(const char* _tag, const char* _pos, const char* _end) : tag(_tag), pos(_pos), end(_end) {}
+
+        void advance(int bytes)
+        {
+            pos += bytes;
+            ++tag;
+        }
+
+        const char* tag;
+        const char* pos;
+        const char* end;
+    };
+
+    OscMessageView() : addr(nullptr), tags(""), args(nullptr), end(nullptr), count(0) {}
+
+    //! Address pattern, NUL-terminated
+    const char* address() const { return addr; }
+    bool hasAddress(const char* pattern) const { return strcmp(addr, pattern) == 0; }
+    //! Type tags, one per argument, without the leading ','
+    const char* typeTags() const { return tags; }
+    int argumentCount() const { return count; }
+    Reader arguments() const { return Reader(tags, args, end); }
+
+private:
+    friend class OscPacketView;
+
+    const char* addr;
+    const char* tags;
+    const char* args;
+    const char* end;
+    int count;
+};
+
+//! Non-owning, bounds-checked view of an OSC packet
+/** forEachMessage() walks a message or a bundle (nested bundles flattened, in order)
+  * without copying or allocating and never reads outside [data, data + size). Time tags
+  * are ignored, every message is taken as "immediately". */
+class OscPacketView
+{
+public:
+    //! Why decoding stopped
+    enum Error
+    {
+        //! Packet decoded to its end
+        OK,
+        //! The packet or an element ends before its contents do
+        TRUNCATED,
+        //! Address does not start with '/' or is not terminated
+        BAD_ADDRESS,
+        //! Type tag string missing or not terminated
+        BAD_TYPE_TAGS,
+        //! Argument of a type this parser cannot size
+        UNKNOWN_TYPE,
+        //! Bundle element with a size that is no multiple of 4, or neither message nor bundle
+        BAD_BUNDLE,
+        //! Bundles nested deeper than MAX_DEPTH
+        TOO_DEEP
+    };
+
+    static constexpr int MAX_DEPTH = 8;
+
+    OscPacketView(const char* _data, int _size) : data(_data), size(_size < 0 ? 0 : _size) {}
+
+    //! Calls visitor(const OscMessageView&) for every message
+    /** Stops at the first malformed element; the messages before it have been visited.
+      * \return OK if the whole packet is well-formed, else the first error */
+    template <typename Visitor>
+    Error forEachMessage(Visitor&& visitor) const
+    {
+        return walk(data, size, 0, visitor);
+    }
+
+    //! Decodes a single message spanning all of [p, p + size)
+    static Error decodeMessage(const char* p, int size, OscMessageView& out)
+    {
+        if (size < 4 || p[0] != '/')
+            return BAD_ADDRESS;
+        const int addressSize = osc::stringSize(p, size);
+        if (addressSize < 0)
+            return BAD_ADDRESS;
+
+        const char* tags = p + addressSize;
+        const int tagSpace = size - addressSize;
+        if (tagSpace < 4 || tags[0] != ',')
+            return BAD_TYPE_TAGS;
+        const int tagsSize = osc::stringSize(tags, tagSpace);
+        if (tagsSize < 0)
+            return BAD_TYPE_TAGS;
+
+        // size every argument now, the reader relies on it
+        const char* args = tags + tagsSize;
+        const char* end = p + size;
+        const char* pos = args;
+        int count = 0;
+        for (const char* tag = tags + 1; *tag; ++tag, ++count)
+        {
+            const int argSize = osc::argumentSize(*tag, pos, (int)(end - pos));
+            if (argSize < 0)
+            {
+                const char known[] = "ifcrmhtdsSbTFNI";
+                return memchr(known, *tag, sizeof(known) - 1) ? TRUNCATED : UNKNOWN_TYPE;
+            }
+            pos += argSize;
+        }
+
+        out.addr = p;
+        out.tags = tags + 1;
+        out.args = args;
+        out.end = end;
+        out.count = count;
+        return OK;
+    }
+
+private:
+    template <typename Visitor>
+    static Error walk(const char* p, int size, int depth, Visitor& visitor)
+    {
+        if (size >= osc::BUNDLE_HEADER_SIZE && memcmp(p, osc::BUNDLE_TAG, sizeof(osc::BUNDLE_TAG)) == 0)
+        {
+            if (depth >= MAX_DEPTH)
+                return TOO_DEEP;
+
+            int pos = osc::BUNDLE_HEADER_SIZE;
+            while (pos < size)
+            {
+                if (size - pos < 4)
+                    return TRUNCATED;
+                const uint32_t elementSize = osc::readUInt32(p + pos);
+                pos += 4;
+                if ((elementSize & 3) != 0 || elementSize == 0)
+                    return BAD_BUNDLE;
+                if (elementSize > (uint32_t)(size - pos))
+                    return TRUNCATED;
+
+                const Error error = walk(p + pos, (int)elementSize, depth + 1, visitor);
+                if (error != OK)
+                    return error;
+                pos += (int)elementSize;
+            }
+            return OK;
+        }
+
+        if (size > 0 && p[0] == '#')
+            return BAD_BUNDLE;
+
+        OscMessageView message;
+        const Error error = decodeMessage(p, size, message);
+        if (error != OK)
+            return error;
+        visitor(static_cast<const OscMessageView&>(message));
+        return OK;
+    }
+
+    const char* data;
+    int size;
+};
+
+//! Writes OSC messages and bundles into a caller-provided buffer
+/** Bounds-checked: once something does not fit, overflow() is set and everything after
+  * it is dropped. Arguments must follow the type tags given to beginMessage(). */
+class OscPacketWriter
+{
+public:
+    OscPacketWriter(char* _buffer, int _capacity) : buffer(_buffer), capacity(_capacity), pos(0), depth(0), message(-1), overflowed(false) {}
+
+    //! Starts a bundle (nested if called inside one); time tag "immediately"
+    void beginBundle()
+    {
+        if (depth >= OscPacketView::MAX_DEPTH)
+        {
+            overflowed = true;
+            return;
+        }
+        const int start = beginElement();
+        elementStart[depth++] = start;
+        if (reserve(osc::BUNDLE_HEADER_SIZE))
+        {
+            memcpy(buffer + pos, osc::BUNDLE_TAG, sizeof(osc::BUNDLE_TAG));
+            osc::writeUInt32(buffer + pos + 8, (uint32_t)(osc::IMMEDIATELY >> 32));
+            osc::writeUInt32(buffer + pos + 12, (uint32_t)osc::IMMEDIATELY);
+            pos += osc::BUNDLE_HEADER_SIZE;
+        }
+    }
+
+    void endBundle()
+    {
+        if (depth > 0)
+            endElement(elementStart[--depth]);
+    }
+
+    //! Starts a message; typeTags without the leading ','
+    void beginMessage(const char* address, const char* typeTags)
+    {
+        message = beginElement();
+        addString(address);
+        if (reserve(osc::paddedSize(1 + (int)strlen(typeTags))))
+        {
+            const int length = 1 + (int)strlen(typeTags);
+            buffer[pos] = ',';
+            memcpy(buffer + pos + 1, typeTags, (size_t)length - 1);
+            memset(buffer + pos + length, 0, (size_t)(osc::paddedSize(length) - length));
+            pos += osc::paddedSize(length);
+        }
+    }
+
+    void endMessage()
+    {
+        endElement(message);
+        message = -1;
+    }
+
+    void addInt(int32_t value)
+    {
+        if (reserve(4))
+        {
+            osc::writeUInt32(buffer + pos, (uint32_t)value);
+            pos += 4;
+        }
+    }
+
+    void addFloat(float value)
+    {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        addInt((int32_t)bits);
+    }
+
+    void addString(const char* value)
+    {
+        const int length = (int)strlen(value);
+        if (reserve(osc::paddedSize(length)))
+        {
+            memcpy(buffer + pos, value, (size_t)length);
+            memset(buffer + pos + length, 0, (size_t)(osc::paddedSize(length) - length));
+            pos += osc::paddedSize(length);
+        }
+    }
+
+    //! Bytes written; only meaningful without overflow()
+    int size() const { return pos; }
+    bool overflow() const { return overflowed; }
+    //! Starts over with an empty buffer
+    void reset()
+    {
+        pos = 0;
+        depth = 0;
+        message = -1;
+        overflowed = false;
+    }
+
+private:
+    bool reserve(int bytes)
+    {
+        if (overflowed || capacity - pos < bytes)
+        {
+            overflowed = true;
+            return false;
+        }
+        return true;
+    }
+
+    //! Inside a bundle an element is prefixed with its size, patched by endElement()
+    int beginElement()
+    {
+        if (depth == 0)
+            return -1;
+        if (!reserve(4))
+            return -1;
+        const int start = pos;
+        pos += 4;
+        return start;
+    }
+
+    void endElement(int start)
+    {
+        if (start >= 0 && !overflowed)
+            osc::writeUInt32(buffer + start, (uint32_t)(pos - start - 4));
+    }
+
+    char* buffer;
+    int capacity;
+    int pos;
+    //! Size prefix offsets of the open bundles (-1 for a top-level bundle)
+    int elementStart[OscPacketView::MAX_DEPTH];
+    int depth;
+    //! Size prefix offset of the open message, -1 if it is not in a bundle
+    int message;
+    bool overflowed;
+};
+
+} // #end namespace pharus
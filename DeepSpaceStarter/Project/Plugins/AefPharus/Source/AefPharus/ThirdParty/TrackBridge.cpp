@@ -0,0 +1,602 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#include "TrackBridge.h"
+#include "TrackTable.h"
+#include "TrackSnapshot.h"
+#include "UDPManager.h"
+
+#include "AefPharus.h" // Module logging
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+#if PLATFORM_WINDOWS
+    #include "Windows/WindowsHWrapper.h"
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/file.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <errno.h>
+#endif
+#if PLATFORM_LINUX
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <climits>
+    #include <ctime>
+#endif
+
+using namespace pharus;
+
+namespace
+{
+    //! Copy attempts of one read() before it gives up until the next call
+    constexpr int MAX_READ_ATTEMPTS = 64;
+
+    uint64_t slotSizeFor(uint32_t maxTracks)
+    {
+        const uint64_t size = sizeof(bridge::SlotHeader) + uint64_t(maxTracks) * sizeof(bridge::Track)
+            + uint64_t(maxTracks) * bridge::ECHOES_PER_TRACK * sizeof(PharusVector2f);
+        return (size + 63) & ~uint64_t(63);
+    }
+
+    uint64_t segmentSize(uint64_t slotSize)
+    {
+        return sizeof(bridge::SegmentHeader) + bridge::SLOT_COUNT * slotSize;
+    }
+
+    //! A name that works as POSIX shm name and as Windows kernel object name
+    bool validName(const char* name)
+    {
+        if (!name || !*name || strlen(name) > 200)
+            return false;
+        return strpbrk(name, "/\\") == nullptr;
+    }
+
+    //! The header describes a complete layout that fits into size bytes
+    bool validLayout(const bridge::SegmentHeader* header, size_t size)
+    {
+        return memcmp(header->magic, bridge::MAGIC, sizeof(header->magic)) == 0
+            && header->version == bridge::VERSION
+            && header->headerSize == sizeof(bridge::SegmentHeader)
+            && header->slotCount == bridge::SLOT_COUNT
+            && header->maxEchoes == header->maxTracks * bridge::ECHOES_PER_TRACK
+            && header->slotSize == slotSizeFor(header->maxTracks)
+            && segmentSize(header->slotSize) <= size;
+    }
+
+    //! Slot holding frame
+    bridge::SlotHeader* slotAt(bridge::SegmentHeader* header, uint64_t frame)
+    {
+        return reinterpret_cast<bridge::SlotHeader*>(reinterpret_cast<char*>(header)
+            + sizeof(bridge::SegmentHeader) + (frame % bridge::SLOT_COUNT) * header->slotSize);
+    }
+    const bridge::SlotHeader* slotAt(const bridge::SegmentHeader* header, uint64_t frame)
+    {
+        return slotAt(const_cast<bridge::SegmentHeader*>(header), frame);
+    }
+
+#if PLATFORM_LINUX
+    //! Shared (not process-private) futex, the word lives in a mapping of several processes
+    long futex(const std::atomic<uint32_t>* word, int op, uint32_t value, const struct timespec* timeout)
+    {
+        return syscall(SYS_futex, (const void*)word, op, value, timeout, nullptr, 0);
+    }
+#endif
+
+#if PLATFORM_WINDOWS
+    std::string objectName(const char* name, const char* suffix = "")
+    {
+        // session-local, processes of one login share it without privileges
+        return std::string("Local\\") + name + suffix;
+    }
+#else
+    std::string objectName(const char* name)
+    {
+        return std::string("/") + name;
+    }
+#endif
+}
+
+//--------------------------------------------------------------------------------
+// TrackBridgePublisher
+//--------------------------------------------------------------------------------
+
+TrackBridgePublisher::TrackBridgePublisher()
+: header(nullptr)
+, mappingSize(0)
+, nextFrame(1)
+, frameCount(0)
+, truncated(0)
+#if PLATFORM_WINDOWS
+, fileMapping(nullptr)
+, mutex(nullptr)
+#else
+, file(-1)
+#endif
+{
+}
+
+TrackBridgePublisher::~TrackBridgePublisher()
+{
+    close();
+}
+
+TrackBridgePublisher::OpenResult TrackBridgePublisher::open(const char* name, int maxTracks, const TrackTable& tracks, unsigned int echoGeneration)
+{
+    close();
+    if (!validName(name))
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackBridgePublisher: Invalid bridge name '%hs'"), name ? name : "");
+        return FAILED;
+    }
+    const uint32_t capacity = (uint32_t)std::max(1, std::min(maxTracks, 65536));
+    const uint64_t slotSize = slotSizeFor(capacity);
+    const uint64_t size = segmentSize(slotSize);
+
+#if PLATFORM_WINDOWS
+    // the mutex decides who publishes; the system releases it (abandoned) when its owner dies
+    mutex = CreateMutexA(nullptr, FALSE, objectName(name, ".publisher").c_str());
+    if (!mutex)
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackBridgePublisher: Unable to create the publisher lock of %hs (error %u)"), name, (unsigned)GetLastError());
+        return FAILED;
+    }
+    const DWORD lock = WaitForSingleObject(mutex, 0);
+    if (lock != WAIT_OBJECT_0 && lock != WAIT_ABANDONED)
+    {
+        CloseHandle(mutex);
+        mutex = nullptr;
+        return BUSY;
+    }
+
+    // backed by the paging file; it lives as long as any process keeps it open and cannot grow
+    fileMapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, (DWORD)(size >> 32), (DWORD)size, objectName(name).c_str());
+    if (!fileMapping)
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackBridgePublisher: Unable to create the segment %hs (error %u)"), name, (unsigned)GetLastError());
+        close();
+        return FAILED;
+    }
+    header = (bridge::SegmentHeader*)MapViewOfFile(fileMapping, FILE_MAP_READ | FILE_MAP_WRITE, 0, 0, 0);
+    MEMORY_BASIC_INFORMATION region;
+    if (!header || VirtualQuery(header, &region, sizeof(region)) == 0)
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackBridgePublisher: Unable to map the segment %hs (error %u)"), name, (unsigned)GetLastError());
+        close();
+        return FAILED;
+    }
+    mappingSize = (size_t)region.RegionSize;
+    if (mappingSize < size)
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackBridgePublisher: Segment %hs was created for fewer tracks by another process, restart the processes sharing it to use %u tracks"),
+            name, capacity);
+        close();
+        return FAILED;
+    }
+#else
+    file = shm_open(objectName(name).c_str(), O_RDWR | O_CREAT, 0660);
+    if (file < 0)
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackBridgePublisher: Unable to open the segment %hs (errno %d)"), name, errno);
+        return FAILED;
+    }
+    // the lock belongs to the open file; the kernel drops it with the process
+    if (flock(file, LOCK_EX | LOCK_NB) != 0)
+    {
+        const int err = errno;
+        ::close(file);
+        file = -1;
+        if (err == EWOULDBLOCK)
+            return BUSY;
+        UE_LOG(LogAefPharus, Error, TEXT("TrackBridgePublisher: Unable to lock the segment %hs (errno %d)"), name, err);
+        return FAILED;
+    }
+
+    // grow only: readers keep their mapping of the current size, shrinking would fault them
+    struct stat info;
+    if (fstat(file, &info) != 0)
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackBridgePublisher: Unable to query the segment %hs (errno %d)"), name, errno);
+        close();
+        return FAILED;
+    }
+    if ((uint64_t)info.st_size < size)
+    {
+        // reserve the pages now: touching a hole of a full tmpfs raises SIGBUS
+#if PLATFORM_LINUX
+        const int err = posix_fallocate(file, 0, (off_t)size);
+#else
+        const int err = ftruncate(file, (off_t)size) == 0 ? 0 : errno;
+#endif
+        if (err != 0)
+        {
+            UE_LOG(LogAefPharus, Error, TEXT("TrackBridgePublisher: Unable to size the segment %hs to %llu KiB (errno %d)"), name, (unsigned long long)(size >> 10), err);
+            close();
+            return FAILED;
+        }
+    }
+    mappingSize = (size_t)std::max<uint64_t>(size, (uint64_t)info.st_size);
+    void* mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    if (mapping == MAP_FAILED)
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackBridgePublisher: Unable to map the segment %hs (errno %d)"), name, errno);
+        close();
+        return FAILED;
+    }
+    header = (bridge::SegmentHeader*)mapping;
+#endif
+
+    // a predecessor with the same layout is replaced in place, attached readers just continue
+    const uint32_t generation = header->generation.load(std::memory_order_acquire);
+    if ((generation & 1) == 0 && validLayout(header, mappingSize) && header->maxTracks == capacity)
+    {
+        // a predecessor that died within publish() left its slot odd; even it out for our seqlock
+        for (uint32_t i = 0; i < bridge::SLOT_COUNT; ++i)
+        {
+            bridge::SlotHeader* slot = slotAt(header, i);
+            const uint64_t sequence = slot->sequence.load(std::memory_order_relaxed);
+            if (sequence & 1)
+                slot->sequence.store(sequence + 1, std::memory_order_release);
+        }
+    }
+    else
+    {
+        initialize(capacity, slotSize);
+    }
+
+#if PLATFORM_WINDOWS
+    header->publisherPid = (int64_t)GetCurrentProcessId();
+#else
+    header->publisherPid = (int64_t)getpid();
+#endif
+    nextFrame = header->latestFrame.load(std::memory_order_relaxed) + 1;
+    frameCount = 0;
+    truncated = 0;
+    header->closed.store(0, std::memory_order_release);
+
+    // readers attached to a crashed predecessor must not keep its last frame
+    publish(tracks, UDPManager::GetTimestampNow(), echoGeneration);
+    frameCount = 0;
+
+    UE_LOG(LogAefPharus, Log, TEXT("TrackBridgePublisher: Publishing to %hs (%u tracks, %llu KiB)"),
+        name, capacity, (unsigned long long)(mappingSize >> 10));
+    return OPENED;
+}
+
+void TrackBridgePublisher::initialize(uint32_t maxTracks, uint64_t slotSize)
+{
+    // odd: readers of the previous layout detach, new readers wait until it is even again
+    uint32_t generation = header->generation.load(std::memory_order_relaxed);
+    if (memcmp(header->magic, bridge::MAGIC, sizeof(header->magic)) != 0)
+        generation = 0;
+    generation |= 1;
+    header->generation.store(generation, std::memory_order_seq_cst);
+
+    memcpy(header->magic, bridge::MAGIC, sizeof(header->magic));
+    header->version = bridge::VERSION;
+    header->headerSize = sizeof(bridge::SegmentHeader);
+    header->slotCount = bridge::SLOT_COUNT;
+    header->maxTracks = maxTracks;
+    header->maxEchoes = maxTracks * bridge::ECHOES_PER_TRACK;
+    header->reserved = 0;
+    header->slotSize = slotSize;
+    header->latestFrame.store(0, std::memory_order_relaxed);
+    header->closed.store(0, std::memory_order_relaxed);
+    for (uint32_t i = 0; i < bridge::SLOT_COUNT; ++i)
+        memset((void*)slotAt(header, i), 0, sizeof(bridge::SlotHeader));
+
+    header->generation.store(generation + 1, std::memory_order_release);
+}
+
+void TrackBridgePublisher::close()
+{
+    if (header)
+    {
+        header->closed.store(1, std::memory_order_release);
+        header->publishCount.fetch_add(1, std::memory_order_release);
+#if PLATFORM_LINUX
+        futex(&header->publishCount, FUTEX_WAKE, INT_MAX, nullptr);
+#endif
+    }
+
+#if PLATFORM_WINDOWS
+    if (header)
+        UnmapViewOfFile(header);
+    if (fileMapping)
+        CloseHandle(fileMapping);
+    if (mutex)
+    {
+        ReleaseMutex(mutex);
+        CloseHandle(mutex);
+    }
+    fileMapping = nullptr;
+    mutex = nullptr;
+#else
+    if (header)
+        munmap(header, mappingSize);
+    if (file >= 0)
+        ::close(file);  // releases the publisher lock
+    file = -1;
+#endif
+    header = nullptr;
+    mappingSize = 0;
+}
+
+void TrackBridgePublisher::publish(const TrackTable& tracks, long long arrivalNs, unsigned int echoGeneration)
+{
+    if (!header)
+        return;
+
+    const uint64_t frame = nextFrame++;
+    bridge::SlotHeader* slot = slotAt(header, frame);
+    bridge::Track* out = reinterpret_cast<bridge::Track*>(slot + 1);
+    PharusVector2f* echoes = reinterpret_cast<PharusVector2f*>(out + header->maxTracks);
+
+    // seqlock write: odd while the slot is inconsistent
+    const uint64_t sequence = slot->sequence.load(std::memory_order_relaxed);
+    slot->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    uint32_t trackCount = 0;
+    uint32_t echoCount = 0;
+    for (const TrackRecord& track : tracks)
+    {
+        if (track.state == TS_OFF)
+            continue;
+        if (trackCount == header->maxTracks)
+        {
+            ++truncated;
+            continue;
+        }
+        bridge::Track& copy = out[trackCount++];
+        copy.trackID = track.trackID;
+        copy.state = (int32_t)track.state;
+        copy.currentPos = track.currentPos;
+        copy.expectPos = track.expectPos;
+        copy.relPos = track.relPos;
+        copy.orientation = track.orientation;
+        copy.speed = track.speed;
+        copy.echoOffset = echoCount;
+        copy.echoCount = track.echoes.generation() == echoGeneration ? std::min(track.echoes.size(), header->maxEchoes - echoCount) : 0;
+        copy.reserved = 0;
+        copy.arrivalTimeNs = track.arrivalTimeNs;
+        if (copy.echoCount > 0)
+            memcpy(echoes + echoCount, track.echoes.data(), copy.echoCount * sizeof(PharusVector2f));
+        echoCount += copy.echoCount;
+    }
+    // readers diff by ID, the track table is unordered
+    std::sort(out, out + trackCount, [](const bridge::Track& a, const bridge::Track& b) { return a.trackID < b.trackID; });
+
+    slot->frame = frame;
+    slot->arrivalTimeNs = arrivalNs;
+    slot->trackCount = trackCount;
+    slot->echoCount = echoCount;
+    slot->sequence.store(sequence + 2, std::memory_order_release);
+
+    header->latestFrame.store(frame, std::memory_order_release);
+    header->publishCount.fetch_add(1, std::memory_order_release);
+#if PLATFORM_LINUX
+    // one syscall per frame; readers of every process sleep on this word
+    futex(&header->publishCount, FUTEX_WAKE, INT_MAX, nullptr);
+#endif
+    ++frameCount;
+}
+
+//--------------------------------------------------------------------------------
+// TrackBridgeReader
+//--------------------------------------------------------------------------------
+
+TrackBridgeReader::TrackBridgeReader()
+: header(nullptr)
+, mappingSize(0)
+, generation(0)
+, lastFrame(0)
+, lastPublishCount(0)
+, skipped(0)
+, retryCount(0)
+#if PLATFORM_WINDOWS
+, fileMapping(nullptr)
+#else
+, file(-1)
+#endif
+{
+}
+
+TrackBridgeReader::~TrackBridgeReader()
+{
+    close();
+}
+
+bool TrackBridgeReader::open(const char* _name)
+{
+    close();
+    if (!validName(_name))
+        return false;
+    name = _name;
+
+#if PLATFORM_WINDOWS
+    fileMapping = OpenFileMappingA(FILE_MAP_READ, FALSE, objectName(_name).c_str());
+    if (!fileMapping)
+        return false;
+    header = (const bridge::SegmentHeader*)MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0);
+    MEMORY_BASIC_INFORMATION region;
+    if (!header || VirtualQuery(header, &region, sizeof(region)) == 0)
+    {
+        close();
+        return false;
+    }
+    mappingSize = (size_t)region.RegionSize;
+#else
+    file = shm_open(objectName(_name).c_str(), O_RDONLY, 0);
+    if (file < 0)
+        return false;
+    struct stat info;
+    if (fstat(file, &info) != 0 || (uint64_t)info.st_size < sizeof(bridge::SegmentHeader))
+    {
+        close();
+        return false;
+    }
+    mappingSize = (size_t)info.st_size;
+    void* mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, file, 0);
+    if (mapping == MAP_FAILED)
+    {
+        header = nullptr;
+        close();
+        return false;
+    }
+    header = (const bridge::SegmentHeader*)mapping;
+#endif
+
+    // a layout in progress or one that does not fit the mapping is no segment yet, a closed one has no publisher
+    generation = header->generation.load(std::memory_order_acquire);
+    if ((generation & 1) != 0 || !validLayout(header, mappingSize) || header->closed.load(std::memory_order_acquire))
+    {
+        close();
+        return false;
+    }
+    lastFrame = 0;
+    lastPublishCount = header->publishCount.load(std::memory_order_acquire);
+    return true;
+}
+
+void TrackBridgeReader::close()
+{
+#if PLATFORM_WINDOWS
+    if (header)
+        UnmapViewOfFile(header);
+    if (fileMapping)
+        CloseHandle(fileMapping);
+    fileMapping = nullptr;
+#else
+    if (header)
+        munmap(const_cast<bridge::SegmentHeader*>(header), mappingSize);
+    if (file >= 0)
+        ::close(file);
+    file = -1;
+#endif
+    header = nullptr;
+    mappingSize = 0;
+}
+
+TrackBridgeReader::ReadResult TrackBridgeReader::read(TrackSnapshot& snapshot)
+{
+    if (!header)
+        return DETACHED;
+
+    // before anything else, so wait() sleeps only if nothing was published after this point
+    lastPublishCount = header->publishCount.load(std::memory_order_acquire);
+    if (header->generation.load(std::memory_order_acquire) != generation)
+        return DETACHED;
+    if (header->closed.load(std::memory_order_acquire))
+        return CLOSED;
+
+    for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; ++attempt)
+    {
+        const uint64_t frame = header->latestFrame.load(std::memory_order_acquire);
+        if (frame == lastFrame)
+            return NO_FRAME;
+
+        const bridge::SlotHeader* slot = slotAt(header, frame);
+        const uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+        const uint32_t trackCount = slot->trackCount;
+        const uint32_t echoCount = slot->echoCount;
+        bool consistent = (sequence & 1) == 0 && slot->frame == frame
+            && trackCount <= header->maxTracks && echoCount <= header->maxEchoes;
+        if (consistent)
+        {
+            // copies from a slot that is being overwritten are thrown away below
+            const bridge::Track* tracks = reinterpret_cast<const bridge::Track*>(slot + 1);
+            const PharusVector2f* echoes = reinterpret_cast<const PharusVector2f*>(tracks + header->maxTracks);
+            snapshot.arrivalTimeNs = slot->arrivalTimeNs;
+            snapshot.echoes.resize(echoCount);
+            if (echoCount > 0)
+                memcpy(snapshot.echoes.data(), echoes, echoCount * sizeof(PharusVector2f));
+            snapshot.tracks.resize(trackCount);
+            for (uint32_t i = 0; i < trackCount; ++i)
+            {
+                const bridge::Track& source = tracks[i];
+                TrackRecord& track = snapshot.tracks[i];
+                track.trackID = source.trackID;
+                track.state = (TrackState)source.state;
+                track.currentPos = source.currentPos;
+                track.expectPos = source.expectPos;
+                track.relPos = source.relPos;
+                track.orientation = source.orientation;
+                track.speed = source.speed;
+                track.arrivalTimeNs = source.arrivalTimeNs;
+                const bool echoesValid = source.echoOffset <= echoCount && source.echoCount <= echoCount - source.echoOffset;
+                track.echoes = echoesValid && source.echoCount > 0
+                    ? EchoSpan(snapshot.echoes.data() + source.echoOffset, source.echoCount) : EchoSpan();
+            }
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        consistent = consistent && slot->sequence.load(std::memory_order_relaxed) == sequence;
+        if (header->generation.load(std::memory_order_relaxed) != generation)
+            return DETACHED;
+        if (consistent)
+        {
+            if (lastFrame > 0 && frame > lastFrame + 1)
+                skipped += frame - lastFrame - 1;
+            lastFrame = frame;
+            return FRAME;
+        }
+
+        // the publisher lapped us; the latest frame is in another slot by now
+        ++retryCount;
+        if (attempt >= 8)
+            std::this_thread::yield();
+    }
+    return NO_FRAME;
+}
+
+bool TrackBridgeReader::wait(int timeoutMs)
+{
+#if PLATFORM_LINUX
+    if (!header)
+        return false;
+    struct timespec timeout;
+    timeout.tv_sec = timeoutMs / 1000;
+    timeout.tv_nsec = (long)(timeoutMs % 1000) * 1000000L;
+    // returns at once if something was published since the last read()
+    futex(&header->publishCount, FUTEX_WAIT, lastPublishCount, &timeout);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void TrackBridgeReader::wake()
+{
+#if PLATFORM_LINUX
+    // also wakes the readers of other processes; they find nothing new and sleep again
+    if (header)
+        futex(&header->publishCount, FUTEX_WAKE, INT_MAX, nullptr);
+#endif
+}
+
+bool TrackBridgeReader::publisherAlive() const
+{
+    if (!header)
+        return false;
+#if PLATFORM_WINDOWS
+    HANDLE mutex = OpenMutexA(SYNCHRONIZE, FALSE, objectName(name.c_str(), ".publisher").c_str());
+    if (!mutex)
+        return false;
+    const DWORD lock = WaitForSingleObject(mutex, 0);
+    if (lock == WAIT_OBJECT_0 || lock == WAIT_ABANDONED)
+        ReleaseMutex(mutex);
+    CloseHandle(mutex);
+    return lock == WAIT_TIMEOUT;
+#else
+    // a shared lock is only refused while the publisher holds its exclusive one
+    if (flock(file, LOCK_SH | LOCK_NB) != 0)
+        return errno == EWOULDBLOCK;
+    flock(file, LOCK_UN);
+    return false;
+#endif
+}
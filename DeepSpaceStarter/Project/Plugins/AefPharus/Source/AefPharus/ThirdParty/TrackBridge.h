@@ -0,0 +1,232 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#pragma once
+
+#include "TrackRecord.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace pharus
+{
+
+class TrackTable;
+struct TrackSnapshot;
+
+//! Shared memory layout of a track bridge (all fields host byte order)
+/** One publisher process writes decoded frames, any number of processes on the same
+  * host map the segment read-only:
+  *
+  *     SegmentHeader | slot 0 | slot 1 | ... | slot SLOT_COUNT-1
+  *     slot: SlotHeader | Track[maxTracks] | PharusVector2f[maxEchoes]
+  *
+  * Every slot is a seqlock: the publisher makes SlotHeader::sequence odd, writes the
+  * frame and makes it even again; a reader copies the slot and keeps the copy only if
+  * the sequence was even and unchanged. Frames go round-robin into the slots, so a
+  * reader is only torn if the publisher laps it by SLOT_COUNT frames within one copy.
+  * Nobody ever waits for a reader. */
+namespace bridge
+{
+    static constexpr char MAGIC[8] = { 'P', 'H', 'R', 'S', 'B', 'R', 'G', '\0' };
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t SLOT_COUNT = 4;
+    //! Echo capacity of a slot per track
+    static constexpr uint32_t ECHOES_PER_TRACK = 8;
+
+    //! One track of a published frame
+    struct Track
+    {
+        uint32_t trackID;
+        //! TrackState
+        int32_t state;
+        PharusVector2f currentPos;
+        PharusVector2f expectPos;
+        PharusVector2f relPos;
+        PharusVector2f orientation;
+        float speed;
+        //! The track's echoes in the slot's echo array
+        uint32_t echoOffset;
+        uint32_t echoCount;
+        uint32_t reserved;
+        int64_t arrivalTimeNs;
+    };
+
+    struct SegmentHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t headerSize;
+        uint32_t slotCount;
+        uint32_t maxTracks;
+        uint32_t maxEchoes;
+        uint32_t reserved;
+        uint64_t slotSize;
+        //! Odd while a publisher lays the segment out anew; readers mapped before a change must reattach
+        std::atomic<uint32_t> generation;
+        //! Incremented after every publish and on close; readers sleep on it (futex word on Linux)
+        std::atomic<uint32_t> publishCount;
+        //! Number of the latest complete frame, 0 before the first one; it lives in slot latestFrame % SLOT_COUNT
+        std::atomic<uint64_t> latestFrame;
+        //! The publisher shut down cleanly (a crashed one leaves it 0 and just goes quiet)
+        std::atomic<uint32_t> closed;
+        uint32_t reserved2;
+        //! Process ID of the latest publisher, informational
+        int64_t publisherPid;
+        uint8_t padding[56];
+    };
+
+    struct SlotHeader
+    {
+        //! Seqlock sequence, odd while the publisher writes the slot
+        std::atomic<uint64_t> sequence;
+        uint64_t frame;
+        //! Arrival time of the frame at the publisher (TrackLinkClient::timestampNow() clock, host-wide)
+        int64_t arrivalTimeNs;
+        uint32_t trackCount;
+        uint32_t echoCount;
+        uint8_t padding[32];
+    };
+
+    static_assert(sizeof(Track) == 64, "bridge track layout");
+    static_assert(sizeof(SegmentHeader) == 128, "bridge segment header layout");
+    static_assert(sizeof(SlotHeader) == 64, "bridge slot header layout");
+    // the atomics are shared between processes, they must not hide a lock
+    static_assert(std::atomic<uint32_t>::is_always_lock_free && std::atomic<uint64_t>::is_always_lock_free, "bridge atomics must be lock-free");
+}
+
+//! Writes decoded frames into a named shared memory segment (see bridge)
+/** Only one publisher per name: open() takes a system-wide publisher lock (an exclusive
+  * flock on the segment on POSIX, a named mutex on Windows) that the system releases
+  * when the process dies, so a crashed publisher can be replaced at once. The segment
+  * is never removed, a new publisher reuses it and readers stay attached.
+  *
+  * Not thread-safe; open() and close() must be called from the same thread (Windows
+  * mutexes are owned by threads). */
+class TrackBridgePublisher
+{
+public:
+    enum OpenResult
+    {
+        //! This process publishes now
+        OPENED,
+        //! Another process publishes under this name
+        BUSY,
+        //! The segment could not be created or mapped (logged)
+        FAILED
+    };
+
+    TrackBridgePublisher();
+    ~TrackBridgePublisher();
+
+    TrackBridgePublisher(const TrackBridgePublisher&) = delete;
+    TrackBridgePublisher& operator=(const TrackBridgePublisher&) = delete;
+
+    //! Takes the publisher lock and maps the segment, creating or growing it if needed
+    /** \param maxTracks tracks per frame; beyond that tracks are dropped (counted in truncatedTracks())
+      * \param tracks first frame, replaces whatever a predecessor left behind: the tracks a
+      *        subscriber inherited when it takes over, or an empty table
+      * \param echoGeneration see publish() */
+    OpenResult open(const char* name, int maxTracks, const TrackTable& tracks, unsigned int echoGeneration);
+    //! Marks the segment closed, wakes the readers and releases the publisher lock
+    void close();
+    bool isOpen() const { return header != nullptr; }
+
+    //! Publishes the live tracks of a frame, sorted by ID
+    /** Echo spans of the records of this generation (EchoSpan::generation()) must be valid for
+      * the call; records of other generations are published without echoes. */
+    void publish(const TrackTable& tracks, long long arrivalNs, unsigned int echoGeneration);
+
+    //! Frames published since open(), not counting the one open() starts with
+    unsigned long long frames() const { return frameCount; }
+    //! Tracks dropped for exceeding the segment's capacity
+    unsigned long long truncatedTracks() const { return truncated; }
+
+private:
+    //! Lays the segment out for maxTracks, readers of the old layout detach
+    void initialize(uint32_t maxTracks, uint64_t slotSize);
+
+    bridge::SegmentHeader* header;
+    size_t mappingSize;
+    uint64_t nextFrame;
+    unsigned long long frameCount;
+    unsigned long long truncated;
+#if PLATFORM_WINDOWS
+    void* fileMapping;
+    void* mutex;
+#else
+    int file;
+#endif
+};
+
+//! Maps a track bridge segment read-only and copies out the latest frame
+/** Not thread-safe, except for wake(). */
+class TrackBridgeReader
+{
+public:
+    enum ReadResult
+    {
+        //! A new frame was copied
+        FRAME,
+        //! Nothing new since the last read
+        NO_FRAME,
+        //! The publisher shut down; its frames are not delivered anymore
+        CLOSED,
+        //! The segment was laid out anew; close() and open() again
+        DETACHED
+    };
+
+    TrackBridgeReader();
+    ~TrackBridgeReader();
+
+    TrackBridgeReader(const TrackBridgeReader&) = delete;
+    TrackBridgeReader& operator=(const TrackBridgeReader&) = delete;
+
+    //! Maps an existing segment
+    /** \return false if there is none yet (no publisher ever opened it), it is being laid out
+      *         or its publisher closed it */
+    bool open(const char* name);
+    void close();
+    bool isOpen() const { return header != nullptr; }
+
+    //! Copies the latest frame into snapshot if it is newer than the previous one read
+    /** Tracks are sorted by ID and their echoes point into snapshot.echoes; the version is
+      * left alone. Frames the reader was too slow for are skipped (counted in skippedFrames()). */
+    ReadResult read(TrackSnapshot& snapshot);
+    //! Sleeps until the publisher publishes or closes, at most timeoutMs
+    /** Linux only (futex on the shared segment); elsewhere returns false at once and the
+      * caller polls. \return false if the wait was not possible */
+    bool wait(int timeoutMs);
+    //! Ends wait() early; may be called from any thread while the reader is open
+    void wake();
+    //! Some process holds the publisher lock right now
+    /** A crashed publisher leaves its last frame behind without closing the segment; this
+      * tells a quiet publisher from a dead one. */
+    bool publisherAlive() const;
+
+    //! Frames the reader missed because newer ones were published before it read again
+    unsigned long long skippedFrames() const { return skipped; }
+    //! Copies repeated because the publisher overwrote the slot meanwhile
+    unsigned long long retries() const { return retryCount; }
+
+private:
+    const bridge::SegmentHeader* header;
+    size_t mappingSize;
+    uint32_t generation;
+    uint64_t lastFrame;
+    //! publishCount at the last read, wait() sleeps while it is unchanged
+    uint32_t lastPublishCount;
+    unsigned long long skipped;
+    unsigned long long retryCount;
+    //! Segment name, for the publisher lock probe
+    std::string name;
+#if PLATFORM_WINDOWS
+    void* fileMapping;
+#else
+    int file;
+#endif
+};
+
+} // #end namespace pharus
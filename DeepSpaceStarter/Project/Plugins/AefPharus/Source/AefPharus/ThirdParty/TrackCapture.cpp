@@ -0,0 +1,381 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#include "TrackCapture.h"
+#include "UDPManager.h"
+
+#include "AefPharus.h" // Module logging
+#include <algorithm>
+#include <cstring>
+
+#if PLATFORM_WINDOWS
+    #include "Windows/WindowsHWrapper.h"
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <errno.h>
+#endif
+
+using namespace pharus;
+
+namespace
+{
+    uint64_t recordSpace(int payload)
+    {
+        return sizeof(capture::RecordHeader) + ((uint64_t(payload) + 7) & ~uint64_t(7));
+    }
+}
+
+//--------------------------------------------------------------------------------
+// TrackCaptureWriter
+//--------------------------------------------------------------------------------
+
+TrackCaptureWriter::TrackCaptureWriter()
+: mapping(nullptr)
+, chunkOffset(0)
+, chunkSize(DEFAULT_CHUNK_SIZE)
+, used(0)
+, recordCount(0)
+#if PLATFORM_WINDOWS
+, file(INVALID_HANDLE_VALUE)
+#else
+, file(-1)
+#endif
+{
+}
+
+TrackCaptureWriter::~TrackCaptureWriter()
+{
+    close();
+}
+
+bool TrackCaptureWriter::open(const char* path, uint64_t _chunkSize)
+{
+    close();
+    // Windows maps at 64 KiB granularity
+    chunkSize = std::max<uint64_t>((_chunkSize + 0xFFFF) & ~uint64_t(0xFFFF), 0x10000);
+    chunkOffset = 0;
+    used = 0;
+    recordCount = 0;
+
+#if PLATFORM_WINDOWS
+    file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackCaptureWriter: Unable to create %hs (error %u)"), path, (unsigned)GetLastError());
+        return false;
+    }
+#else
+    file = ::open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (file < 0)
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackCaptureWriter: Unable to create %hs (errno %d)"), path, errno);
+        return false;
+    }
+#endif
+
+    if (!mapChunk(0))
+    {
+        close();
+        return false;
+    }
+
+    capture::FileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, capture::MAGIC, sizeof(header.magic));
+    header.version = capture::VERSION;
+    header.headerSize = sizeof(capture::FileHeader);
+    header.chunkSize = chunkSize;
+    header.startNs = UDPManager::GetTimestampNow();
+    memcpy(mapping, &header, sizeof(header));
+    used = sizeof(header);
+    return true;
+}
+
+void TrackCaptureWriter::close()
+{
+    unmapChunk();
+
+    // drop the unused, zero-filled rest of the last chunk
+    const uint64_t size = chunkOffset + used;
+#if PLATFORM_WINDOWS
+    if (file != INVALID_HANDLE_VALUE)
+    {
+        LARGE_INTEGER end;
+        end.QuadPart = (LONGLONG)size;
+        if (size > 0 && SetFilePointerEx(file, end, nullptr, FILE_BEGIN))
+            SetEndOfFile(file);
+        CloseHandle(file);
+        file = INVALID_HANDLE_VALUE;
+    }
+#else
+    if (file >= 0)
+    {
+        if (size > 0 && ftruncate(file, (off_t)size) != 0)
+        {
+            UE_LOG(LogAefPharus, Warning, TEXT("TrackCaptureWriter: Unable to trim the capture (errno %d)"), errno);
+        }
+        ::close(file);
+        file = -1;
+    }
+#endif
+}
+
+bool TrackCaptureWriter::append(const InetAddr& source, const char* data, int size, long long arrivalNs)
+{
+    if (!mapping || size <= 0)
+        return mapping != nullptr;
+
+    const uint64_t space = recordSpace(size);
+    if (space > chunkSize)
+        return true;  // cannot happen with datagram-sized payloads
+
+    if (used + space > chunkSize)
+    {
+        if (chunkSize - used >= sizeof(capture::RecordHeader))
+        {
+            capture::RecordHeader pad;
+            memset(&pad, 0, sizeof(pad));
+            pad.size = capture::PAD_RECORD;
+            memcpy(mapping + used, &pad, sizeof(pad));
+        }
+        const uint64_t next = chunkOffset + chunkSize;
+        used = chunkSize;
+        if (!mapChunk(next))
+        {
+            UE_LOG(LogAefPharus, Error, TEXT("TrackCaptureWriter: Unable to grow the capture beyond %llu MiB, capture stopped"),
+                (unsigned long long)(next >> 20));
+            close();
+            return false;
+        }
+        used = 0;
+    }
+
+    capture::RecordHeader header;
+    header.size = size;
+    header.port = source.sin_port;
+    header.reserved = 0;
+    header.addr = (uint32_t)source.sin_addr.s_addr;
+    header.reserved2 = 0;
+    header.arrivalNs = arrivalNs;
+    memcpy(mapping + used, &header, sizeof(header));
+    memcpy(mapping + used + sizeof(header), data, size);
+    used += space;
+    ++recordCount;
+    return true;
+}
+
+bool TrackCaptureWriter::mapChunk(uint64_t offset)
+{
+    unmapChunk();
+
+#if PLATFORM_WINDOWS
+    // creating a mapping larger than the file extends it
+    const uint64_t end = offset + chunkSize;
+    HANDLE fileMapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, (DWORD)(end >> 32), (DWORD)end, nullptr);
+    if (!fileMapping)
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackCaptureWriter: CreateFileMapping failed (error %u)"), (unsigned)GetLastError());
+        return false;
+    }
+    mapping = (char*)MapViewOfFile(fileMapping, FILE_MAP_WRITE, (DWORD)(offset >> 32), (DWORD)offset, (SIZE_T)chunkSize);
+    CloseHandle(fileMapping);  // the view keeps it alive
+    if (!mapping)
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackCaptureWriter: MapViewOfFile failed (error %u)"), (unsigned)GetLastError());
+        return false;
+    }
+#else
+    // reserve the blocks now: a write into a mapped hole on a full disk raises SIGBUS
+#if PLATFORM_LINUX
+    const int err = posix_fallocate(file, (off_t)offset, (off_t)chunkSize);
+#else
+    const int err = ftruncate(file, (off_t)(offset + chunkSize)) == 0 ? 0 : errno;
+#endif
+    if (err != 0)
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackCaptureWriter: Unable to extend the capture (errno %d)"), err);
+        return false;
+    }
+    void* view = mmap(nullptr, (size_t)chunkSize, PROT_READ | PROT_WRITE, MAP_SHARED, file, (off_t)offset);
+    if (view == MAP_FAILED)
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackCaptureWriter: mmap failed (errno %d)"), errno);
+        return false;
+    }
+    mapping = (char*)view;
+#endif
+
+    chunkOffset = offset;
+    return true;
+}
+
+void TrackCaptureWriter::unmapChunk()
+{
+    if (!mapping)
+        return;
+#if PLATFORM_WINDOWS
+    UnmapViewOfFile(mapping);
+#else
+    munmap(mapping, (size_t)chunkSize);
+#endif
+    mapping = nullptr;
+}
+
+//--------------------------------------------------------------------------------
+// TrackCaptureReader
+//--------------------------------------------------------------------------------
+
+TrackCaptureReader::TrackCaptureReader()
+: mapping(nullptr)
+, fileSize(0)
+, chunkSize(0)
+, position(0)
+, firstRecord(0)
+, captureStartNs(0)
+#if PLATFORM_WINDOWS
+, file(INVALID_HANDLE_VALUE)
+, fileMapping(nullptr)
+#else
+, file(-1)
+#endif
+{
+}
+
+TrackCaptureReader::~TrackCaptureReader()
+{
+    close();
+}
+
+bool TrackCaptureReader::open(const char* path)
+{
+    close();
+
+#if PLATFORM_WINDOWS
+    file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    LARGE_INTEGER size;
+    if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &size))
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackCaptureReader: Unable to open %hs (error %u)"), path, (unsigned)GetLastError());
+        close();
+        return false;
+    }
+    fileSize = (uint64_t)size.QuadPart;
+#else
+    file = ::open(path, O_RDONLY | O_CLOEXEC);
+    struct stat st;
+    if (file < 0 || fstat(file, &st) != 0)
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackCaptureReader: Unable to open %hs (errno %d)"), path, errno);
+        close();
+        return false;
+    }
+    fileSize = (uint64_t)st.st_size;
+#endif
+
+    if (fileSize < sizeof(capture::FileHeader))
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackCaptureReader: %hs is not a TrackLink capture"), path);
+        close();
+        return false;
+    }
+
+#if PLATFORM_WINDOWS
+    fileMapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    mapping = fileMapping ? (const char*)MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+#else
+    void* view = mmap(nullptr, (size_t)fileSize, PROT_READ, MAP_SHARED, file, 0);
+    mapping = view != MAP_FAILED ? (const char*)view : nullptr;
+#endif
+    if (!mapping)
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackCaptureReader: Unable to map %hs"), path);
+        close();
+        return false;
+    }
+
+    capture::FileHeader header;
+    memcpy(&header, mapping, sizeof(header));
+    if (memcmp(header.magic, capture::MAGIC, sizeof(header.magic)) != 0 || header.version != capture::VERSION
+        || header.headerSize < sizeof(header) || header.chunkSize <= header.headerSize)
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackCaptureReader: %hs is not a TrackLink capture (version %u)"), path, header.version);
+        close();
+        return false;
+    }
+    chunkSize = header.chunkSize;
+    captureStartNs = header.startNs;
+    firstRecord = header.headerSize;
+    position = firstRecord;
+    return true;
+}
+
+void TrackCaptureReader::close()
+{
+#if PLATFORM_WINDOWS
+    if (mapping)
+        UnmapViewOfFile(mapping);
+    if (fileMapping)
+        CloseHandle(fileMapping);
+    if (file != INVALID_HANDLE_VALUE)
+        CloseHandle(file);
+    fileMapping = nullptr;
+    file = INVALID_HANDLE_VALUE;
+#else
+    if (mapping)
+        munmap((void*)mapping, (size_t)fileSize);
+    if (file >= 0)
+        ::close(file);
+    file = -1;
+#endif
+    mapping = nullptr;
+    fileSize = 0;
+    position = 0;
+}
+
+bool TrackCaptureReader::next(Record& record)
+{
+    if (!mapping)
+        return false;
+
+    while (position + sizeof(capture::RecordHeader) <= fileSize)
+    {
+        const uint64_t chunkEnd = (position / chunkSize + 1) * chunkSize;
+        if (chunkEnd - position < sizeof(capture::RecordHeader))
+        {
+            position = chunkEnd;
+            continue;
+        }
+
+        capture::RecordHeader header;
+        memcpy(&header, mapping + position, sizeof(header));
+        if (header.size == capture::PAD_RECORD)
+        {
+            position = chunkEnd;
+            continue;
+        }
+        // end marker, or a record cut off by a crash
+        const uint64_t end = position + recordSpace(header.size);
+        if (header.size <= 0 || end > chunkEnd || position + sizeof(header) + header.size > fileSize)
+            return false;
+
+        record.source.sin_family = AF_INET;
+        record.source.sin_port = header.port;
+        record.source.sin_addr.s_addr = header.addr;
+        record.data = mapping + position + sizeof(header);
+        record.size = header.size;
+        record.arrivalNs = header.arrivalNs;
+        position = end;
+        return true;
+    }
+    return false;
+}
+
+void TrackCaptureReader::rewind()
+{
+    if (mapping)
+        position = firstRecord;
+}
@@ -0,0 +1,160 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#pragma once
+
+#include "InetAddr.h"
+
+#include <cstdint>
+
+namespace pharus
+{
+
+//! On-disk layout of a TrackLink capture (all fields host byte order, 8-byte aligned)
+/** File header, then one record per datagram:
+  *
+  *     RecordHeader | payload | padding to 8 bytes
+  *
+  * The file grows in chunks of FileHeader::chunkSize; a record never crosses a chunk
+  * boundary, the rest of a chunk is skipped with a record of size PAD_RECORD (or is too
+  * small to hold a header). A record of size 0 ends the capture: the file is extended
+  * with zeros, so a capture cut short by a crash ends at the last complete record. */
+namespace capture
+{
+    static constexpr char MAGIC[8] = { 'P', 'H', 'R', 'S', 'C', 'A', 'P', '\0' };
+    static constexpr uint32_t VERSION = 1;
+    //! RecordHeader::size of a record that pads to the end of its chunk
+    static constexpr int32_t PAD_RECORD = -1;
+
+    struct FileHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t headerSize;
+        uint64_t chunkSize;
+        //! TrackLinkClient::timestampNow() when the capture was opened
+        int64_t startNs;
+    };
+
+    struct RecordHeader
+    {
+        //! Payload bytes, 0 = end of capture, PAD_RECORD = skip to the next chunk
+        int32_t size;
+        //! Sender port and IPv4 address, network byte order as in sockaddr_in
+        uint16_t port;
+        uint16_t reserved;
+        uint32_t addr;
+        uint32_t reserved2;
+        //! Arrival time (TrackLinkClient::timestampNow() clock)
+        int64_t arrivalNs;
+    };
+
+    static_assert(sizeof(FileHeader) == 32, "capture file header layout");
+    static_assert(sizeof(RecordHeader) == 24, "capture record header layout");
+}
+
+//! Appends raw datagrams to a memory-mapped capture file
+/** Appending is a memcpy into the mapping; the system writes the pages back in the
+  * background, so capturing does not add file I/O to the receive path. The file grows
+  * one chunk at a time (disk space is reserved up front on Linux) and is trimmed to
+  * its used size by close().
+  *
+  * Not thread-safe, receive thread only. */
+class TrackCaptureWriter
+{
+public:
+    //! Chunk the file grows by; also the size of the mapping
+    static constexpr uint64_t DEFAULT_CHUNK_SIZE = 64ull * 1024 * 1024;
+
+    TrackCaptureWriter();
+    ~TrackCaptureWriter();
+
+    TrackCaptureWriter(const TrackCaptureWriter&) = delete;
+    TrackCaptureWriter& operator=(const TrackCaptureWriter&) = delete;
+
+    //! Creates (or truncates) the file
+    bool open(const char* path, uint64_t chunkSize = DEFAULT_CHUNK_SIZE);
+    //! Trims the file to the records written and closes it
+    void close();
+    bool isOpen() const { return mapping != nullptr; }
+
+    //! Appends one datagram
+    /** \return false if the file could not grow (disk full); the writer is closed then */
+    bool append(const InetAddr& source, const char* data, int size, long long arrivalNs);
+
+    unsigned long long records() const { return recordCount; }
+    //! File size so far, in bytes
+    unsigned long long bytes() const { return chunkOffset + used; }
+
+private:
+    //! Unmaps the current chunk and maps the next one
+    bool mapChunk(uint64_t offset);
+    void unmapChunk();
+
+    char* mapping;
+    //! File offset of the mapped chunk
+    uint64_t chunkOffset;
+    uint64_t chunkSize;
+    //! Bytes used in the mapped chunk
+    uint64_t used;
+    unsigned long long recordCount;
+#if PLATFORM_WINDOWS
+    void* file;
+#else
+    int file;
+#endif
+};
+
+//! Reads a capture file through a read-only mapping of the whole file
+/** Records are returned in capture order without copying; payloads stay valid until
+  * close(). */
+class TrackCaptureReader
+{
+public:
+    //! One captured datagram
+    struct Record
+    {
+        InetAddr source;
+        const char* data = nullptr;
+        int size = 0;
+        long long arrivalNs = 0;
+    };
+
+    TrackCaptureReader();
+    ~TrackCaptureReader();
+
+    TrackCaptureReader(const TrackCaptureReader&) = delete;
+    TrackCaptureReader& operator=(const TrackCaptureReader&) = delete;
+
+    //! Maps the file and checks its header
+    bool open(const char* path);
+    void close();
+    bool isOpen() const { return mapping != nullptr; }
+
+    //! Next record
+    /** \return false at the end of the capture */
+    bool next(Record& record);
+    //! Back to the first record
+    void rewind();
+
+    //! TrackLinkClient::timestampNow() when the capture was started
+    long long startNs() const { return captureStartNs; }
+
+private:
+    const char* mapping;
+    uint64_t fileSize;
+    uint64_t chunkSize;
+    uint64_t position;
+    //! Offset of the first record
+    uint64_t firstRecord;
+    long long captureStartNs;
+#if PLATFORM_WINDOWS
+    void* file;
+    void* fileMapping;
+#else
+    int file;
+#endif
+};
+
+} // #end namespace pharus
@@ -0,0 +1,134 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#include "TrackFrameAssembler.h"
+
+#include "AefPharus.h" // Module logging
+#include <algorithm>
+#include <cstring>
+
+using namespace pharus;
+
+namespace
+{
+    uint64_t senderKey(const InetAddr& source)
+    {
+        // both in network byte order, only used for equality; port 0 never sends
+        return ((uint64_t)source.sin_addr.s_addr << 16) | source.sin_port;
+    }
+}
+
+TrackFrameAssembler::TrackFrameAssembler(int maxSenders, int _bufferSize, long long _timeoutNs)
+: senders(std::max(maxSenders, 1))
+, bufferSize(_bufferSize)
+, timeoutNs(_timeoutNs)
+{
+}
+
+TrackFrameAssembler::Sender& TrackFrameAssembler::findSender(uint64_t key, long long now)
+{
+    // a handful of senders at most: a linear scan beats any index. Slots fill from the
+    // front and are never freed, so the first free one ends the search
+    Sender* oldest = &senders[0];
+    for (Sender& sender : senders)
+    {
+        if (sender.key == key)
+            return sender;
+        if (sender.key == 0 || sender.lastSeenNs < oldest->lastSeenNs)
+            oldest = &sender;
+        if (oldest->key == 0)
+            break;
+    }
+
+    // replace a free or the least recently seen slot; its buffer is reused
+    if (oldest->key != 0 && oldest->size > 0)
+    {
+        ++statEvictions;
+        if (now - oldest->lastSeenNs < SENDER_EXPIRY_NS)
+        {
+            UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: More than %d senders on one port, dropping a partial frame"), (int)senders.size());
+        }
+    }
+    oldest->key = key;
+    oldest->size = 0;
+    return *oldest;
+}
+
+bool TrackFrameAssembler::add(const InetAddr& source, const char* data, int size, long long arrivalNs, Frame& frame)
+{
+    if (size <= 0)
+        return false;
+
+    Sender& sender = findSender(senderKey(source), arrivalNs);
+    sender.lastSeenNs = arrivalNs;
+
+    if (sender.size > 0 && arrivalNs - sender.firstArrivalNs > timeoutNs)
+    {
+        UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Incomplete frame timed out, dropping"));
+        ++statTimeouts;
+        sender.size = 0;
+    }
+
+    // complete frame in a single datagram (the usual case): no copy
+    if (sender.size == 0 && data[size - 1] == 't')
+    {
+        frame.data = data;
+        frame.size = size;
+        frame.arrivalNs = arrivalNs;
+        return true;
+    }
+
+    // frame spans several datagrams: collect until the trailing 't'
+    if (sender.size + size > bufferSize)
+    {
+        UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Packet exceeds buffer, dropping"));
+        ++statOverflows;
+        sender.size = 0;
+        return false;
+    }
+    if (sender.buffer.empty())
+        sender.buffer.resize(bufferSize);
+    if (sender.size == 0)
+        sender.firstArrivalNs = arrivalNs;
+    memcpy(sender.buffer.data() + sender.size, data, size);
+    sender.size += size;
+    if (sender.buffer[sender.size - 1] != 't')
+        return false;
+
+    frame.data = sender.buffer.data();
+    frame.size = sender.size;
+    frame.arrivalNs = sender.firstArrivalNs;
+    sender.size = 0;
+    return true;
+}
+
+int TrackFrameAssembler::expire(long long now)
+{
+    int dropped = 0;
+    for (Sender& sender : senders)
+    {
+        if (sender.size > 0 && now - sender.firstArrivalNs > timeoutNs)
+        {
+            sender.size = 0;
+            ++dropped;
+        }
+    }
+    if (dropped > 0)
+    {
+        UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: %d incomplete frame(s) timed out, dropping"), dropped);
+        statTimeouts += dropped;
+    }
+    return dropped;
+}
+
+int TrackFrameAssembler::activeSenders(long long now) const
+{
+    int count = 0;
+    for (const Sender& sender : senders)
+    {
+        if (sender.key != 0 && now - sender.lastSeenNs < SENDER_EXPIRY_NS)
+            ++count;
+    }
+    return count;
+}
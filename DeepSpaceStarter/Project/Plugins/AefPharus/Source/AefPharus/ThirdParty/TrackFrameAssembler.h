@@ -0,0 +1,89 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#pragma once
+
+#include "InetAddr.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace pharus
+{
+
+//! Reassembles TrackLink frames that span several datagrams, separately per sender
+/** A frame ends with the 't' of its last track record. Senders sharing a port (two
+  * Pharus servers, a simulator next to a live server) interleave their datagrams, so
+  * every sender (IP and port) gets its own reassembly buffer. The sender table is
+  * bounded and the buffers are allocated once per table slot; nothing is allocated in
+  * the steady state.
+  *
+  * Drop policies, each counted:
+  * - timeout: a partial frame older than the timeout is dropped when its sender sends
+  *   again or expire() is called
+  * - overflow: a frame larger than the buffer is dropped
+  * - eviction: a new sender with a full table replaces the least recently seen one,
+  *   dropping its partial frame
+  *
+  * Not thread-safe, receive thread only. */
+class TrackFrameAssembler
+{
+public:
+    //! A complete frame, valid until the next call
+    struct Frame
+    {
+        const char* data = nullptr;
+        int size = 0;
+        //! Arrival time of the frame's first datagram
+        long long arrivalNs = 0;
+    };
+
+    //! A sender not seen for this long no longer counts as active and its slot may be reused
+    static constexpr long long SENDER_EXPIRY_NS = 1000000000LL;
+
+    //! \param maxSenders sender table size (at least 1)
+    //! \param bufferSize largest frame in bytes
+    //! \param timeoutNs age at which a partial frame is dropped
+    TrackFrameAssembler(int maxSenders, int bufferSize, long long timeoutNs);
+
+    //! Adds one datagram from source
+    /** \return true if it completed a frame, then frame points into data (single datagram
+      *         frame) or into the sender's buffer */
+    bool add(const InetAddr& source, const char* data, int size, long long arrivalNs, Frame& frame);
+    //! Drops the partial frames older than the timeout at time now
+    /** \return number of frames dropped */
+    int expire(long long now);
+
+    //! Senders seen within SENDER_EXPIRY_NS before now
+    int activeSenders(long long now) const;
+    //! Partial frames dropped for being too old
+    unsigned long long timeouts() const { return statTimeouts; }
+    //! Frames dropped for exceeding the buffer
+    unsigned long long overflows() const { return statOverflows; }
+    //! Partial frames dropped because their sender was replaced in the table
+    unsigned long long evictions() const { return statEvictions; }
+
+private:
+    struct Sender
+    {
+        //! IPv4 address and port; 0 = free slot
+        uint64_t key = 0;
+        long long lastSeenNs = 0;
+        //! Partial frame, size 0 if none
+        std::vector<char> buffer;
+        int size = 0;
+        long long firstArrivalNs = 0;
+    };
+
+    Sender& findSender(uint64_t key, long long now);
+
+    std::vector<Sender> senders;
+    int bufferSize;
+    long long timeoutNs;
+    unsigned long long statTimeouts = 0;
+    unsigned long long statOverflows = 0;
+    unsigned long long statEvictions = 0;
+};
+
+} // #end namespace pharus
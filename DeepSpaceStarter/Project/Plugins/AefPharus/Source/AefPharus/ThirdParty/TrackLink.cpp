@@ -9,12 +9,30 @@
 
 #include "TrackLink.h"
 #include "UDPManager.h"
+#include "TrackLinkReactor.h"
+#include "TrackLinkWakeup.h"
+#include "TrackLinkFrame.h"
+#include "TrackFrameAssembler.h"
+#include "TrackCapture.h"
+#include "TrackSnapshot.h"
+#include "TrackBridge.h"
+#include "TuioDecoder.h"
 
 #include "AefPharus.h" // Module logging
 #include <string>
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <cstring>
+
+#if PLATFORM_WINDOWS
+    #include "Windows/WindowsHWrapper.h"    // GetThreadTimes()
+#elif PLATFORM_LINUX
+    #include <time.h>                       // CLOCK_THREAD_CPUTIME_ID
+#endif
 
 using namespace pharus;
 
@@ -24,32 +42,207 @@ ITrackReceiver::ITrackReceiver()
 ITrackReceiver::~ITrackReceiver()
 {}
 
+namespace
+{
+    //! Receive thread name, "PharusReceive <port>" unless the options name it
+    std::string threadName(const TrackLinkOptions& options)
+    {
+        return options.thread.name.empty() ? "PharusReceive " + std::to_string(options.port) : options.thread.name;
+    }
+
+    TrackLinkOptions makeOptions(bool multicast, const char* localIP, unsigned short port, const char* multicastGroup)
+    {
+        TrackLinkOptions options;
+        options.multicast = multicast;
+        options.localIP = localIP;
+        options.port = port;
+        options.multicastGroup = multicastGroup;
+        return options;
+    }
+}
+
 TrackLinkClient::TrackLinkClient(bool _multicast, unsigned short _port, const char* _multicastGroup)
-: udpman(nullptr)
-, threadExit(false)
-, multicast(_multicast)
-, localIP(nullptr)
-, port(_port)
-, multicastGroup(_multicastGroup)
+: TrackLinkClient(makeOptions(_multicast, nullptr, _port, _multicastGroup))
 {
-   recvThread = std::thread(&TrackLinkClient::receiveData, this);
 }
 
 TrackLinkClient::TrackLinkClient(bool _multicast, const char* _localIP, unsigned short _port, const char* _multicastGroup)
-	: udpman(nullptr)
-	, threadExit(false)
-	, multicast(_multicast)
-	, localIP(_localIP)
-	, port(_port)
-	, multicastGroup(_multicastGroup)
+	: TrackLinkClient(makeOptions(_multicast, _localIP, _port, _multicastGroup))
 {
-	recvThread = std::thread(&TrackLinkClient::receiveData, this);
+}
+
+TrackLinkClient::TrackLinkClient(const TrackLinkOptions& options)
+: udpman(nullptr)
+, threadExit(false)
+, prevFrameArrivalNs(0)
+, prevFrameIntervalNs(0)
+, jitterNs(0.0)
+, replaySpeed(std::max(0.0, options.replaySpeed))
+, bridgeMode(options.replayFile ? BRIDGE_OFF : options.bridge)
+, bridgeName(options.bridgeName && *options.bridgeName ? options.bridgeName : "AefPharus_" + std::to_string(options.port))
+, bridgeMaxTracks(std::max(1, options.bridgeMaxTracks))
+, bridgeRetryNs(0)
+, bridgeWarned(false)
+, bridgeFront(0)
+, bridgeVersion(0)
+, bridgeDropNs(0)
+, bridgeTakeoverNs(0)
+, bridgeReconcileFrame(0)
+, snapshotVersion(0)
+, multicast(options.multicast)
+, localIP(options.localIP)
+, port(options.port)
+, multicastGroup(options.multicastGroup)
+, reactor(options.busyPoll || options.replayFile || options.bridge != BRIDGE_OFF ? nullptr : options.reactor)
+, receiveBufferSize(options.receiveBufferSize)
+, busyPoll(options.busyPoll && !options.replayFile)
+, busyPollSpinUs(std::max(0, options.busyPollSpinUs))
+, busyPollYieldUs(std::max(0, options.busyPollYieldUs))
+, busyPollSocketUs(std::max(0, options.busyPollSocketUs))
+{
+    // batch slots are allocated once per client, reassembly buffers once per sender
+    batchStorage.resize(RECV_BATCH_SIZE * RECV_BUFFER_SIZE);
+    batch.resize(RECV_BATCH_SIZE);
+    for (int i = 0; i < RECV_BATCH_SIZE; ++i)
+    {
+        batch[i].pBuff = batchStorage.data() + i * RECV_BUFFER_SIZE;
+        batch[i].iCapacity = RECV_BUFFER_SIZE;
+        batch[i].iSize = 0;
+    }
+    assembler = std::make_unique<TrackFrameAssembler>(std::max(1, options.maxSenders), RECV_BUFFER_SIZE,
+        (long long)std::max(1, options.reassemblyTimeoutMs) * 1000000LL);
+    echoArena.reserve(RECV_BUFFER_SIZE / wire::ECHO_SIZE);
+
+    if (options.snapshots)
+        snapshotBuffer = std::make_unique<TrackSnapshotBuffer>();
+
+    if (options.protocol == PROTOCOL_TUIO)
+    {
+        tuioDecoder = std::make_unique<TuioDecoder>(options.tuioArea);
+        UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Receiving TUIO, tracking area %.2f x %.2f m"), options.tuioArea.x, options.tuioArea.y);
+    }
+
+    if (options.replayFile)
+    {
+        replayReader = std::make_unique<TrackCaptureReader>();
+        if (!replayReader->open(options.replayFile))
+            throw std::runtime_error("TrackLinkClient: unable to open the replay file");
+        UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Replaying %hs at %s"), options.replayFile,
+            replaySpeed > 0.0 ? *FString::Printf(TEXT("%.2gx speed"), replaySpeed) : TEXT("full speed"));
+    }
+    else if (options.captureFile)
+    {
+        // a capture that cannot be written must not cost the live tracking
+        captureWriter = std::make_unique<TrackCaptureWriter>();
+        if (captureWriter->open(options.captureFile))
+        {
+            UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Capturing datagrams to %hs"), options.captureFile);
+        }
+        else
+        {
+            captureWriter.reset();
+        }
+    }
+
+    if (options.replayFile && options.bridge != BRIDGE_OFF)
+    {
+        UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: The track bridge does not apply to a replay - not bridging"));
+    }
+    if (bridgeMode == BRIDGE_PUBLISH || bridgeMode == BRIDGE_AUTO)
+    {
+        bridgePublisher = std::make_unique<TrackBridgePublisher>();
+    }
+    if (bridgeMode == BRIDGE_SUBSCRIBE || bridgeMode == BRIDGE_AUTO)
+    {
+        bridgeReader = std::make_unique<TrackBridgeReader>();
+        bridgeFrames[0] = std::make_unique<TrackSnapshot>();
+        bridgeFrames[1] = std::make_unique<TrackSnapshot>();
+        bridgeDiff = std::make_unique<TrackSnapshotDiff>();
+    }
+
+    // more sockets on the same port; every one of them parses and publishes on its own
+    if (options.receiveWorkers > 1)
+    {
+        if (multicast)
+        {
+            // every socket that joined the group gets its own copy of every datagram
+            UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: %d receive workers requested, but multicast delivers every datagram to every socket - using one"), options.receiveWorkers);
+        }
+        else if (bridgeMode != BRIDGE_OFF)
+        {
+            UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: %d receive workers requested, but the track bridge carries one frame stream - using one"), options.receiveWorkers);
+        }
+        else if (replayReader || captureWriter)
+        {
+            UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: %d receive workers requested, but capture and replay use one datagram stream - using one"), options.receiveWorkers);
+        }
+        else if (!PLATFORM_LINUX)
+        {
+            // only Linux balances datagrams over reuse-port sockets, elsewhere one socket gets everything
+            UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: %d receive workers requested, but SO_REUSEPORT load balancing is Linux only - using one"), options.receiveWorkers);
+        }
+        else
+        {
+            TrackLinkOptions workerOptions = options;
+            workerOptions.receiveWorkers = 1;
+            workerOptions.snapshots = true;
+            // a shared reactor thread would serialize the sockets again
+            workerOptions.reactor = nullptr;
+            for (int i = 1; i < options.receiveWorkers; ++i)
+            {
+                workerOptions.thread.name = threadName(options) + " #" + std::to_string(i);
+                workers.push_back(std::make_unique<TrackLinkClient>(workerOptions));
+            }
+
+            if (!snapshotBuffer)
+                snapshotBuffer = std::make_unique<TrackSnapshotBuffer>();
+            merger = std::make_unique<TrackSnapshotMerger>();
+            mergeParts.reserve(workers.size() + 1);
+        }
+    }
+
+    // polling would stall every other socket of a shared reactor thread
+    if (options.busyPoll && options.reactor)
+        UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Busy-poll receive uses a dedicated thread instead of the shared reactor"));
+    // the bridge thread changes roles and sleeps on the segment, which a reactor cannot do
+    if (bridgeMode != BRIDGE_OFF && options.reactor)
+        UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: The track bridge uses a dedicated thread instead of the shared reactor"));
+
+    if (reactor)
+    {
+        reactor->addClient(this);
+    }
+    else
+    {
+        TrackLinkThreadOptions threadOptions = options.thread;
+        threadOptions.name = threadName(options);
+        wakeup = std::make_unique<TrackLinkWakeup>();
+        if (!recvThread.start([this]() { if (replayReader) replayData(); else if (bridgeReader) bridgeData(); else receiveData(); }, threadOptions))
+            throw std::runtime_error("TrackLinkClient: unable to start the receive thread");
+    }
 }
 
 TrackLinkClient::~TrackLinkClient()
 {
-    threadExit = true;
-    recvThread.join();
+    workers.clear();
+
+    if (reactor)
+    {
+        // returns once the reactor no longer touches this client
+        reactor->removeClient(this);
+        closeSocket();
+    }
+    else
+    {
+        threadExit = true;
+        wakeup->signal();
+        if (bridgeReader)
+        {
+            std::lock_guard<std::mutex> lock(bridgeMutex);
+            bridgeReader->wake();
+        }
+        recvThread.join();
+    }
 }
 
 void TrackLinkClient::registerTrackReceiver(ITrackReceiver* newReceiver)
@@ -65,16 +258,28 @@ void TrackLinkClient::registerTrackReceiver(ITrackReceiver* newReceiver)
 
     // notify new receiver about current tracks
     std::lock_guard<std::mutex> lock(recvMutex);  // RAII lock
-    for (auto iter : trackMap)
+    for (const TrackRecord& track : trackMap)
     {
-        if (iter.second.state != TS_OFF)
-            newReceiver->onTrackNew(iter.second);
+        if (track.state != TS_OFF)
+        {
+            // echoes belong to a frame that may be overwritten meanwhile, they arrive with the next update
+            TrackRecord introduction = track;
+            introduction.echoes = EchoSpan();
+            newReceiver->onTrackNew(introduction);
+        }
     }
     trackReceivers.push_back(newReceiver);
+
+    for (const std::unique_ptr<TrackLinkClient>& worker : workers)
+        worker->registerTrackReceiver(newReceiver);
+    startReplay();
 }
 
 void TrackLinkClient::unregisterTrackReceiver(ITrackReceiver* oldReceiver)
 {
+    for (const std::unique_ptr<TrackLinkClient>& worker : workers)
+        worker->unregisterTrackReceiver(oldReceiver);
+
     for (auto receiver = trackReceivers.begin(); receiver != trackReceivers.end(); ++receiver)
     {
         if (*receiver == oldReceiver)
@@ -86,185 +291,1014 @@ void TrackLinkClient::unregisterTrackReceiver(ITrackReceiver* oldReceiver)
     }
 }
 
+void TrackLinkClient::registerFrameReceiver(ITrackFrameReceiver* newReceiver)
+{
+    if (!newReceiver)
+        return;
+
+    for (const std::unique_ptr<TrackLinkClient>& worker : workers)
+        worker->registerFrameReceiver(newReceiver);
+
+    std::lock_guard<std::mutex> lock(recvMutex);
+    for (ITrackFrameReceiver* receiver : frameReceivers)
+    {
+        if (receiver == newReceiver)  // already added
+            return;
+    }
+    frameReceivers.push_back(newReceiver);
+    startReplay();
+}
+
+void TrackLinkClient::unregisterFrameReceiver(ITrackFrameReceiver* oldReceiver)
+{
+    for (const std::unique_ptr<TrackLinkClient>& worker : workers)
+        worker->unregisterFrameReceiver(oldReceiver);
+
+    std::lock_guard<std::mutex> lock(recvMutex);
+    for (auto receiver = frameReceivers.begin(); receiver != frameReceivers.end(); ++receiver)
+    {
+        if (*receiver == oldReceiver)
+        {
+            frameReceivers.erase(receiver);
+            return;
+        }
+    }
+}
+
 const TrackMap& TrackLinkClient::getTrackMap() const
 {
     return trackMap;
 }
 
+const TrackSnapshot* TrackLinkClient::acquireSnapshot()
+{
+    if (!snapshotBuffer)
+        return nullptr;
+    startReplay();
+    if (workers.empty())
+        return &snapshotBuffer->acquire();
+
+    mergeParts.clear();
+    mergeParts.push_back(&snapshotBuffer->acquire());
+    for (const std::unique_ptr<TrackLinkClient>& worker : workers)
+        mergeParts.push_back(worker->acquireSnapshot());
+    return &merger->merge(mergeParts.data(), mergeParts.size(), timestampNow());
+}
+
+TrackLinkStatistics TrackLinkClient::getStatistics() const
+{
+    TrackLinkStatistics stats;
+    stats.recvSyscalls = statRecvSyscalls.load(std::memory_order_relaxed);
+    stats.recvDatagrams = statRecvDatagrams.load(std::memory_order_relaxed);
+    stats.recvBatches = statRecvBatches.load(std::memory_order_relaxed);
+    stats.recvBytes = statRecvBytes.load(std::memory_order_relaxed);
+    stats.frames = statFrames.load(std::memory_order_relaxed);
+    stats.tracks = statTracks.load(std::memory_order_relaxed);
+    stats.malformedFrames = statMalformedFrames.load(std::memory_order_relaxed);
+    stats.outdatedFrames = statOutdatedFrames.load(std::memory_order_relaxed);
+    stats.senders = statSenders.load(std::memory_order_relaxed);
+    stats.reassemblyTimeouts = statReassemblyTimeouts.load(std::memory_order_relaxed);
+    stats.reassemblyOverflows = statReassemblyOverflows.load(std::memory_order_relaxed);
+    stats.reassemblyEvictions = statReassemblyEvictions.load(std::memory_order_relaxed);
+    stats.lastArrivalNs = statLastArrivalNs.load(std::memory_order_relaxed);
+    stats.interArrivalJitterNs = statJitterNs.load(std::memory_order_relaxed);
+    stats.socketBound = statSocketBound.load(std::memory_order_relaxed);
+    stats.kernelTimestamps = statKernelTimestamps.load(std::memory_order_relaxed);
+    stats.receiveBufferSize = statReceiveBufferSize.load(std::memory_order_relaxed);
+    stats.kernelDropCounter = statKernelDropCounter.load(std::memory_order_relaxed);
+    stats.kernelDrops = statKernelDrops.load(std::memory_order_relaxed);
+    stats.capturedDatagrams = statCapturedDatagrams.load(std::memory_order_relaxed);
+    stats.replay = replayReader != nullptr;
+    stats.replayFinished = statReplayFinished.load(std::memory_order_relaxed);
+    stats.busyPoll = busyPoll;
+    stats.busyPollSocket = statBusyPollSocket.load(std::memory_order_relaxed);
+    stats.busyPollEmpty = statBusyPollEmpty.load(std::memory_order_relaxed);
+    stats.busyPollFallbacks = statBusyPollFallbacks.load(std::memory_order_relaxed);
+    stats.receiveCpuNs = statReceiveCpuNs.load(std::memory_order_relaxed);
+    stats.receiveDelaySumNs = statReceiveDelaySumNs.load(std::memory_order_relaxed);
+    stats.receiveDelaySamples = statReceiveDelaySamples.load(std::memory_order_relaxed);
+    stats.bridgeRole = (BridgeMode)statBridgeRole.load(std::memory_order_relaxed);
+    stats.bridgeFrames = statBridgeFrames.load(std::memory_order_relaxed);
+    stats.bridgeSkippedFrames = statBridgeSkippedFrames.load(std::memory_order_relaxed);
+    stats.bridgeRetries = statBridgeRetries.load(std::memory_order_relaxed);
+    stats.bridgeTruncatedTracks = statBridgeTruncatedTracks.load(std::memory_order_relaxed);
+
+    // workers add up; timings report the worst / latest worker, socket features any worker got
+    stats.receiveWorkers = 1 + (int)workers.size();
+    for (const std::unique_ptr<TrackLinkClient>& worker : workers)
+    {
+        const TrackLinkStatistics part = worker->getStatistics();
+        stats.recvSyscalls += part.recvSyscalls;
+        stats.recvDatagrams += part.recvDatagrams;
+        stats.recvBatches += part.recvBatches;
+        stats.recvBytes += part.recvBytes;
+        stats.frames += part.frames;
+        stats.tracks += part.tracks;
+        stats.malformedFrames += part.malformedFrames;
+        stats.outdatedFrames += part.outdatedFrames;
+        stats.senders += part.senders;
+        stats.reassemblyTimeouts += part.reassemblyTimeouts;
+        stats.reassemblyOverflows += part.reassemblyOverflows;
+        stats.reassemblyEvictions += part.reassemblyEvictions;
+        stats.kernelDrops += part.kernelDrops;
+        stats.socketBound = stats.socketBound && part.socketBound;
+        stats.kernelTimestamps = stats.kernelTimestamps || part.kernelTimestamps;
+        stats.kernelDropCounter = stats.kernelDropCounter || part.kernelDropCounter;
+        stats.busyPollSocket = stats.busyPollSocket || part.busyPollSocket;
+        stats.busyPollEmpty += part.busyPollEmpty;
+        stats.busyPollFallbacks += part.busyPollFallbacks;
+        stats.receiveCpuNs = (stats.receiveCpuNs >= 0 && part.receiveCpuNs >= 0) ? stats.receiveCpuNs + part.receiveCpuNs : -1;
+        stats.receiveDelaySumNs += part.receiveDelaySumNs;
+        stats.receiveDelaySamples += part.receiveDelaySamples;
+        stats.lastArrivalNs = std::max(stats.lastArrivalNs, part.lastArrivalNs);
+        stats.interArrivalJitterNs = std::max(stats.interArrivalJitterNs, part.interArrivalJitterNs);
+    }
+    return stats;
+}
+
+long long TrackLinkClient::timestampNow()
+{
+    return UDPManager::GetTimestampNow();
+}
+
 void TrackLinkClient::receiveData()
 {
-    char recvBuf[20480];
-    int recvSize = 1;
+    // set up udp connection; the retry wait ends early on shutdown
+    while (!threadExit && !openSocket())
+    {
+        if (bridgePublisher)
+            tryPublishBridge(timestampNow());
+        wakeup->wait(1000);
+    }
+    if (udpman)
+    {
+        udpman->SetTimeoutReceive(1);
+        udpman->SetWakeup(wakeup->getHandle());
+    }
 
-    // set up udp connection
-    bool connGood = false;
-    while (!connGood && !threadExit)
+    while (!threadExit)
     {
-        udpman = std::make_unique<UDPManager>();  // FIXED: Use smart pointer
-        if (!udpman->Create())
+        if (bridgePublisher && !bridgePublisher->isOpen())
+            tryPublishBridge(timestampNow());
+        const int count = busyPoll ? busyPollSocket() : pollSocket();
+        if (count <= 0)
         {
-			UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Unable to create socket, retrying..."));
-			std::this_thread::sleep_for(std::chrono::seconds(1));
-            udpman.reset();  // Explicit reset (automatic on reassignment anyway)
-            continue;
+            // idle: drop frames of senders that stopped mid-frame, let quiet senders age out
+            expireReassembly(timestampNow());
         }
+        // the thread is ours alone, so its CPU time is the cost of receiving
+        statReceiveCpuNs.store(threadCpuTimeNs(), std::memory_order_relaxed);
+    }
 
-        bool bindOK = false;
-		if (multicast)
-		{
-			bindOK = udpman->BindMcast(multicastGroup, localIP, port);
-			UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Attempting to bind multicast %s on NIC: %s"), multicastGroup ? *FString(multicastGroup) : TEXT("239.1.1.1"), localIP ? *FString(localIP) : TEXT("INADDR_ANY"));
-		}
-        else
-		{
-            bindOK = udpman->Bind(port, localIP);
-			UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Attempting to bind unicast on NIC: %s"), localIP ? *FString(localIP) : TEXT("INADDR_ANY"));
-		}
+    closeSocket();
+    if (bridgePublisher && bridgePublisher->isOpen())
+    {
+        // subscribers drop our tracks at once instead of waiting for a timeout; auto ones take over
+        bridgePublisher->close();
+        statBridgeRole.store(BRIDGE_OFF, std::memory_order_relaxed);
+        UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Published %llu frames to the track bridge"), statBridgeFrames.load(std::memory_order_relaxed));
+    }
+}
+
+int TrackLinkClient::busyPollSocket()
+{
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point spinEnd = Clock::now() + std::chrono::microseconds(busyPollSpinUs);
+    const Clock::time_point yieldEnd = spinEnd + std::chrono::microseconds(busyPollYieldUs);
+
+    // non-blocking attempts while the budget lasts; the receive call itself paces the loop
+    udpman->SetTimeoutReceive(NO_TIMEOUT);
+    unsigned long long empty = 0;
+    int count = SOCKET_TIMEOUT;
+    while (!threadExit)
+    {
+        count = pollSocket();
+        if (count != SOCKET_TIMEOUT)
+            break;
+        ++empty;
+
+        const Clock::time_point now = Clock::now();
+        if (now >= yieldEnd)
+            break;
+        if (now >= spinEnd)
+            std::this_thread::yield();
+    }
+    statBusyPollEmpty.fetch_add(empty, std::memory_order_relaxed);
+    if (count != SOCKET_TIMEOUT || threadExit)
+        return count;
+
+    // budget used up, the tracker went quiet: sleep in select() until it is back
+    statBusyPollFallbacks.fetch_add(1, std::memory_order_relaxed);
+    udpman->SetTimeoutReceive(1);
+    return pollSocket();
+}
+
+long long TrackLinkClient::threadCpuTimeNs()
+{
+#if PLATFORM_LINUX
+    struct timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+        return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+#elif PLATFORM_WINDOWS
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+    {
+        // 100 ns units
+        const unsigned long long kernel100ns = ((unsigned long long)kernelTime.dwHighDateTime << 32) | kernelTime.dwLowDateTime;
+        const unsigned long long user100ns = ((unsigned long long)userTime.dwHighDateTime << 32) | userTime.dwLowDateTime;
+        return (long long)(kernel100ns + user100ns) * 100;
+    }
+#endif
+    return -1;
+}
+
+bool TrackLinkClient::openSocket()
+{
+    udpman = std::make_unique<UDPManager>();  // FIXED: Use smart pointer
+    if (!udpman->Create())
+    {
+        UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Unable to create socket, retrying..."));
+        udpman.reset();
+        return false;
+    }
+
+    bool bindOK = false;
+    if (multicast)
+    {
+        bindOK = udpman->BindMcast(multicastGroup, localIP, port);
+        UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Attempting to bind multicast %s on NIC: %s"), multicastGroup ? *FString(multicastGroup) : TEXT("239.1.1.1"), localIP ? *FString(localIP) : TEXT("INADDR_ANY"));
+    }
+    else
+    {
+        bindOK = udpman->Bind(port, localIP);
+        UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Attempting to bind unicast on NIC: %s"), localIP ? *FString(localIP) : TEXT("INADDR_ANY"));
+    }
+
+    if (!bindOK)
+    {
+        UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Unable to bind socket to port %d, retrying..."), port);
+        udpman->Close();
+        udpman.reset();
+        return false;
+    }
+
+    UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Successfully bound to port %d"), port);
 
-        if (!bindOK)
+    // arrival times for latency accounting; without kernel support they are taken right after the receive call
+    const bool kernelTimestamps = udpman->EnableReceiveTimestamps();
+    statKernelTimestamps.store(kernelTimestamps, std::memory_order_relaxed);
+    UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Receive timestamps: %s"), kernelTimestamps ? TEXT("kernel (SO_TIMESTAMPNS)") : TEXT("user space"));
+
+    // a larger buffer absorbs bursts while the consumer stalls; the kernel decides what we really get
+    if (receiveBufferSize > 0 && !udpman->SetReceiveBufferSize(receiveBufferSize))
+    {
+        UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Unable to set receive buffer to %d bytes"), receiveBufferSize);
+    }
+    const int grantedBufferSize = udpman->GetReceiveBufferSize();
+    statReceiveBufferSize.store(grantedBufferSize, std::memory_order_relaxed);
+    if (receiveBufferSize > 0 && grantedBufferSize < receiveBufferSize)
+    {
+        UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Receive buffer is %d bytes, requested %d (limited by the system, on Linux raise net.core.rmem_max)"),
+            grantedBufferSize, receiveBufferSize);
+    }
+    else
+    {
+        UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Receive buffer is %d bytes"), grantedBufferSize);
+    }
+
+    const bool dropCounter = udpman->EnableDropCounter();
+    statKernelDropCounter.store(dropCounter, std::memory_order_relaxed);
+    statKernelDrops.store(0, std::memory_order_relaxed);
+
+    if (busyPoll)
+    {
+        // receive calls return at once, busyPollSocket() decides when to wait
+        udpman->SetBlocking(false);
+        const bool socketPoll = busyPollSocketUs > 0 && udpman->EnableBusyPoll(busyPollSocketUs);
+        statBusyPollSocket.store(socketPoll, std::memory_order_relaxed);
+        if (busyPollSocketUs > 0 && !socketPoll)
         {
-			UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Unable to bind socket to port %d, retrying..."), port);
-			std::this_thread::sleep_for(std::chrono::seconds(1));
-            udpman->Close();
-            udpman.reset();
+            UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: SO_BUSY_POLL %d us not available (Linux only, values above net.core.busy_read need CAP_NET_ADMIN)"), busyPollSocketUs);
+        }
+        UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Busy-poll receive: spin %d us, yield %d us, SO_BUSY_POLL %s"),
+            busyPollSpinUs, busyPollYieldUs, socketPoll ? TEXT("on") : TEXT("off"));
+    }
+    statSocketBound.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+void TrackLinkClient::closeSocket()
+{
+    if (!udpman)
+        return;
+
+    const TrackLinkStatistics stats = getStatistics();
+    UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Received %llu datagrams in %llu wakeups using %llu socket calls (%.2f datagrams/call)"),
+        stats.recvDatagrams, stats.recvBatches, stats.recvSyscalls, stats.datagramsPerSyscall());
+    if (stats.kernelDrops > 0)
+    {
+        UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Kernel dropped %llu datagrams (receive buffer full)"), stats.kernelDrops);
+    }
+    if (captureWriter)
+    {
+        UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Captured %llu datagrams (%.1f MiB)"),
+            stats.capturedDatagrams, captureWriter->bytes() / (1024.0 * 1024.0));
+    }
+    if (busyPoll)
+    {
+        UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Busy-poll: %llu empty polls, %llu fallbacks to blocking wait, %.1f s receive thread CPU"),
+            stats.busyPollEmpty, stats.busyPollFallbacks, stats.receiveCpuNs >= 0 ? stats.receiveCpuNs / 1e9 : 0.0);
+    }
+
+    statSocketBound.store(false, std::memory_order_relaxed);
+    udpman->Close();
+    udpman.reset();
+}
+
+int TrackLinkClient::pollSocket()
+{
+    // one wakeup drains everything already queued on the socket
+    const int count = udpman->ReceiveBatch(batch.data(), RECV_BATCH_SIZE);
+
+    statRecvSyscalls.store(udpman->GetReceiveSyscallCount(), std::memory_order_relaxed);
+    statRecvDatagrams.store(udpman->GetReceiveDatagramCount(), std::memory_order_relaxed);
+    statKernelDrops.store(udpman->GetKernelDropCount(), std::memory_order_relaxed);
+
+    if (count <= 0)
+        return count;
+
+    // how long the datagrams sat in the socket before this thread picked them up
+    if (udpman->HasKernelTimestamps())
+    {
+        const long long now = timestampNow();
+        unsigned long long delaySum = 0;
+        for (int i = 0; i < count; ++i)
+            delaySum += (unsigned long long)std::max(0LL, now - batch[i].llTimestampNs);
+        statReceiveDelaySumNs.fetch_add(delaySum, std::memory_order_relaxed);
+        statReceiveDelaySamples.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    // raw, before reassembly, so a replay feeds the parser exactly the same input
+    if (captureWriter && captureWriter->isOpen())
+    {
+        int captured = 0;
+        while (captured < count && captureWriter->append(batch[captured].saRemote, batch[captured].pBuff, batch[captured].iSize, batch[captured].llTimestampNs))
+            ++captured;
+        statCapturedDatagrams.fetch_add(captured, std::memory_order_relaxed);
+    }
+
+    processBatch(count);
+    return count;
+}
+
+void TrackLinkClient::processBatch(int count)
+{
+    statRecvBatches.fetch_add(1, std::memory_order_relaxed);
+
+    // single datagram frames are parsed in place, others collected per sender until the trailing 't'
+    unsigned long long bytes = 0;
+    TrackFrameAssembler::Frame frame;
+    for (int i = 0; i < count; ++i)
+    {
+        const UDPDatagram& dgram = batch[i];
+        if (dgram.iSize <= 0)
             continue;
+        bytes += dgram.iSize;
+
+        // an OSC packet is always one datagram
+        if (tuioDecoder)
+            parseTuioPacket(dgram.pBuff, dgram.iSize, dgram.llTimestampNs);
+        else if (assembler->add(dgram.saRemote, dgram.pBuff, dgram.iSize, dgram.llTimestampNs, frame))
+            parseFrame(frame.data, frame.size, frame.arrivalNs);
+    }
+
+    const long long lastArrivalNs = batch[count - 1].llTimestampNs;
+    statRecvBytes.fetch_add(bytes, std::memory_order_relaxed);
+    statLastArrivalNs.store(lastArrivalNs, std::memory_order_relaxed);
+    publishReassemblyStats(lastArrivalNs);
+}
+
+void TrackLinkClient::startReplay()
+{
+    if (replayReader && !replayStarted.exchange(true))
+        wakeup->signal();
+}
+
+void TrackLinkClient::replayData()
+{
+    // the capture file is the socket, it is ready at once
+    statSocketBound.store(true, std::memory_order_relaxed);
+
+    // nobody would see the frames parsed before the first consumer attaches
+    while (!threadExit && !replayStarted)
+        wakeup->wait(1000);
+    // consume the start signal; a shutdown signal after this stays pending and ends every wait below
+    wakeup->reset();
+
+    TrackCaptureReader::Record record;
+    bool pending = replayReader->next(record);
+    const long long firstRecordNs = pending ? record.arrivalNs : 0;
+    const long long startNs = timestampNow();
+    // when a record is due on the replay clock (speed 0: always)
+    auto dueTime = [&]() -> long long
+    {
+        return replaySpeed > 0.0 ? startNs + (long long)((record.arrivalNs - firstRecordNs) / replaySpeed) : startNs;
+    };
+
+    while (pending && !threadExit)
+    {
+        // sleep until the next record is due, spin the last 2 ms for sub-millisecond pacing
+        const long long dueNs = dueTime();
+        long long remainingNs;
+        while (!threadExit && (remainingNs = dueNs - timestampNow()) > 0)
+        {
+            if (remainingNs > 2000000)
+                wakeup->wait((int)std::min(remainingNs / 1000000 - 1, 1000LL));
+            else
+                std::this_thread::yield();
         }
+        if (threadExit)
+            break;
 
-        UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Successfully bound to port %d"), port);
-        udpman->SetTimeoutReceive(1);
-        connGood = true;
+        // everything due by now forms one batch, like one receive call draining the socket
+        const long long now = timestampNow();
+        int count = 0;
+        while (pending && count < RECV_BATCH_SIZE)
+        {
+            const long long recordDueNs = dueTime();
+            if (recordDueNs > now)
+                break;
+
+            UDPDatagram& dgram = batch[count];
+            dgram.iSize = std::min(record.size, dgram.iCapacity);
+            memcpy(dgram.pBuff, record.data, dgram.iSize);
+            dgram.saRemote = record.source;
+            // recorded spacing, scaled; reassembly timeouts and jitter see the capture's own timing
+            dgram.llTimestampNs = replaySpeed > 0.0 ? recordDueNs : now;
+            ++count;
+            pending = replayReader->next(record);
+        }
+
+        statRecvDatagrams.fetch_add(count, std::memory_order_relaxed);
+        processBatch(count);
+        statReceiveCpuNs.store(threadCpuTimeNs(), std::memory_order_relaxed);
     }
 
+    if (!threadExit)
+    {
+        const TrackLinkStatistics stats = getStatistics();
+        const double seconds = (timestampNow() - startNs) * 1e-9;
+        UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Replay finished: %llu datagrams, %llu frames, %llu malformed in %.2f s (%.0f datagrams/s)"),
+            stats.recvDatagrams, stats.frames, stats.malformedFrames, seconds, seconds > 0.0 ? stats.recvDatagrams / seconds : 0.0);
+        statReplayFinished.store(true, std::memory_order_relaxed);
+    }
     while (!threadExit)
+        wakeup->wait(1000);
+
+    statSocketBound.store(false, std::memory_order_relaxed);
+}
+
+void TrackLinkClient::tryPublishBridge(long long now)
+{
+    if (now < bridgeRetryNs)
+        return;
+    bridgeRetryNs = now + 1000000000LL;
+
+    // the first frame carries the tracks we already have, subscribers continue with them
+    const TrackBridgePublisher::OpenResult result = bridgePublisher->open(bridgeName.c_str(), bridgeMaxTracks, trackMap, echoGeneration);
+    if (result == TrackBridgePublisher::OPENED)
+    {
+        statBridgeRole.store(BRIDGE_PUBLISH, std::memory_order_relaxed);
+        bridgeWarned = false;
+    }
+    else if (!bridgeWarned)
     {
-        recvSize = udpman->Receive(recvBuf, 20480);
+        // receiving goes on either way, only the other processes miss out
+        bridgeWarned = true;
+        if (result == TrackBridgePublisher::BUSY)
+        {
+            UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Another process publishes to the track bridge %hs, retrying every second"), bridgeName.c_str());
+        }
+        else
+        {
+            UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Unable to publish to the track bridge %hs, retrying every second"), bridgeName.c_str());
+        }
+    }
+}
 
-        if (recvSize > 0)
+void TrackLinkClient::bridgeData()
+{
+    while (!threadExit)
+    {
+        // auto: whoever gets the publisher lock receives, everyone else reads its frames
+        if (bridgePublisher)
         {
-            while (!threadExit && recvSize > 0 && recvBuf[recvSize - 1] != 't')
+            const TrackBridgePublisher::OpenResult result = bridgePublisher->open(bridgeName.c_str(), bridgeMaxTracks, trackMap, echoGeneration);
+            if (result != TrackBridgePublisher::BUSY)
             {
-                int framerecv = udpman->Receive(recvBuf + recvSize, 20480 - recvSize);
-                if (framerecv <= 0)
+                // tracks inherited from the previous publisher continue; the live stream confirms them or not
+                bridgeDropNs = 0;
+                if (!trackMap.empty())
                 {
-                    UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Incomplete packet, dropping (ret=%d)"), framerecv);
-                    recvSize = 0;
-                    break;
+                    bridgeTakeoverNs = timestampNow();
+                    bridgeReconcileFrame = statFrames.load(std::memory_order_relaxed) + 2;
                 }
-                if (recvSize + framerecv > 20480)
+                if (result == TrackBridgePublisher::OPENED)
                 {
-                    UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Packet exceeds buffer, dropping"));
-                    recvSize = 0;
-                    break;
+                    statBridgeRole.store(BRIDGE_PUBLISH, std::memory_order_relaxed);
                 }
-                recvSize += framerecv;
+                else
+                {
+                    UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Unable to publish to the track bridge %hs, receiving for this process"), bridgeName.c_str());
+                    bridgeWarned = true;
+                    bridgeRetryNs = timestampNow() + 1000000000LL;
+                }
+                // a publisher stays one until the client goes
+                receiveData();
+                return;
             }
+        }
+        subscribeBridge();
+    }
+}
 
-            int curPos = 0;
-            while (curPos < recvSize)
+void TrackLinkClient::subscribeBridge()
+{
+    // a publisher that neither publishes nor closes within this time is checked for being alive
+    const long long silenceNs = 1000000000LL;
+    long long lastFrameNs = timestampNow();
+    bool loggedWaiting = false;
+
+    while (!threadExit)
+    {
+        if (!bridgeReader->isOpen())
+        {
+            bool opened;
             {
-                if (recvBuf[curPos++] != 'T')
+                std::lock_guard<std::mutex> lock(bridgeMutex);
+                opened = bridgeReader->open(bridgeName.c_str());
+                // a segment without publisher only holds the last frame of a crashed one
+                if (opened && !bridgeReader->publisherAlive())
                 {
-					UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Unexpected header byte, skipping packet"));
-                    curPos = recvSize;
-                    continue;
+                    bridgeReader->close();
+                    opened = false;
                 }
-
-                // get the track's id
-                unsigned int tid;
-                memcpy(&tid, recvBuf + curPos, 4); curPos += 4;
-
-                // CRITICAL FIX: Copy track data and receiver list under lock, then dispatch callbacks without lock
-                TrackRecord trackCopy;
-                std::vector<ITrackReceiver*> receiversCopy;
-                bool unknownTrack = false;
-                bool shouldNotify = false;
-
+            }
+            if (!opened)
+            {
+                if (bridgeDropNs != 0 && timestampNow() >= bridgeDropNs)
                 {
-                    std::lock_guard<std::mutex> lock(recvMutex);  // RAII lock - scope limited
-
-                    // is this track known? if so, update, else add:
-                    unknownTrack = (trackMap.find(tid) == trackMap.end());
-
-                    if (unknownTrack)
-                    {
-                        trackMap.insert(std::pair<unsigned int, TrackRecord>(tid, TrackRecord()));
-                    }
-
-                    auto trackIter = trackMap.find(tid);
-                    TrackRecord& track = trackIter->second;
-
-                    track.trackID = tid; //necessary for new tracks
-                    memcpy(&(track.state),         recvBuf + curPos, 4); curPos += 4;
-                    memcpy(&(track.currentPos.x),  recvBuf + curPos, 4); curPos += 4;
-                    memcpy(&(track.currentPos.y),  recvBuf + curPos, 4); curPos += 4;
-                    memcpy(&(track.expectPos.x),   recvBuf + curPos, 4); curPos += 4;
-                    memcpy(&(track.expectPos.y),   recvBuf + curPos, 4); curPos += 4;
-                    memcpy(&(track.orientation.x), recvBuf + curPos, 4); curPos += 4;
-                    memcpy(&(track.orientation.y), recvBuf + curPos, 4); curPos += 4;
-                    memcpy(&(track.speed),         recvBuf + curPos, 4); curPos += 4;
-                    memcpy(&(track.relPos.x),      recvBuf + curPos, 4); curPos += 4;
-                    memcpy(&(track.relPos.y),      recvBuf + curPos, 4); curPos += 4;
-
-                    track.echoes.clear();
-                    while (recvBuf[curPos] == 'E')  // peek if echo(es) available
-                    {
-                        ++curPos;   // yep, then skip 'E'
-						PharusVector2f e;
-                        memcpy(&(e.x), recvBuf + curPos, 4); curPos += 4;
-                        memcpy(&(e.y), recvBuf + curPos, 4); curPos += 4;
-                        track.echoes.push_back(e);
-                        ++curPos;   // 'e'
-                    }
-
-                    if (recvBuf[curPos++] != 't')
-                    {
-						UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Unexpected tailing byte, skipping packet"));
-                        curPos = recvSize;
-                        continue;  // Lock will be released here
-                    }
-
-                    // Copy data for callback dispatch outside the lock
-                    trackCopy = track;
-                    receiversCopy = trackReceivers;
-                    shouldNotify = true;
-
-                    // If track is being removed, erase from map now (under lock)
-                    if (!unknownTrack && track.state == TS_OFF)
-                    {
-                        trackMap.erase(trackIter);
-                    }
-                } // LOCK RELEASED HERE - critical section ends
-
-                // Now dispatch callbacks WITHOUT holding the lock
-                if (shouldNotify)
+                    // no successor within the grace time
+                    bridgeDropNs = 0;
+                    dropBridgeTracks();
+                }
+                if (!loggedWaiting)
                 {
-                    for (auto receiver : receiversCopy)
-                    {
-                        // track is unknown yet AND is not about to die
-                        if (unknownTrack && trackCopy.state != TS_OFF)
-                        {
-                            receiver->onTrackNew(trackCopy);
-                        }
-                        // standard track update
-                        else if (!unknownTrack && trackCopy.state != TS_OFF)
-                        {
-                            receiver->onTrackUpdate(trackCopy);
-                        }
-                        // track is known and this is his funeral
-                        else if (!unknownTrack && trackCopy.state == TS_OFF)
-                        {
-                            receiver->onTrackLost(trackCopy);
-                        }
-                    }
+                    UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Waiting for a publisher on the track bridge %hs"), bridgeName.c_str());
+                    loggedWaiting = true;
                 }
+                // auto: the publisher may be gone for good, run the election again
+                wakeup->wait(100);
+                if (bridgePublisher)
+                    return;
+                continue;
+            }
+            UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: Subscribed to the track bridge %hs"), bridgeName.c_str());
+            loggedWaiting = false;
+            // the new publisher's first frame carries the tracks it continues with, the diff sorts out the rest
+            bridgeDropNs = 0;
+            lastFrameNs = timestampNow();
+            statBridgeRole.store(BRIDGE_SUBSCRIBE, std::memory_order_relaxed);
+            // there is no socket, the segment is the source
+            statSocketBound.store(true, std::memory_order_relaxed);
+        }
+
+        // the front frame stays untouched, receivers may still hold its echoes
+        const TrackBridgeReader::ReadResult result = bridgeReader->read(*bridgeFrames[1 - bridgeFront]);
+        statBridgeSkippedFrames.store(bridgeReader->skippedFrames(), std::memory_order_relaxed);
+        statBridgeRetries.store(bridgeReader->retries(), std::memory_order_relaxed);
+
+        // clean close: a successor (auto mode) continues with the tracks; a crash: nobody knows them anymore
+        bool sourceLost = false;
+        bool sourceClosed = false;
+        if (result == TrackBridgeReader::FRAME)
+        {
+            bridgeFront = 1 - bridgeFront;
+            const TrackSnapshot& frame = *bridgeFrames[bridgeFront];
+            recordFrameArrival(frame.arrivalTimeNs);
+            deliverBridgeFrame();
+            statFrames.fetch_add(1, std::memory_order_relaxed);
+            statTracks.fetch_add(frame.tracks.size(), std::memory_order_relaxed);
+            statBridgeFrames.fetch_add(1, std::memory_order_relaxed);
+            statLastArrivalNs.store(frame.arrivalTimeNs, std::memory_order_relaxed);
+            lastFrameNs = timestampNow();
+        }
+        else if (result == TrackBridgeReader::NO_FRAME)
+        {
+            const long long now = timestampNow();
+            if (now - lastFrameNs > silenceNs)
+            {
+                lastFrameNs = now;
+                sourceLost = !bridgeReader->publisherAlive();
             }
+            // the futex wait cannot see the shutdown signal in time if it comes right before it; keep it short
+            if (!sourceLost && !bridgeReader->wait(50))
+                wakeup->wait(1);
+        }
+        else if (result == TrackBridgeReader::CLOSED)
+        {
+            sourceClosed = true;
+        }
+        else
+        {
+            // laid out anew by a publisher with other settings; the tracks continue by ID
+            std::lock_guard<std::mutex> lock(bridgeMutex);
+            bridgeReader->close();
+        }
+
+        if (sourceLost || sourceClosed)
+        {
+            UE_LOG(LogAefPharus, Log, TEXT("TrackLinkClient: The publisher of the track bridge %hs %s"), bridgeName.c_str(),
+                sourceClosed ? TEXT("closed") : TEXT("is gone"));
+            {
+                std::lock_guard<std::mutex> lock(bridgeMutex);
+                bridgeReader->close();
+            }
+            statSocketBound.store(false, std::memory_order_relaxed);
+            statBridgeRole.store(BRIDGE_OFF, std::memory_order_relaxed);
+            if (sourceLost)
+                dropBridgeTracks();
+            else
+                bridgeDropNs = timestampNow() + 1000000000LL;
+            if (bridgePublisher)
+                return;
         }
     }
 
-    // Smart pointer will automatically clean up udpman
-    if (udpman)
+    std::lock_guard<std::mutex> lock(bridgeMutex);
+    bridgeReader->close();
+    statSocketBound.store(false, std::memory_order_relaxed);
+    statBridgeRole.store(BRIDGE_OFF, std::memory_order_relaxed);
+}
+
+void TrackLinkClient::deliverBridgeFrame()
+{
+    TrackSnapshot& frame = *bridgeFrames[bridgeFront];
+    frame.version = ++bridgeVersion;
+    bridgeDiff->apply(frame);
+
+    // the frame replaces trackMap; records of lost tracks are kept for their last callback
     {
-        udpman->Close();
-        udpman.reset();
+        std::lock_guard<std::mutex> lock(recvMutex);
+        bridgeLost.clear();
+        for (unsigned int tid : bridgeDiff->lostTrackIDs())
+        {
+            if (const TrackRecord* track = trackMap.find(tid))
+            {
+                bridgeLost.push_back(*track);
+                bridgeLost.back().state = TS_OFF;
+                bridgeLost.back().echoes = EchoSpan();
+                trackMap.erase(tid);
+            }
+        }
+        for (const TrackRecord& track : frame.tracks)
+        {
+            bool inserted;
+            trackMap.findOrInsert(track.trackID, inserted) = track;
+        }
+        dispatchReceivers.assign(trackReceivers.begin(), trackReceivers.end());
+    }
+
+    for (ITrackReceiver* receiver : dispatchReceivers)
+    {
+        for (const TrackRecord* track : bridgeDiff->newTracks())
+            receiver->onTrackNew(*track);
+        for (const TrackRecord* track : bridgeDiff->updatedTracks())
+            receiver->onTrackUpdate(*track);
+        for (const TrackRecord& track : bridgeLost)
+            receiver->onTrackLost(track);
+    }
+
+    if (snapshotBuffer)
+    {
+        // already sorted and free of TS_OFF; only the echo spans need to move to the snapshot's arena
+        TrackSnapshot& snapshot = snapshotBuffer->writeBuffer();
+        snapshot.version = ++snapshotVersion;
+        snapshot.arrivalTimeNs = frame.arrivalTimeNs;
+        snapshot.echoes.assign(frame.echoes.begin(), frame.echoes.end());
+        snapshot.tracks.assign(frame.tracks.begin(), frame.tracks.end());
+        for (TrackRecord& track : snapshot.tracks)
+        {
+            if (!track.echoes.empty())
+                track.echoes = EchoSpan(snapshot.echoes.data() + (track.echoes.data() - frame.echoes.data()), track.echoes.size());
+        }
+        snapshotBuffer->publish();
+    }
+}
+
+void TrackLinkClient::dropBridgeTracks()
+{
+    // an empty frame: every track is lost
+    bridgeFront = 1 - bridgeFront;
+    TrackSnapshot& frame = *bridgeFrames[bridgeFront];
+    frame.tracks.clear();
+    frame.echoes.clear();
+    frame.arrivalTimeNs = timestampNow();
+    deliverBridgeFrame();
+    // the next publisher's tracks are all new
+    bridgeDiff->reset();
+}
+
+void TrackLinkClient::reconcileBridgeTakeover()
+{
+    bridgeReconcileFrame = 0;
+
+    // Pharus sends every live track in every frame; inherited ones missing since the takeover left meanwhile
+    {
+        std::lock_guard<std::mutex> lock(recvMutex);
+        bridgeLost.clear();
+        for (const TrackRecord& track : trackMap)
+        {
+            if (track.arrivalTimeNs < bridgeTakeoverNs)
+            {
+                bridgeLost.push_back(track);
+                bridgeLost.back().state = TS_OFF;
+                bridgeLost.back().echoes = EchoSpan();
+            }
+        }
+        for (const TrackRecord& track : bridgeLost)
+            trackMap.erase(track.trackID);
+        dispatchReceivers.assign(trackReceivers.begin(), trackReceivers.end());
     }
+
+    for (ITrackReceiver* receiver : dispatchReceivers)
+    {
+        for (const TrackRecord& track : bridgeLost)
+            receiver->onTrackLost(track);
+    }
+}
+
+void TrackLinkClient::expireReassembly(long long now)
+{
+    assembler->expire(now);
+    publishReassemblyStats(now);
+}
+
+void TrackLinkClient::publishReassemblyStats(long long now)
+{
+    statSenders.store(assembler->activeSenders(now), std::memory_order_relaxed);
+    statReassemblyTimeouts.store(assembler->timeouts(), std::memory_order_relaxed);
+    statReassemblyOverflows.store(assembler->overflows(), std::memory_order_relaxed);
+    statReassemblyEvictions.store(assembler->evictions(), std::memory_order_relaxed);
+}
+
+void TrackLinkClient::recordFrameArrival(long long arrivalNs)
+{
+    // RFC 3550 style: smoothed absolute difference of consecutive inter-arrival times
+    if (prevFrameArrivalNs > 0 && arrivalNs >= prevFrameArrivalNs)
+    {
+        const long long interval = arrivalNs - prevFrameArrivalNs;
+        if (prevFrameIntervalNs > 0)
+        {
+            const long long delta = interval > prevFrameIntervalNs ? interval - prevFrameIntervalNs : prevFrameIntervalNs - interval;
+            jitterNs += (double(delta) - jitterNs) / 16.0;
+            statJitterNs.store((long long)jitterNs, std::memory_order_relaxed);
+        }
+        prevFrameIntervalNs = interval;
+    }
+    prevFrameArrivalNs = arrivalNs;
+}
+
+namespace
+{
+    //! Copies a wire record into a TrackRecord, its echoes are appended to the frame's echo arena
+    void copyTrack(TrackRecord& track, const TrackView& view, std::vector<PharusVector2f>& echoArena, unsigned int echoGeneration)
+    {
+        track.trackID = view.trackID();
+        track.state = view.state();
+        track.currentPos = view.currentPos();
+        track.expectPos = view.expectPos();
+        track.orientation = view.orientation();
+        track.speed = view.speed();
+        track.relPos = view.relPos();
+
+        // the arena is reserved for a full receive buffer of echoes, appending never reallocates
+        const size_t offset = echoArena.size();
+        const size_t count = std::min<size_t>(view.echoes().size(), echoArena.capacity() - offset);
+        for (size_t i = 0; i < count; ++i)
+            echoArena.push_back(view.echoes()[(int)i]);
+        track.echoes = EchoSpan(echoArena.data() + offset, (unsigned int)count, echoGeneration);
+    }
+}
+
+void TrackLinkClient::beginFrame(long long arrivalNs)
+{
+    recordFrameArrival(arrivalNs);
+
+    // echoes of the previous frame are released here; tracks missing from this frame keep a span
+    // of an older generation, which currentEchoes() treats as empty
+    ++echoGeneration;
+    echoArena.clear();
+}
+
+EchoSpan TrackLinkClient::currentEchoes(const TrackRecord& track) const
+{
+    return track.echoes.generation() == echoGeneration ? track.echoes : EchoSpan();
+}
+
+void TrackLinkClient::parseFrame(const char* recvBuf, int recvSize, long long arrivalNs)
+{
+    const TrackFrameView frame(recvBuf, recvSize);
+    beginFrame(arrivalNs);
+
+    // frame receivers read straight from the receive buffer
+    {
+        std::lock_guard<std::mutex> lock(recvMutex);
+        dispatchFrameReceivers.assign(frameReceivers.begin(), frameReceivers.end());
+    }
+    for (ITrackFrameReceiver* receiver : dispatchFrameReceivers)
+    {
+        receiver->onTrackFrame(frame);
+    }
+
+    TrackView view;
+    TrackRecord decoded;
+    int curPos = 0;
+    unsigned long long decodedTracks = 0;
+    while (!frame.atEnd(curPos))
+    {
+        const TrackFrameView::Error error = frame.decode(curPos, view);
+        if (error != TrackFrameView::OK)
+        {
+            switch (error)
+            {
+            case TrackFrameView::BAD_HEADER:
+                UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Unexpected header byte, skipping packet"));
+                break;
+            case TrackFrameView::TRUNCATED:
+                UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Truncated track record, skipping packet"));
+                break;
+            default:
+                UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Unexpected tailing byte, skipping packet"));
+                break;
+            }
+            statTracks.fetch_add(decodedTracks, std::memory_order_relaxed);
+            statMalformedFrames.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        ++decodedTracks;
+
+        copyTrack(decoded, view, echoArena, echoGeneration);
+        decoded.arrivalTimeNs = arrivalNs;
+        dispatchTrack(decoded);
+    }
+
+    statTracks.fetch_add(decodedTracks, std::memory_order_relaxed);
+    endFrame(arrivalNs);
+}
+
+void TrackLinkClient::parseTuioPacket(const char* data, int size, long long arrivalNs)
+{
+    tuioDecoder->beginPacket();
+    bool malformedMessage = false;
+    const OscPacketView::Error error = OscPacketView(data, size).forEachMessage([&](const OscMessageView& message)
+    {
+        switch (tuioDecoder->add(message))
+        {
+        case TuioDecoder::FRAME:
+        {
+            const std::vector<TrackRecord>& records = tuioDecoder->frame();
+            beginFrame(arrivalNs);
+            TrackRecord decoded;
+            for (const TrackRecord& record : records)
+            {
+                decoded = record;
+                decoded.arrivalTimeNs = arrivalNs;
+                dispatchTrack(decoded);
+            }
+            statTracks.fetch_add(records.size(), std::memory_order_relaxed);
+            endFrame(arrivalNs);
+            break;
+        }
+        case TuioDecoder::MALFORMED:
+            malformedMessage = true;
+            break;
+        default:
+            break;
+        }
+    });
+    statOutdatedFrames.store(tuioDecoder->outdatedFrames(), std::memory_order_relaxed);
+
+    if (error != OscPacketView::OK || malformedMessage)
+    {
+        switch (error)
+        {
+        case OscPacketView::OK:
+            UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: TUIO message with unexpected arguments, skipping it"));
+            break;
+        case OscPacketView::UNKNOWN_TYPE:
+            UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Unknown OSC argument type, skipping the rest of the packet"));
+            break;
+        default:
+            UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkClient: Malformed OSC packet (error %d), skipping the rest of it"), (int)error);
+            break;
+        }
+        statMalformedFrames.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void TrackLinkClient::dispatchTrack(const TrackRecord& decoded)
+{
+    const unsigned int tid = decoded.trackID;
+    bool unknownTrack = false;
+
+    // Copy track data and receiver list under lock into the reused scratch, then dispatch callbacks without lock
+    {
+        std::lock_guard<std::mutex> lock(recvMutex);  // RAII lock - scope limited
+
+        // is this track known? if so, update, else add (one lookup either way):
+        TrackRecord& track = trackMap.findOrInsert(tid, unknownTrack);
+        track = decoded;
+
+        // plain copy, echoes stay in the arena
+        dispatchRecord = track;
+        dispatchReceivers.assign(trackReceivers.begin(), trackReceivers.end());
+
+        // If track is being removed, erase from map now (under lock)
+        // (also when it was never known, it must not linger as TS_OFF)
+        if (track.state == TS_OFF)
+        {
+            trackMap.erase(tid);
+        }
+    } // LOCK RELEASED HERE - critical section ends
+
+    // Now dispatch callbacks WITHOUT holding the lock
+    for (auto receiver : dispatchReceivers)
+    {
+        // track is unknown yet AND is not about to die
+        if (unknownTrack && dispatchRecord.state != TS_OFF)
+        {
+            receiver->onTrackNew(dispatchRecord);
+        }
+        // standard track update
+        else if (!unknownTrack && dispatchRecord.state != TS_OFF)
+        {
+            receiver->onTrackUpdate(dispatchRecord);
+        }
+        // track is known and this is his funeral
+        else if (!unknownTrack && dispatchRecord.state == TS_OFF)
+        {
+            receiver->onTrackLost(dispatchRecord);
+        }
+    }
+}
+
+void TrackLinkClient::endFrame(long long arrivalNs)
+{
+    statFrames.fetch_add(1, std::memory_order_relaxed);
+
+    if (bridgeReconcileFrame != 0 && statFrames.load(std::memory_order_relaxed) >= bridgeReconcileFrame)
+        reconcileBridgeTakeover();
+
+    // the whole frame is in, hand it to the snapshot reader in one piece
+    if (snapshotBuffer)
+        publishSnapshot(arrivalNs);
+
+    // and to the other processes on the host
+    if (bridgePublisher && bridgePublisher->isOpen())
+    {
+        bridgePublisher->publish(trackMap, arrivalNs, echoGeneration);
+        statBridgeFrames.store(bridgePublisher->frames(), std::memory_order_relaxed);
+        statBridgeTruncatedTracks.store(bridgePublisher->truncatedTracks(), std::memory_order_relaxed);
+    }
+}
+
+void TrackLinkClient::publishSnapshot(long long arrivalNs)
+{
+    // trackMap is only modified by this (the receive) thread, no lock needed to read it
+    TrackSnapshot& snapshot = snapshotBuffer->writeBuffer();
+    snapshot.version = ++snapshotVersion;
+    snapshot.arrivalTimeNs = arrivalNs;
+
+    // the snapshot owns a copy of the frame's echoes, the client's arena is reused by the next frame
+    snapshot.echoes.assign(echoArena.begin(), echoArena.end());
+
+    snapshot.tracks.resize(trackMap.size());
+    size_t count = 0;
+    for (const TrackRecord& track : trackMap)
+    {
+        if (track.state == TS_OFF)
+            continue;
+        TrackRecord& copy = snapshot.tracks[count++];
+        copy = track;
+        const EchoSpan echoes = currentEchoes(track);
+        copy.echoes = echoes.empty() ? EchoSpan() : EchoSpan(snapshot.echoes.data() + (echoes.data() - echoArena.data()), echoes.size());
+    }
+    snapshot.tracks.resize(count);
+
+    // the table is unordered, snapshots are sorted by ID (swaps, no allocation)
+    std::sort(snapshot.tracks.begin(), snapshot.tracks.end(),
+        [](const TrackRecord& a, const TrackRecord& b) { return a.trackID < b.trackID; });
+
+    snapshotBuffer->publish();
 }
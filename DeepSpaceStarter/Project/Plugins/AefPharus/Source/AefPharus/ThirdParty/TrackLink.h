@@ -8,52 +8,227 @@
 #include <atomic>
 #include <mutex>
 #include <vector>
-#include <map>
 #include <memory>
+#include <string>
+
+#include "TrackRecord.h"
+#include "TrackTable.h"
+#include "TrackLinkThread.h"
 
 class UDPManager;
+struct UDPDatagram;
 
 namespace pharus
 {
-//! Helper structure to store two-dimensional values
-struct PharusVector2f
+//! All known tracks, keyed by track ID (see TrackTable)
+typedef TrackTable TrackMap;
+
+class TrackLinkReactor;
+class TrackLinkWakeup;
+class TrackFrameAssembler;
+class TrackCaptureWriter;
+class TrackCaptureReader;
+class TrackFrameView;
+class TrackSnapshotBuffer;
+class TrackSnapshotMerger;
+class TrackSnapshotDiff;
+class TrackBridgePublisher;
+class TrackBridgeReader;
+class TuioDecoder;
+struct TrackSnapshot;
+
+//! Protocol of the datagrams a TrackLinkClient receives
+enum TrackProtocol
+{
+    //! Pharus' binary TrackLink frames
+    PROTOCOL_TRACKLINK,
+    //! TUIO 1.1 over OSC (/tuio/2Dcur, /tuio/2Dobj, /tuio/2Dblb), see TuioDecoder
+    PROTOCOL_TUIO
+};
+
+//! Role of a TrackLinkClient in a shared memory track bridge (see TrackBridge.h)
+enum BridgeMode
 {
-    float x, y;
+    //! Receive from the network, share nothing
+    BRIDGE_OFF,
+    //! Receive from the network and publish every frame for the other processes on the host
+    BRIDGE_PUBLISH,
+    //! Never open a socket, read the frames another process publishes
+    BRIDGE_SUBSCRIBE,
+    //! Publish if no other process does, otherwise subscribe; take over when the publisher goes away
+    BRIDGE_AUTO
 };
 
-//!Denotes the track's state
-enum TrackState
+//! Construction parameters of a TrackLinkClient
+struct TrackLinkOptions
 {
-    //! The track has been made public for the first iteration
-    TS_NEW,
-    //! The track is already known - this is a position update
-    TS_CONT,
-    //! The track has disappeared - this is the last notification of it
-    TS_OFF
+    //! Join multicastGroup (true) or listen for unicast packets (false)
+    bool multicast = true;
+    //! Local NIC address to bind to ("0.0.0.0" for all). The string must outlive the client.
+    const char* localIP = nullptr;
+    //! UDP port Pharus sends to
+    unsigned short port = 44345;
+    //! Multicast group address. The string must outlive the client.
+    const char* multicastGroup = "239.1.1.1";
+    //! What the datagrams on the port carry
+    /** TUIO frames produce the same track callbacks, snapshots and bridge frames as
+      * TrackLink ones, but frame receivers are not called (there is no TrackLink frame). */
+    TrackProtocol protocol = PROTOCOL_TRACKLINK;
+    //! TUIO: size of the tracking area in meters; scales TUIO's relative positions and velocities
+    PharusVector2f tuioArea = { 15.0f, 8.3f };
+    //! Shared network I/O reactor servicing this client.
+    /** nullptr starts a dedicated receive thread for this client (classic behaviour).
+      * The reactor must outlive the client. */
+    TrackLinkReactor* reactor = nullptr;
+    //! Publish a TrackSnapshot after every complete frame (see TrackLinkClient::acquireSnapshot())
+    bool snapshots = false;
+    //! Requested socket receive buffer (SO_RCVBUF) in bytes, 0 keeps the system default
+    /** The kernel may grant less (Linux caps it at net.core.rmem_max) or report more
+      * (Linux doubles the value for bookkeeping); see TrackLinkStatistics::receiveBufferSize. */
+    int receiveBufferSize = 0;
+    //! Number of sockets (SO_REUSEPORT) with a receiver each, bound to the same port
+    /** Unicast only: the kernel spreads senders over the sockets by hashing their address,
+      * so this scales with the number of senders, not with the traffic of one sender.
+      * Values above 1 imply snapshot mode; acquireSnapshot() merges the workers' frames.
+      * The additional sockets always get a receive thread of their own, not the reactor.
+      * Track and frame receivers are called from every worker's thread concurrently. */
+    int receiveWorkers = 1;
+    //! Poll the socket without blocking instead of sleeping in select() (low-latency mode)
+    /** Uses a dedicated receive thread (the reactor is ignored). After every batch the
+      * thread spins for busyPollSpinUs, then yields for busyPollYieldUs, and only then
+      * falls back to a blocking wait. A budget that covers the tracker's frame interval
+      * keeps one core busy but removes the scheduler wakeup from the receive path. */
+    bool busyPoll = false;
+    //! Busy-poll: time to spin on non-blocking receives after the last datagram, in microseconds
+    int busyPollSpinUs = 2000;
+    //! Busy-poll: time to keep polling with a thread yield between attempts after spinning, in microseconds
+    int busyPollYieldUs = 50000;
+    //! Busy-poll: SO_BUSY_POLL time in microseconds, the kernel polls the device queue (Linux, 0 = off)
+    int busyPollSocketUs = 0;
+    //! Name, priority and core affinity of the dedicated receive thread (and of the workers' threads)
+    /** Not used while the client is serviced by a reactor; the reactor has its own. An empty
+      * name becomes "PharusReceive <port>". */
+    TrackLinkThreadOptions thread;
+    //! Senders on the port whose multi-datagram frames are reassembled separately (see TrackFrameAssembler)
+    int maxSenders = 8;
+    //! A frame not completed within this time is dropped, in milliseconds
+    int reassemblyTimeoutMs = 100;
+    //! Append every received datagram with its arrival time and sender to this file (see TrackCaptureWriter)
+    /** nullptr = off. Only read by the constructor; an existing file is overwritten. Capturing
+      * uses one receive socket, receiveWorkers does not apply. */
+    const char* captureFile = nullptr;
+    //! Parse the datagrams of a capture file instead of receiving from the network
+    /** nullptr = off. Only read by the constructor, which throws if the file is no capture.
+      * Replays on a dedicated thread through the same reassembly and parser as live traffic;
+      * network settings, reactor, busyPoll, receiveWorkers and captureFile do not apply.
+      * Playback starts with the first consumer (registered receiver or acquireSnapshot() call),
+      * so no frame is parsed before anyone can see it. */
+    const char* replayFile = nullptr;
+    //! Replay speed relative to the capture: 1 = as recorded, 4 = four times faster, 0 = as fast as possible
+    double replaySpeed = 1.0;
+    //! Share decoded frames with other processes on the host through shared memory (see BridgeMode)
+    /** With unicast only one process can receive a tracker's datagrams (reuse-port sockets
+      * split them), and with multicast every process pays for receiving and parsing. One
+      * publisher instead feeds any number of subscribers; they get the same track callbacks
+      * and snapshots, but no frame receiver calls (there are no wire bytes to show them).
+      * Uses a dedicated thread (the reactor is ignored); receiveWorkers and replayFile do not apply. */
+    BridgeMode bridge = BRIDGE_OFF;
+    //! Name of the shared memory segment, nullptr = "AefPharus_<port>". Only read by the constructor.
+    const char* bridgeName = nullptr;
+    //! Tracks per published frame; the publisher drops the rest (TrackLinkStatistics::bridgeTruncatedTracks)
+    int bridgeMaxTracks = 4096;
 };
-//! Structure that holds all information of a track.
-/** Distances, positions are in meters, velocities in meters per second */
-struct TrackRecord
+
+//! Receive path counters of a TrackLinkClient
+/** Cumulative since the client was created. Useful to verify that batching works:
+  * with a busy tracker datagramsPerSyscall() should clearly exceed 0.5. */
+struct TrackLinkStatistics
 {
-    //! The track's unique ID
-    unsigned int trackID;
-    //! The track's current position
-	PharusVector2f currentPos;
-    //! The position the track is expected in the next frame
-	PharusVector2f expectPos;
-    //! The track's current position in relative coordinates (TUIO style)
-	PharusVector2f relPos;
-    //! The track's current heading (normalized directional vector). Valid if speed is above 0.25.
-	PharusVector2f orientation;
-    //! The track's current speed
-    float speed;
-    //! Yields in what state the track currently is
-    TrackState state;
-    //! Vector of CONFIRMED echoes that 'belong' to this track in relative coordinates (TUIO style)
-    std::vector<PharusVector2f> echoes;
+    //! Socket calls issued by the receive thread (select, recvfrom, recvmmsg)
+    unsigned long long recvSyscalls = 0;
+    //! Datagrams received
+    unsigned long long recvDatagrams = 0;
+    //! Wakeups that delivered at least one datagram
+    unsigned long long recvBatches = 0;
+    //! Payload bytes received
+    unsigned long long recvBytes = 0;
+    //! Frames parsed completely
+    unsigned long long frames = 0;
+    //! Track records decoded (also from frames that turned out malformed later on)
+    unsigned long long tracks = 0;
+    //! Frames dropped for broken 'T' / 't' framing or truncated records (TUIO: malformed OSC packets or messages)
+    unsigned long long malformedFrames = 0;
+    //! TUIO: frames dropped because a newer one had arrived already (reordered datagrams)
+    unsigned long long outdatedFrames = 0;
+    //! Senders seen on the port within the last second (summed over receive workers)
+    int senders = 0;
+    //! Multi-datagram frames dropped incomplete after TrackLinkOptions::reassemblyTimeoutMs
+    unsigned long long reassemblyTimeouts = 0;
+    //! Frames dropped for exceeding the reassembly buffer
+    unsigned long long reassemblyOverflows = 0;
+    //! Incomplete frames dropped because more than TrackLinkOptions::maxSenders senders were interleaving
+    unsigned long long reassemblyEvictions = 0;
+    //! Arrival time of the latest datagram (see TrackLinkClient::timestampNow()), 0 before the first one
+    long long lastArrivalNs = 0;
+    //! Smoothed variation of the time between consecutive frames, in ns (RFC 3550 style, gain 1/16)
+    long long interArrivalJitterNs = 0;
+    //! Arrival times are kernel receive timestamps (SO_TIMESTAMPNS), not taken after the receive call (with receive workers: on any of them)
+    bool kernelTimestamps = false;
+    //! Socket receive buffer size the kernel reports after binding, in bytes
+    int receiveBufferSize = 0;
+    //! kernelDrops is available (SO_RXQ_OVFL, Linux only; with receive workers: on any of them)
+    bool kernelDropCounter = false;
+    //! Datagrams the kernel dropped because the socket receive buffer was full
+    /** Only updated when a later datagram gets through, so it lags a burst by one datagram. */
+    unsigned long long kernelDrops = 0;
+    //! Sockets receiving for the client (TrackLinkOptions::receiveWorkers)
+    int receiveWorkers = 1;
+    //! The receive socket is bound (with receive workers: all of them)
+    bool socketBound = false;
+    //! Datagrams written to the capture file (TrackLinkOptions::captureFile)
+    unsigned long long capturedDatagrams = 0;
+    //! Datagrams come from a capture file (TrackLinkOptions::replayFile)
+    bool replay = false;
+    //! Replay: the whole capture file has been parsed
+    bool replayFinished = false;
+    //! Receive thread busy-polls (TrackLinkOptions::busyPoll)
+    bool busyPoll = false;
+    //! SO_BUSY_POLL was accepted by the kernel (with receive workers: for any of them)
+    bool busyPollSocket = false;
+    //! Busy-poll: receive attempts that found the socket empty
+    unsigned long long busyPollEmpty = 0;
+    //! Busy-poll: times the spin/yield budget ran out and the thread went back to a blocking wait
+    unsigned long long busyPollFallbacks = 0;
+    //! CPU time consumed by the receive thread in ns, -1 if unknown (reactor thread or unsupported platform)
+    long long receiveCpuNs = -1;
+    //! Sum of kernel timestamp to receive call return delays in ns (kernel timestamps only)
+    /** The time datagrams waited in the socket for the receive thread. Divide by
+      * receiveDelaySamples for the mean; this is what busy polling shortens. */
+    unsigned long long receiveDelaySumNs = 0;
+    unsigned long long receiveDelaySamples = 0;
+    //! Current bridge role: BRIDGE_PUBLISH, BRIDGE_SUBSCRIBE or BRIDGE_OFF (not bridged or not yet decided)
+    BridgeMode bridgeRole = BRIDGE_OFF;
+    //! Frames published to or read from the bridge
+    unsigned long long bridgeFrames = 0;
+    //! Subscriber: published frames skipped because a newer one was there before this process read
+    unsigned long long bridgeSkippedFrames = 0;
+    //! Subscriber: frame copies repeated because the publisher overwrote the slot meanwhile
+    unsigned long long bridgeRetries = 0;
+    //! Publisher: tracks left out for exceeding TrackLinkOptions::bridgeMaxTracks
+    unsigned long long bridgeTruncatedTracks = 0;
+
+    //! Average number of datagrams per socket call
+    double datagramsPerSyscall() const
+    {
+        return recvSyscalls > 0 ? double(recvDatagrams) / double(recvSyscalls) : 0.0;
+    }
+
+    //! Average number of tracks per parsed frame
+    double tracksPerFrame() const
+    {
+        return frames > 0 ? double(tracks) / double(frames) : 0.0;
+    }
 };
-//! Track map with track ID as key value
-typedef std::map<unsigned int, TrackRecord> TrackMap;
 
 //! Base class for everything that wants to receive track updates from TransmissionClient
 /** A class that should be notified of track updates has to derive from ITrackReceiver.
@@ -84,6 +259,20 @@ public:
     virtual void onTrackLost(const TrackRecord&) = 0;
 };
 
+//! Base class for everything that wants to read whole frames straight from the receive buffer
+/** onTrackFrame() is called once per received frame on the network thread, before the
+  * per-track ITrackReceiver callbacks. The TrackFrameView (see TrackLinkFrame.h) points
+  * into the receive buffer and is only valid during the call; nothing is copied or
+  * allocated to deliver it. Track states are raw, as sent by Pharus. */
+class ITrackFrameReceiver
+{
+public:
+	//! The Destructor
+	virtual ~ITrackFrameReceiver() {}
+    //! A complete frame has been received
+    virtual void onTrackFrame(const TrackFrameView& frame) = 0;
+};
+
 //! Handles network connection and updates registered track receivers
 /** This class deals with the actual network packets. It keeps a list of registered
   * ITrackReceiver derivates that are continuously updated with track data.
@@ -97,6 +286,10 @@ public:
       * Set multicast to false to use TrackLink in a unicast setup*/
     TrackLinkClient(bool _multicast = true, unsigned short _port = 44345, const char* _multicastGroup = "239.1.1.1");
 	  TrackLinkClient(bool _multicast = true, const char* _localIP = "127.0.0.1", unsigned short _port = 44345, const char* _multicastGroup = "239.1.1.1");
+    //! Construct from options
+    /** If options.reactor is set, the socket is serviced by the shared reactor
+      * instead of a dedicated receive thread. */
+    explicit TrackLinkClient(const TrackLinkOptions& options);
     //! The Destructor
     ~TrackLinkClient();
     //! Add a track receiver to be provided with tracking data
@@ -109,25 +302,199 @@ public:
       * \note Never leave deleted track receivers registered with TrackLinkClient as
       * this will cause a segfault. */
     void unregisterTrackReceiver(ITrackReceiver*);
+    //! Add a frame receiver to be provided with every raw frame
+    void registerFrameReceiver(ITrackFrameReceiver*);
+    //! Removes a frame receiver from the list
+    void unregisterFrameReceiver(ITrackFrameReceiver*);
     //! Obtain all current tracks at once
     /** It is recommended to use ITrackReceiver's callbacks to obtain data. As such, contrary
       * to all other methods, this one is not thread-safe, so race conditions have to be expected.
       * It's just left here in case someone desperately looks for an iterateable for the tracking data.
+      * Use acquireSnapshot() for a consistent, thread-safe view of all tracks. Echoes are only
+      * valid for records of the latest frame, stale ones carry an older EchoSpan::generation().
       * \return A const reference to TrackLinkClient's internal keep-safe of tracks. */
     const TrackMap& getTrackMap() const;
+    //! Obtain the tracks of the latest completely parsed frame
+    /** Snapshot mode only (TrackLinkOptions::snapshots). Lock-free, for a single consumer
+      * thread: the returned snapshot stays valid and unchanged until that thread calls
+      * acquireSnapshot() again. Use TrackSnapshotDiff to get new/updated/lost tracks.
+      * \return nullptr if snapshot mode is off */
+    const TrackSnapshot* acquireSnapshot();
+    //! Obtain the receive path counters
+    /** Thread-safe, may be called from any thread. */
+    TrackLinkStatistics getStatistics() const;
+    //! Current time on the clock of TrackRecord::arrivalTimeNs
+    /** ns since the Unix epoch (wall clock). Compare arrivalTimeNs against this to get
+      * the time a track spent between the network card and the caller. */
+    static long long timestampNow();
 
 private:
+    friend class TrackLinkReactor;
+
+    //! Datagrams fetched per receive wakeup at most
+    static constexpr int RECV_BATCH_SIZE = 16;
+    //! Size of one datagram slot and of a frame reassembly buffer
+    static constexpr int RECV_BUFFER_SIZE = 20480;
+
     std::vector<ITrackReceiver*> trackReceivers;
+    std::vector<ITrackFrameReceiver*> frameReceivers;
     TrackMap trackMap;
     std::unique_ptr<UDPManager> udpman;  // FIXED: Use smart pointer
-    std::thread recvThread;
+    TrackLinkThread recvThread;
     std::atomic<bool> threadExit;
+    //! Interrupts the dedicated receive thread's waits on shutdown (used without reactor)
+    std::unique_ptr<TrackLinkWakeup> wakeup;
     std::mutex recvMutex;
+    //! Dedicated receive thread (used without reactor)
     void receiveData();
+    //! Dedicated thread of a replaying client, feeds the capture file into processBatch()
+    void replayData();
+    //! Dedicated thread of a subscribing (or auto) bridge client
+    void bridgeData();
+    //! Reads the bridge until the publisher goes away (auto mode) or the client shuts down
+    void subscribeBridge();
+    //! Publisher side: takes the publisher role if it is free, at most once a second
+    void tryPublishBridge(long long now);
+    //! Subscriber side: turns the front bridge frame into callbacks, trackMap and snapshot
+    void deliverBridgeFrame();
+    //! Subscriber side: the publisher is gone, its tracks are lost
+    void dropBridgeTracks();
+    //! Publisher side after a takeover: inherited tracks the tracker no longer reports are lost
+    void reconcileBridgeTakeover();
+    //! Spins / yields on non-blocking receives within the busy-poll budget, then waits blocking
+    /** \return like pollSocket(); SOCKET_TIMEOUT only after the blocking wait timed out */
+    int busyPollSocket();
+    //! CPU time of the calling thread in ns, -1 if unsupported
+    static long long threadCpuTimeNs();
+    //! One attempt to create and bind the socket
+    bool openSocket();
+    //! Logs the receive statistics and closes the socket
+    void closeSocket();
+    //! Receives one batch of datagrams and dispatches the contained frames
+    /** \return number of datagrams received, or SOCKET_TIMEOUT / SOCKET_ERROR */
+    int pollSocket();
+    //! Reassembles and parses the frames of the first count datagrams in batch
+    void processBatch(int count);
+    void parseFrame(const char* recvBuf, int recvSize, long long arrivalNs);
+    //! Decodes one TUIO datagram, delivers the frames it completes
+    void parseTuioPacket(const char* data, int size, long long arrivalNs);
+    //! Frame start for every protocol: jitter, releases the previous frame's echoes
+    void beginFrame(long long arrivalNs);
+    //! Echoes of a trackMap record if it was part of the latest frame, else none
+    EchoSpan currentEchoes(const TrackRecord& track) const;
+    //! Updates trackMap with one decoded record and calls the track receivers
+    void dispatchTrack(const TrackRecord& decoded);
+    //! Frame end for every protocol: statistics, snapshot, bridge
+    void endFrame(long long arrivalNs);
+    //! Updates the inter-arrival jitter with the arrival time of a new frame
+    void recordFrameArrival(long long arrivalNs);
+    //! Copies trackMap into the snapshot back buffer and publishes it
+    void publishSnapshot(long long arrivalNs);
+    //! Per-track dispatch scratch of the receive path; reused so the steady state does not allocate
+    TrackRecord dispatchRecord;
+    std::vector<ITrackReceiver*> dispatchReceivers;
+    std::vector<ITrackFrameReceiver*> dispatchFrameReceivers;
+    //! Echoes of the frame being dispatched; TrackRecord::echoes point into it
+    /** Reserved for the largest possible frame, so it never reallocates while a frame is parsed */
+    std::vector<PharusVector2f> echoArena;
+    //! Incremented whenever echoArena is reused, see EchoSpan::generation()
+    unsigned int echoGeneration = 0;
+    //! Datagram slots, allocated once
+    std::vector<char> batchStorage;
+    std::vector<UDPDatagram> batch;
+    //! Multi-datagram frames, per sender
+    std::unique_ptr<TrackFrameAssembler> assembler;
+    //! TUIO session state, only with PROTOCOL_TUIO
+    std::unique_ptr<TuioDecoder> tuioDecoder;
+    //! Drops partial frames that timed out and publishes the assembler's counters
+    /** Called by the thread servicing the socket: the receive thread when idle, the reactor on its tick */
+    void expireReassembly(long long now);
+    //! Publishes the assembler's counters to the statistics
+    void publishReassemblyStats(long long now);
+    std::atomic<unsigned long long> statRecvSyscalls{0};
+    std::atomic<unsigned long long> statRecvDatagrams{0};
+    std::atomic<unsigned long long> statRecvBatches{0};
+    std::atomic<unsigned long long> statRecvBytes{0};
+    std::atomic<unsigned long long> statFrames{0};
+    std::atomic<unsigned long long> statTracks{0};
+    std::atomic<unsigned long long> statMalformedFrames{0};
+    std::atomic<unsigned long long> statOutdatedFrames{0};
+    std::atomic<int> statSenders{0};
+    std::atomic<unsigned long long> statReassemblyTimeouts{0};
+    std::atomic<unsigned long long> statReassemblyOverflows{0};
+    std::atomic<unsigned long long> statReassemblyEvictions{0};
+    std::atomic<long long> statLastArrivalNs{0};
+    std::atomic<long long> statJitterNs{0};
+    //! Jitter estimator state, receive thread only
+    long long prevFrameArrivalNs;
+    long long prevFrameIntervalNs;
+    double jitterNs;
+    std::atomic<bool> statSocketBound{false};
+    std::atomic<bool> statKernelTimestamps{false};
+    std::atomic<int> statReceiveBufferSize{0};
+    std::atomic<bool> statKernelDropCounter{false};
+    std::atomic<unsigned long long> statKernelDrops{0};
+    std::atomic<bool> statBusyPollSocket{false};
+    std::atomic<unsigned long long> statBusyPollEmpty{0};
+    std::atomic<unsigned long long> statBusyPollFallbacks{0};
+    std::atomic<long long> statReceiveCpuNs{-1};
+    std::atomic<unsigned long long> statReceiveDelaySumNs{0};
+    std::atomic<unsigned long long> statReceiveDelaySamples{0};
+    std::atomic<unsigned long long> statCapturedDatagrams{0};
+    std::atomic<bool> statReplayFinished{false};
+    //! Replay: a consumer is attached, playback may begin
+    std::atomic<bool> replayStarted{false};
+    //! Replay: releases the playback gate
+    void startReplay();
+    //! Raw datagram capture, receive thread only (TrackLinkOptions::captureFile)
+    std::unique_ptr<TrackCaptureWriter> captureWriter;
+    //! Datagram source instead of the socket (TrackLinkOptions::replayFile)
+    std::unique_ptr<TrackCaptureReader> replayReader;
+    double replaySpeed;
+    //! Snapshot triple buffer, only in snapshot mode
+    std::unique_ptr<TrackSnapshotBuffer> snapshotBuffer;
+    BridgeMode bridgeMode;
+    std::string bridgeName;
+    int bridgeMaxTracks;
+    //! Publisher role, receive thread only
+    std::unique_ptr<TrackBridgePublisher> bridgePublisher;
+    long long bridgeRetryNs;
+    bool bridgeWarned;
+    //! Subscriber role; open() / close() under bridgeMutex, which wake() from the destructor takes as well
+    std::unique_ptr<TrackBridgeReader> bridgeReader;
+    std::mutex bridgeMutex;
+    //! Frames read from the bridge, alternating: trackMap's echoes point into the front one while the next is read
+    std::unique_ptr<TrackSnapshot> bridgeFrames[2];
+    int bridgeFront;
+    std::unique_ptr<TrackSnapshotDiff> bridgeDiff;
+    unsigned long long bridgeVersion;
+    std::vector<TrackRecord> bridgeLost;
+    //! After a clean close the tracks are kept until a new publisher shows up, or until this time (0 = not waiting)
+    long long bridgeDropNs;
+    //! Takeover: tracks not received since bridgeTakeoverNs are lost once statFrames reaches bridgeReconcileFrame (0 = nothing to reconcile)
+    long long bridgeTakeoverNs;
+    unsigned long long bridgeReconcileFrame;
+    std::atomic<int> statBridgeRole{BRIDGE_OFF};
+    std::atomic<unsigned long long> statBridgeFrames{0};
+    std::atomic<unsigned long long> statBridgeSkippedFrames{0};
+    std::atomic<unsigned long long> statBridgeRetries{0};
+    std::atomic<unsigned long long> statBridgeTruncatedTracks{0};
+    //! Additional reuse-port sockets, each a client of its own (TrackLinkOptions::receiveWorkers)
+    std::vector<std::unique_ptr<TrackLinkClient>> workers;
+    //! Combines this client's and the workers' snapshots, consumer side
+    std::unique_ptr<TrackSnapshotMerger> merger;
+    std::vector<const TrackSnapshot*> mergeParts;
+    unsigned long long snapshotVersion;
     bool multicast;
 	const char* localIP;
     unsigned short port;
     const char* multicastGroup;
+    TrackLinkReactor* reactor;
+    int receiveBufferSize;
+    bool busyPoll;
+    int busyPollSpinUs;
+    int busyPollYieldUs;
+    int busyPollSocketUs;
 };
 
 } // #end namespace pharus
@@ -0,0 +1,217 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#pragma once
+
+#include "TrackLink.h"
+#include "TrackLinkWire.h"
+
+#include <cstring>
+#include <cstdint>
+#include <iterator>
+
+namespace pharus
+{
+
+//! Non-owning view of the echoes of one wire track record
+/** Only valid as long as the receive buffer it points into. */
+class EchoView
+{
+public:
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = PharusVector2f;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = PharusVector2f;
+
+        explicit Iterator(const char* _pos) : pos(_pos) {}
+        PharusVector2f operator*() const { return readEcho(pos); }
+        Iterator& operator++() { pos += wire::ECHO_SIZE; return *this; }
+        bool operator==(const Iterator& other) const { return pos == other.pos; }
+        bool operator!=(const Iterator& other) const { return pos != other.pos; }
+
+    private:
+        const char* pos;
+    };
+
+    EchoView() : data(nullptr), count(0) {}
+    EchoView(const char* _data, int _count) : data(_data), count(_count) {}
+
+    int size() const { return count; }
+    bool empty() const { return count == 0; }
+    //! Echo at index; index must be below size()
+    PharusVector2f operator[](int index) const { return readEcho(data + index * wire::ECHO_SIZE); }
+    Iterator begin() const { return Iterator(data); }
+    Iterator end() const { return Iterator(data + count * wire::ECHO_SIZE); }
+
+private:
+    static PharusVector2f readEcho(const char* echo)
+    {
+        PharusVector2f e;
+        e.x = wire::read<float>(echo + 1);
+        e.y = wire::read<float>(echo + 5);
+        return e;
+    }
+
+    //! Points at the first 'E'
+    const char* data;
+    int count;
+};
+
+//! Non-owning view of one wire track record
+/** Fields are read straight from the receive buffer on access. Only valid as long
+  * as that buffer; copy what you need to keep. */
+class TrackView
+{
+public:
+    TrackView() : fields(nullptr) {}
+
+    unsigned int trackID() const { return wire::read<unsigned int>(fields + wire::OFS_ID); }
+    TrackState state() const { return static_cast<TrackState>(wire::read<int32_t>(fields + wire::OFS_STATE)); }
+    PharusVector2f currentPos() const { return readVector(wire::OFS_CURRENT_POS); }
+    PharusVector2f expectPos() const { return readVector(wire::OFS_EXPECT_POS); }
+    PharusVector2f orientation() const { return readVector(wire::OFS_ORIENTATION); }
+    float speed() const { return wire::read<float>(fields + wire::OFS_SPEED); }
+    PharusVector2f relPos() const { return readVector(wire::OFS_REL_POS); }
+    const EchoView& echoes() const { return echoView; }
+
+private:
+    friend class TrackFrameView;
+
+    PharusVector2f readVector(int offset) const
+    {
+        PharusVector2f v;
+        v.x = wire::read<float>(fields + offset);
+        v.y = wire::read<float>(fields + offset + 4);
+        return v;
+    }
+
+    //! Points at the id (right after 'T')
+    const char* fields;
+    EchoView echoView;
+};
+
+//! Non-owning, bounds-checked view of a complete TrackLink frame
+/** Iterating yields one TrackView per well-formed track record. Iteration stops at the
+  * end of the frame or at the first malformed record; validate() tells which.
+  * Decoding never allocates and never reads outside [data, data + size). */
+class TrackFrameView
+{
+public:
+    //! Why decoding stopped
+    enum Error
+    {
+        //! Frame decoded to its end
+        OK,
+        //! Record does not start with 'T'
+        BAD_HEADER,
+        //! Record ends before its fixed fields or an echo are complete
+        TRUNCATED,
+        //! Record does not end with 't' (or an echo not with 'e')
+        BAD_TRAILER
+    };
+
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = TrackView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const TrackView*;
+        using reference = const TrackView&;
+
+        Iterator() : frame(nullptr), pos(-1) {}
+        Iterator(const TrackFrameView* _frame, int _pos) : frame(_frame), pos(_pos) { advance(); }
+        const TrackView& operator*() const { return current; }
+        const TrackView* operator->() const { return &current; }
+        Iterator& operator++() { advance(); return *this; }
+        bool operator==(const Iterator& other) const { return pos == other.pos; }
+        bool operator!=(const Iterator& other) const { return pos != other.pos; }
+
+    private:
+        void advance()
+        {
+            if (pos < 0 || frame->decode(pos, current) != OK)
+                pos = -1;
+        }
+
+        const TrackFrameView* frame;
+        //! Offset of the next record, -1 at the end
+        int pos;
+        TrackView current;
+    };
+
+    TrackFrameView(const char* _data, int _size) : data(_data), size(_size < 0 ? 0 : _size) {}
+
+    const char* bytes() const { return data; }
+    int byteSize() const { return size; }
+
+    Iterator begin() const { return Iterator(this, 0); }
+    Iterator end() const { return Iterator(); }
+
+    //! Decode the record at pos into out and advance pos past it
+    /** \return OK on success, else the reason (pos is left untouched).
+      * Check atEnd() first; decoding past the last record reports TRUNCATED. */
+    Error decode(int& pos, TrackView& out) const
+    {
+        if (pos >= size)
+            return TRUNCATED;
+        if (data[pos] != 'T')
+            return BAD_HEADER;
+        if (size - pos < wire::TRACK_MIN_SIZE)
+            return TRUNCATED;
+
+        int cur = pos + 1;
+        out.fields = data + cur;
+        cur += wire::TRACK_FIELDS_SIZE;
+
+        const char* echoes = data + cur;
+        int echoCount = 0;
+        while (cur < size && data[cur] == 'E')  // peek if echo(es) available
+        {
+            if (size - cur < wire::ECHO_SIZE)
+                return TRUNCATED;
+            if (data[cur + wire::ECHO_SIZE - 1] != 'e')
+                return BAD_TRAILER;
+            cur += wire::ECHO_SIZE;
+            ++echoCount;
+        }
+
+        if (cur >= size)
+            return TRUNCATED;
+        if (data[cur++] != 't')
+            return BAD_TRAILER;
+
+        out.echoView = EchoView(echoes, echoCount);
+        pos = cur;
+        return OK;
+    }
+
+    //! True if pos is past the last record
+    bool atEnd(int pos) const { return pos >= size; }
+
+    //! Walks the whole frame
+    /** \return OK if every record is well-formed, else the first error */
+    Error validate() const
+    {
+        TrackView track;
+        int pos = 0;
+        while (!atEnd(pos))
+        {
+            const Error error = decode(pos, track);
+            if (error != OK)
+                return error;
+        }
+        return OK;
+    }
+
+private:
+    const char* data;
+    int size;
+};
+
+} // #end namespace pharus
@@ -0,0 +1,366 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#include "TrackLinkReactor.h"
+#include "TrackLink.h"
+#include "UDPManager.h"
+#include "TrackLinkWakeup.h"
+
+#include "AefPharus.h" // Module logging
+#include <algorithm>
+#include <string>
+
+#if PLATFORM_LINUX
+	#include <sys/epoll.h>
+	#include <unistd.h>
+#endif
+
+using namespace pharus;
+
+//! One attached client
+struct TrackLinkReactor::Entry
+{
+    TrackLinkClient* client = nullptr;
+    //! Held while the reactor binds or dispatches; removeClient() takes it to wait for both
+    std::mutex mutex;
+    //! Cleared by removeClient(), the reactor no longer touches the client afterwards
+    bool alive = true;
+    //! Set once the socket is bound and registered; socket is valid afterwards
+    std::atomic<bool> bound{false};
+    SOCKET socket = INVALID_SOCKET;
+    std::chrono::steady_clock::time_point nextBindAttempt;
+};
+
+//! One network I/O thread and the clients it services
+struct TrackLinkReactor::Shard
+{
+    TrackLinkThread thread;
+    //! Protects entries. Lock order: never take an entry mutex while holding this one
+    std::mutex mutex;
+    std::vector<std::shared_ptr<Entry>> entries;
+    //! Number of entries still waiting for their socket to be bound
+    std::atomic<int> unbound{0};
+    //! Ready entries of the current wait, only used by the shard's thread
+    std::vector<std::shared_ptr<Entry>> ready;
+    //! Next reassembly timeout tick, only used by the shard's thread
+    std::chrono::steady_clock::time_point nextExpire;
+    //! Interrupts the wait when a client is added or the reactor shuts down
+    TrackLinkWakeup wakeup;
+#if PLATFORM_LINUX
+    int epollFd = -1;
+#endif
+};
+
+TrackLinkReactor::TrackLinkReactor(int numThreads, const TrackLinkThreadOptions& threadOptions)
+: nextShard(0)
+, clientCount(0)
+, threadExit(false)
+{
+    numThreads = std::max(numThreads, 1);
+    for (int i = 0; i < numThreads; ++i)
+    {
+        std::unique_ptr<Shard> shard = std::make_unique<Shard>();
+        shard->ready.reserve(MAX_EVENTS);
+#if PLATFORM_LINUX
+        shard->epollFd = epoll_create1(0);
+        if (shard->epollFd < 0)
+        {
+            UE_LOG(LogAefPharus, Error, TEXT("TrackLinkReactor: epoll_create1 failed (errno %d)"), errno);
+        }
+        else if (shard->wakeup.getHandle() != INVALID_SOCKET)
+        {
+            // data.ptr nullptr marks the wakeup, every other event points to an Entry
+            epoll_event ev;
+            memset(&ev, 0, sizeof(ev));
+            ev.events = EPOLLIN;
+            ev.data.ptr = nullptr;
+            epoll_ctl(shard->epollFd, EPOLL_CTL_ADD, shard->wakeup.getHandle(), &ev);
+        }
+#endif
+        shards.push_back(std::move(shard));
+    }
+
+    const std::string baseName = threadOptions.name.empty() ? std::string("PharusNetworkIO") : threadOptions.name;
+    for (size_t i = 0; i < shards.size(); ++i)
+    {
+        Shard* shardPtr = shards[i].get();
+        TrackLinkThreadOptions shardOptions = threadOptions;
+        shardOptions.name = baseName + " " + std::to_string(i);
+        if (!shardPtr->thread.start([this, shardPtr]() { run(*shardPtr); }, shardOptions))
+        {
+            UE_LOG(LogAefPharus, Error, TEXT("TrackLinkReactor: Network I/O thread %d did not start, its clients receive nothing"), (int)i);
+        }
+    }
+
+    UE_LOG(LogAefPharus, Log, TEXT("TrackLinkReactor: Started %d network I/O thread(s)"), numThreads);
+}
+
+TrackLinkReactor::~TrackLinkReactor()
+{
+    threadExit = true;
+    for (auto& shard : shards)
+        shard->wakeup.signal();
+    for (auto& shard : shards)
+    {
+        if (shard->thread.joinable())
+            shard->thread.join();
+#if PLATFORM_LINUX
+        if (shard->epollFd >= 0)
+            close(shard->epollFd);
+#endif
+    }
+
+    if (clientCount > 0)
+    {
+        UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkReactor: Destroyed with %d client(s) still attached"), clientCount.load());
+    }
+}
+
+int TrackLinkReactor::getThreadCount() const
+{
+    return (int)shards.size();
+}
+
+int TrackLinkReactor::getClientCount() const
+{
+    return clientCount;
+}
+
+void TrackLinkReactor::addClient(TrackLinkClient* client)
+{
+    std::shared_ptr<Entry> entry = std::make_shared<Entry>();
+    entry->client = client;
+    entry->nextBindAttempt = std::chrono::steady_clock::now();
+
+    Shard& shard = *shards[nextShard.fetch_add(1) % shards.size()];
+    ++shard.unbound;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.entries.push_back(entry);
+    }
+    ++clientCount;
+    // bind now rather than after the current wait times out
+    shard.wakeup.signal();
+}
+
+void TrackLinkReactor::removeClient(TrackLinkClient* client)
+{
+    std::shared_ptr<Entry> entry;
+    Shard* owner = nullptr;
+    for (auto& shard : shards)
+    {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        auto iter = std::find_if(shard->entries.begin(), shard->entries.end(),
+            [client](const std::shared_ptr<Entry>& e) { return e->client == client; });
+        if (iter != shard->entries.end())
+        {
+            entry = *iter;
+            owner = shard.get();
+            shard->entries.erase(iter);
+            break;
+        }
+    }
+
+    if (!entry)
+        return;
+
+    // waits for a bind or dispatch in progress
+    std::lock_guard<std::mutex> entryLock(entry->mutex);
+    if (entry->bound)
+    {
+#if PLATFORM_LINUX
+        epoll_ctl(owner->epollFd, EPOLL_CTL_DEL, entry->socket, nullptr);
+#endif
+    }
+    else
+    {
+        --owner->unbound;
+    }
+    entry->alive = false;
+    --clientCount;
+}
+
+void TrackLinkReactor::bindPending(Shard& shard)
+{
+    const auto now = std::chrono::steady_clock::now();
+
+    std::vector<std::shared_ptr<Entry>>& pending = shard.ready;
+    pending.clear();
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto& entry : shard.entries)
+        {
+            if (!entry->bound && entry->nextBindAttempt <= now)
+                pending.push_back(entry);
+        }
+    }
+
+    for (auto& entry : pending)
+    {
+        std::lock_guard<std::mutex> entryLock(entry->mutex);
+        if (!entry->alive || entry->bound)
+            continue;
+
+        TrackLinkClient* client = entry->client;
+        if (!client->openSocket())
+        {
+            entry->nextBindAttempt = now + std::chrono::seconds(1);
+            continue;
+        }
+
+        // the reactor waits for readiness itself; never block in the receive call
+        client->udpman->SetTimeoutReceive(NO_TIMEOUT);
+        client->udpman->SetBlocking(false);
+        entry->socket = client->udpman->GetSocket();
+
+#if PLATFORM_LINUX
+        epoll_event ev;
+        memset(&ev, 0, sizeof(ev));
+        ev.events = EPOLLIN;
+        ev.data.ptr = entry.get();
+        if (epoll_ctl(shard.epollFd, EPOLL_CTL_ADD, entry->socket, &ev) != 0)
+        {
+            UE_LOG(LogAefPharus, Error, TEXT("TrackLinkReactor: epoll_ctl(ADD) failed (errno %d), retrying..."), errno);
+            client->closeSocket();
+            entry->socket = INVALID_SOCKET;
+            entry->nextBindAttempt = now + std::chrono::seconds(1);
+            continue;
+        }
+#endif
+
+        entry->bound = true;
+        --shard.unbound;
+    }
+    pending.clear();
+}
+
+void TrackLinkReactor::expireReassembly(Shard& shard)
+{
+    std::vector<std::shared_ptr<Entry>>& bound = shard.ready;
+    bound.clear();
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto& entry : shard.entries)
+        {
+            if (entry->bound)
+                bound.push_back(entry);
+        }
+    }
+
+    const long long now = TrackLinkClient::timestampNow();
+    for (auto& entry : bound)
+    {
+        std::lock_guard<std::mutex> entryLock(entry->mutex);
+        if (entry->alive && entry->bound)
+            entry->client->expireReassembly(now);
+    }
+    bound.clear();
+}
+
+void TrackLinkReactor::dispatch(Entry& entry)
+{
+    std::lock_guard<std::mutex> entryLock(entry.mutex);
+    if (entry.alive && entry.bound)
+        entry.client->pollSocket();
+}
+
+void TrackLinkReactor::run(Shard& shard)
+{
+#if PLATFORM_LINUX
+    epoll_event events[MAX_EVENTS];
+#endif
+
+    while (!threadExit)
+    {
+        if (shard.unbound > 0)
+            bindPending(shard);
+
+        // drop frames of senders that stopped mid-frame, let quiet senders age out
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= shard.nextExpire)
+        {
+            shard.nextExpire = now + std::chrono::milliseconds(EXPIRE_INTERVAL_MS);
+            expireReassembly(shard);
+        }
+
+        shard.ready.clear();
+
+#if PLATFORM_LINUX
+        const int count = epoll_wait(shard.epollFd, events, MAX_EVENTS, POLL_TIMEOUT_MS);
+        if (count <= 0)
+            continue;
+
+        // resolve events to live entries; removed entries are no longer in the list
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (int i = 0; i < count; ++i)
+            {
+                if (events[i].data.ptr == nullptr)
+                {
+                    shard.wakeup.reset();
+                    continue;
+                }
+                for (auto& entry : shard.entries)
+                {
+                    if (entry.get() == events[i].data.ptr)
+                    {
+                        shard.ready.push_back(entry);
+                        break;
+                    }
+                }
+            }
+        }
+#else
+        fd_set readSet;
+        FD_ZERO(&readSet);
+        const SOCKET wakeupSocket = shard.wakeup.getHandle();
+        SOCKET maxSocket = 0;
+        if (wakeupSocket != INVALID_SOCKET)
+        {
+            FD_SET(wakeupSocket, &readSet);
+            maxSocket = wakeupSocket;
+        }
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (auto& entry : shard.entries)
+            {
+                if (entry->bound)
+                {
+                    FD_SET(entry->socket, &readSet);
+                    maxSocket = std::max(maxSocket, entry->socket);
+                    shard.ready.push_back(entry);
+                }
+            }
+        }
+
+        // select() rejects an empty set
+        if (shard.ready.empty() && wakeupSocket == INVALID_SOCKET)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(POLL_TIMEOUT_MS));
+            continue;
+        }
+
+        struct timeval tv = { 0, POLL_TIMEOUT_MS * 1000 };
+        const int count = select((int)maxSocket + 1, &readSet, NULL, NULL, &tv);
+        if (count <= 0)
+        {
+            shard.ready.clear();
+            continue;
+        }
+        if (wakeupSocket != INVALID_SOCKET && FD_ISSET(wakeupSocket, &readSet))
+            shard.wakeup.reset();
+
+        // keep only the readable ones
+        shard.ready.erase(std::remove_if(shard.ready.begin(), shard.ready.end(),
+            [&readSet](const std::shared_ptr<Entry>& entry) { return !FD_ISSET(entry->socket, &readSet); }),
+            shard.ready.end());
+#endif
+
+        for (auto& entry : shard.ready)
+        {
+            dispatch(*entry);
+        }
+        shard.ready.clear();
+    }
+}
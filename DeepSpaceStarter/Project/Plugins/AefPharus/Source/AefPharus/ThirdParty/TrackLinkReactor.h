@@ -0,0 +1,82 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#pragma once
+
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <memory>
+#include <chrono>
+
+#include "TrackLinkThread.h"
+
+namespace pharus
+{
+class TrackLinkClient;
+
+//! Shared network I/O for many TrackLinkClients
+/** Instead of one receive thread per TrackLinkClient, a reactor services the sockets of
+  * all attached clients from a small, fixed number of threads. Clients are distributed
+  * round-robin over the threads; every thread waits on its own set of sockets
+  * (epoll on Linux, select() elsewhere) and dispatches readable sockets to their client.
+  * Binding (including the 1 s retry on failure) is done by the reactor as well. Adding
+  * a client and destroying the reactor wake the threads, so neither waits for a poll timeout.
+  *
+  * Clients attach by passing the reactor in TrackLinkOptions. The reactor must outlive
+  * every client attached to it. */
+class TrackLinkReactor
+{
+public:
+    //! The Constructor
+    /** Starts numThreads network I/O threads (at least one), all with the priority and
+      * core affinity of threadOptions. They are named "<name> <index>", by default
+      * "PharusNetworkIO <index>". */
+    explicit TrackLinkReactor(int numThreads = 1, const TrackLinkThreadOptions& threadOptions = TrackLinkThreadOptions());
+    //! The Destructor
+    /** Stops and joins all threads. All clients must have been destroyed before. */
+    ~TrackLinkReactor();
+
+    TrackLinkReactor(const TrackLinkReactor&) = delete;
+    TrackLinkReactor& operator=(const TrackLinkReactor&) = delete;
+
+    //! Number of network I/O threads
+    int getThreadCount() const;
+    //! Number of currently attached clients
+    int getClientCount() const;
+
+private:
+    friend class TrackLinkClient;
+
+    //! Maximum time a thread waits for socket activity before it retries failed binds
+    static constexpr int POLL_TIMEOUT_MS = 100;
+    //! Interval of the reassembly timeout tick, also while other sockets keep the thread busy
+    static constexpr int EXPIRE_INTERVAL_MS = POLL_TIMEOUT_MS;
+    //! Socket readiness events fetched per wait
+    static constexpr int MAX_EVENTS = 32;
+
+    struct Entry;
+    struct Shard;
+
+    //! Attach a client; its socket is bound asynchronously by the owning thread
+    void addClient(TrackLinkClient* client);
+    //! Detach a client
+    /** Returns once no reactor thread uses the client any more. Must not be called
+      * from a track receiver callback. */
+    void removeClient(TrackLinkClient* client);
+
+    void run(Shard& shard);
+    void bindPending(Shard& shard);
+    //! Expires partial frames of every bound client of the shard
+    void expireReassembly(Shard& shard);
+    void dispatch(Entry& entry);
+
+    std::vector<std::unique_ptr<Shard>> shards;
+    std::atomic<unsigned int> nextShard;
+    std::atomic<int> clientCount;
+    std::atomic<bool> threadExit;
+};
+
+} // #end namespace pharus
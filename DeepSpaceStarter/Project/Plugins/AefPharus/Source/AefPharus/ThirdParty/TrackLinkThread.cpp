@@ -0,0 +1,52 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#include "TrackLinkThread.h"
+
+#include "AefPharus.h" // Module logging
+#include "HAL/RunnableThread.h"
+
+using namespace pharus;
+
+TrackLinkThread::TrackLinkThread()
+: thread(nullptr)
+{
+}
+
+TrackLinkThread::~TrackLinkThread()
+{
+    join();
+}
+
+bool TrackLinkThread::start(std::function<void()> _body, const TrackLinkThreadOptions& options)
+{
+    join();
+    body = std::move(_body);
+
+    const FString name = options.name.empty() ? FString(TEXT("PharusNetwork")) : FString(UTF8_TO_TCHAR(options.name.c_str()));
+    const uint64 affinityMask = options.affinityMask != 0 ? (uint64)options.affinityMask : FPlatformAffinity::GetNoAffinityMask();
+    thread = FRunnableThread::Create(this, *name, 0, options.priority, affinityMask);
+    if (!thread)
+    {
+        UE_LOG(LogAefPharus, Error, TEXT("TrackLinkThread: Unable to start thread '%s'"), *name);
+        return false;
+    }
+    return true;
+}
+
+void TrackLinkThread::join()
+{
+    if (!thread)
+        return;
+
+    thread->WaitForCompletion();
+    delete thread;
+    thread = nullptr;
+}
+
+uint32 TrackLinkThread::Run()
+{
+    body();
+    return 0;
+}
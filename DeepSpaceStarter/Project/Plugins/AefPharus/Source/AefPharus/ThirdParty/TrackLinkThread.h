@@ -0,0 +1,64 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#pragma once
+
+#include "HAL/Runnable.h"
+#include "HAL/PlatformAffinity.h"
+
+#include <functional>
+#include <string>
+
+class FRunnableThread;
+
+namespace pharus
+{
+
+//! Name and scheduling of a TrackLink network thread
+struct TrackLinkThreadOptions
+{
+    //! Thread name shown in Unreal Insights and debuggers, empty picks a default
+    std::string name;
+    //! Scheduling priority
+    EThreadPriority priority = TPri_Normal;
+    //! Logical cores the thread may run on, one bit per core; 0 = no restriction
+    /** Use it to keep the network thread off the cores of the render and RHI threads. */
+    unsigned long long affinityMask = 0;
+};
+
+//! Engine thread (FRunnableThread) running one function
+/** Network threads of TrackLinkClient and TrackLinkReactor run on this instead of a bare
+  * std::thread, so they are named in Unreal Insights and take the priority and core
+  * affinity of TrackLinkThreadOptions. The function has to return on its own once its
+  * owner asks it to (an exit flag); join() only waits for that. */
+class TrackLinkThread : public FRunnable
+{
+public:
+    TrackLinkThread();
+    //! Joins a still running thread
+    ~TrackLinkThread() override;
+
+    TrackLinkThread(const TrackLinkThread&) = delete;
+    TrackLinkThread& operator=(const TrackLinkThread&) = delete;
+
+    //! Starts the thread
+    /** \return false if the platform could not create it */
+    bool start(std::function<void()> body, const TrackLinkThreadOptions& options);
+    //! Waits until the function returned
+    void join();
+    //! Thread was started and not joined yet
+    bool joinable() const
+    {
+        return thread != nullptr;
+    }
+
+    // FRunnable
+    uint32 Run() override;
+
+private:
+    std::function<void()> body;
+    FRunnableThread* thread;
+};
+
+} // #end namespace pharus
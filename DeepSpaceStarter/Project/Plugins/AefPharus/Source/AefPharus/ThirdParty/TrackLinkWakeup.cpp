@@ -0,0 +1,138 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#include "TrackLinkWakeup.h"
+
+#include "AefPharus.h" // Module logging
+#include <chrono>
+#include <thread>
+
+#if PLATFORM_LINUX
+	#include <sys/eventfd.h>
+	#include <poll.h>
+	#include <unistd.h>
+	#include <stdint.h>
+#endif
+
+using namespace pharus;
+
+#if PLATFORM_LINUX
+
+TrackLinkWakeup::TrackLinkWakeup()
+: eventFd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+{
+    if (eventFd < 0)
+    {
+        UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkWakeup: eventfd failed (errno %d), shutdown waits for the receive timeout"), errno);
+    }
+}
+
+TrackLinkWakeup::~TrackLinkWakeup()
+{
+    if (eventFd >= 0)
+        close(eventFd);
+}
+
+SOCKET TrackLinkWakeup::getHandle() const
+{
+    return eventFd >= 0 ? eventFd : INVALID_SOCKET;
+}
+
+void TrackLinkWakeup::signal()
+{
+    if (eventFd < 0)
+        return;
+    const uint64_t one = 1;
+    ssize_t ret = write(eventFd, &one, sizeof(one));
+    (void)ret;  // EAGAIN only if the counter is saturated, i.e. already signalled
+}
+
+void TrackLinkWakeup::reset()
+{
+    if (eventFd < 0)
+        return;
+    uint64_t count;
+    ssize_t ret = read(eventFd, &count, sizeof(count));
+    (void)ret;
+}
+
+bool TrackLinkWakeup::wait(int timeoutMs)
+{
+    if (eventFd < 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
+        return false;
+    }
+    struct pollfd pfd;
+    pfd.fd = eventFd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    return poll(&pfd, 1, timeoutMs) > 0;
+}
+
+#else
+
+TrackLinkWakeup::TrackLinkWakeup()
+: loopback(std::make_unique<UDPManager>())
+{
+    // a socket that talks to itself: every signal() makes it readable
+    InetAddr local;
+    if (!loopback->Create() || !loopback->Bind(0, "127.0.0.1") || !loopback->GetLocalAddr(local) || !loopback->Connect(local))
+    {
+        UE_LOG(LogAefPharus, Warning, TEXT("TrackLinkWakeup: Unable to create loopback socket, shutdown waits for the receive timeout"));
+        loopback.reset();
+        return;
+    }
+    loopback->SetBlocking(false);
+    loopback->SetTimeoutReceive(NO_TIMEOUT);
+}
+
+TrackLinkWakeup::~TrackLinkWakeup()
+{
+    if (loopback)
+        loopback->Close();
+}
+
+SOCKET TrackLinkWakeup::getHandle() const
+{
+    return loopback ? loopback->GetSocket() : INVALID_SOCKET;
+}
+
+void TrackLinkWakeup::signal()
+{
+    if (!loopback)
+        return;
+    const char byte = 1;
+    loopback->Send(&byte, 1);
+}
+
+void TrackLinkWakeup::reset()
+{
+    if (!loopback)
+        return;
+    char buf[16];
+    UDPDatagram slot;
+    slot.pBuff = buf;
+    slot.iCapacity = sizeof(buf);
+    while (loopback->ReceiveBatch(&slot, 1) > 0)
+    {
+    }
+}
+
+bool TrackLinkWakeup::wait(int timeoutMs)
+{
+    if (!loopback)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
+        return false;
+    }
+    SOCKET handle = loopback->GetSocket();
+    fd_set fd;
+    FD_ZERO(&fd);
+    FD_SET(handle, &fd);
+    struct timeval tv = { timeoutMs / 1000, (timeoutMs % 1000) * 1000 };
+    return select((int)handle + 1, &fd, nullptr, nullptr, &tv) > 0;
+}
+
+#endif
@@ -0,0 +1,48 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#pragma once
+
+#include "UDPManager.h"
+
+#include <memory>
+
+namespace pharus
+{
+
+//! Interrupts a network thread waiting for socket activity
+/** Provides a handle that can be waited on together with sockets (select(), epoll) and
+  * becomes readable when another thread calls signal(). TrackLinkClient and TrackLinkReactor
+  * use it so shutdown and restart do not wait for the receive timeout.
+  *
+  * Linux uses an eventfd; elsewhere a loopback UDP socket that sends a byte to itself. */
+class TrackLinkWakeup
+{
+public:
+    TrackLinkWakeup();
+    ~TrackLinkWakeup();
+
+    TrackLinkWakeup(const TrackLinkWakeup&) = delete;
+    TrackLinkWakeup& operator=(const TrackLinkWakeup&) = delete;
+
+    //! Handle that is readable while signalled, INVALID_SOCKET if it could not be created
+    SOCKET getHandle() const;
+    //! Wakes the waiting thread; thread-safe, may be called any number of times
+    void signal();
+    //! Consumes pending signals, so the handle is no longer readable (waiting thread only)
+    void reset();
+    //! Sleeps until signalled or timeoutMs passed
+    /** Does not reset. Without a valid handle this is a plain sleep.
+      * \return true if signalled */
+    bool wait(int timeoutMs);
+
+private:
+#if PLATFORM_LINUX
+    int eventFd;
+#else
+    std::unique_ptr<UDPManager> loopback;
+#endif
+};
+
+} // #end namespace pharus
@@ -0,0 +1,49 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#pragma once
+
+#include <cstring>
+
+namespace pharus
+{
+
+//! Wire layout of a TrackLink frame
+/** A frame is a sequence of track records:
+  * 'T' id(4) state(4) currentPos(8) expectPos(8) orientation(8) speed(4) relPos(8)
+  * followed by 0..n echoes 'E' x(4) y(4) 'e' and the trailing 't'.
+  * All values are little-endian 32 bit, not aligned. */
+namespace wire
+{
+    //! Bytes from the id up to and including relPos
+    static constexpr int TRACK_FIELDS_SIZE = 4 + 4 + 8 + 8 + 8 + 4 + 8;
+    //! 'T' + fields + 't'
+    static constexpr int TRACK_MIN_SIZE = 1 + TRACK_FIELDS_SIZE + 1;
+    //! 'E' + x + y + 'e'
+    static constexpr int ECHO_SIZE = 10;
+
+    static constexpr int OFS_ID = 0;
+    static constexpr int OFS_STATE = 4;
+    static constexpr int OFS_CURRENT_POS = 8;
+    static constexpr int OFS_EXPECT_POS = 16;
+    static constexpr int OFS_ORIENTATION = 24;
+    static constexpr int OFS_SPEED = 32;
+    static constexpr int OFS_REL_POS = 36;
+
+    template <typename T>
+    inline T read(const char* p)
+    {
+        T value;
+        memcpy(&value, p, sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    inline void write(char* p, T value)
+    {
+        memcpy(p, &value, sizeof(T));
+    }
+}
+
+} // #end namespace pharus
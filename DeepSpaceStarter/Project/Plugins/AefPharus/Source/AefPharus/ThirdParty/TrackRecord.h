@@ -0,0 +1,81 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#pragma once
+
+#include <cstddef>
+
+namespace pharus
+{
+//! Helper structure to store two-dimensional values
+struct PharusVector2f
+{
+    float x, y;
+};
+
+//!Denotes the track's state
+enum TrackState
+{
+    //! The track has been made public for the first iteration
+    TS_NEW,
+    //! The track is already known - this is a position update
+    TS_CONT,
+    //! The track has disappeared - this is the last notification of it
+    TS_OFF
+};
+//! Non-owning view of a track's echoes
+/** Points into the per-frame echo arena of the TrackLinkClient (or TrackSnapshot) that
+  * delivered the record. Valid until that client parses its next frame (or the snapshot
+  * is released); copy what you need to keep. A client's records of tracks missing from
+  * its latest frame keep their old span; generation() tells them apart. */
+class EchoSpan
+{
+public:
+    EchoSpan() : items(nullptr), count(0), arenaGeneration(0) {}
+    EchoSpan(const PharusVector2f* _items, unsigned int _count, unsigned int _generation = 0)
+        : items(_items), count(_count), arenaGeneration(_generation) {}
+
+    unsigned int size() const { return count; }
+    bool empty() const { return count == 0; }
+    //! Echo at index; index must be below size()
+    const PharusVector2f& operator[](unsigned int index) const { return items[index]; }
+    const PharusVector2f* data() const { return items; }
+    const PharusVector2f* begin() const { return items; }
+    const PharusVector2f* end() const { return items + count; }
+    //! Frame of the client's echo arena the span points into, 0 for other arenas
+    unsigned int generation() const { return arenaGeneration; }
+
+private:
+    const PharusVector2f* items;
+    unsigned int count;
+    unsigned int arenaGeneration;
+};
+
+//! Structure that holds all information of a track.
+/** Distances, positions are in meters, velocities in meters per second */
+struct TrackRecord
+{
+    //! The track's unique ID
+    unsigned int trackID;
+    //! The track's current position
+	PharusVector2f currentPos;
+    //! The position the track is expected in the next frame
+	PharusVector2f expectPos;
+    //! The track's current position in relative coordinates (TUIO style)
+	PharusVector2f relPos;
+    //! The track's current heading (normalized directional vector). Valid if speed is above 0.25.
+	PharusVector2f orientation;
+    //! The track's current speed
+    float speed;
+    //! Yields in what state the track currently is
+    TrackState state;
+    //! CONFIRMED echoes that 'belong' to this track in relative coordinates (TUIO style)
+    /** Only valid for the frame the record was delivered with, see EchoSpan */
+    EchoSpan echoes;
+    //! Arrival time of the frame that carried this record, in ns (see TrackLinkClient::timestampNow()), 0 if unknown
+    /** Kernel receive timestamp of the frame's first datagram where available */
+    long long arrivalTimeNs = 0;
+};
+
+} // #end namespace pharus
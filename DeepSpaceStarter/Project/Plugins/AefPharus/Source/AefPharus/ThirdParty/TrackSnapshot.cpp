@@ -0,0 +1,168 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#include "TrackSnapshot.h"
+
+using namespace pharus;
+
+TrackSnapshotBuffer::TrackSnapshotBuffer()
+: back(0)
+, front(1)
+, middle(2)
+{
+}
+
+TrackSnapshot& TrackSnapshotBuffer::writeBuffer()
+{
+    return slots[back];
+}
+
+void TrackSnapshotBuffer::publish()
+{
+    // release: the snapshot contents become visible to the reader with the index
+    back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+}
+
+const TrackSnapshot& TrackSnapshotBuffer::acquire()
+{
+    if (middle.load(std::memory_order_relaxed) & FRESH)
+    {
+        front = middle.exchange(front, std::memory_order_acq_rel) & INDEX_MASK;
+    }
+    return slots[front];
+}
+
+bool TrackSnapshotDiff::apply(const TrackSnapshot& snapshot)
+{
+    if (snapshot.version == lastVersion)
+        return false;
+    lastVersion = snapshot.version;
+
+    added.clear();
+    updated.clear();
+    lost.clear();
+    currentIDs.clear();
+
+    // both sides are sorted by ID: one merge pass
+    size_t prev = 0;
+    for (const TrackRecord& track : snapshot.tracks)
+    {
+        while (prev < previousIDs.size() && previousIDs[prev] < track.trackID)
+            lost.push_back(previousIDs[prev++]);
+
+        if (prev < previousIDs.size() && previousIDs[prev] == track.trackID)
+        {
+            updated.push_back(&track);
+            ++prev;
+        }
+        else
+        {
+            added.push_back(&track);
+        }
+        currentIDs.push_back(track.trackID);
+    }
+    while (prev < previousIDs.size())
+        lost.push_back(previousIDs[prev++]);
+
+    previousIDs.swap(currentIDs);
+    return true;
+}
+
+void TrackSnapshotDiff::reset()
+{
+    lastVersion = 0;
+    previousIDs.clear();
+    added.clear();
+    updated.clear();
+    lost.clear();
+}
+
+void TrackSnapshotDiff::rebase()
+{
+    // versions of different sources are unrelated. 0 is the empty snapshot before the
+    // first frame, so the previous tracks stay until the new source delivers one
+    lastVersion = 0;
+}
+
+const TrackSnapshot& TrackSnapshotMerger::merge(const TrackSnapshot* const* parts, size_t count, long long now)
+{
+    // which workers contribute (bit per part), and did any of them publish since last time?
+    unsigned long long includedMask = 0;
+    unsigned long long versionSum = 0;
+    included.clear();
+    for (size_t p = 0; p < count && p < 64; ++p)
+    {
+        const TrackSnapshot* part = parts[p];
+        if (part->version == 0 || now - part->arrivalTimeNs > STALE_NS)
+            continue;
+        includedMask |= 1ull << p;
+        versionSum += part->version;
+        included.push_back(part);
+    }
+    if (includedMask == lastIncluded && versionSum == lastVersionSum)
+        return merged;
+    lastIncluded = includedMask;
+    lastVersionSum = versionSum;
+
+    // echo arenas back to back; spans are rebased once the arena is complete
+    merged.echoes.clear();
+    echoOffsets.resize(included.size());
+    for (size_t p = 0; p < included.size(); ++p)
+    {
+        echoOffsets[p] = merged.echoes.size();
+        merged.echoes.insert(merged.echoes.end(), included[p]->echoes.begin(), included[p]->echoes.end());
+    }
+
+    // k-way merge by ID; k is the worker count, so a linear scan for the head is enough
+    merged.tracks.clear();
+    merged.arrivalTimeNs = 0;
+    cursors.assign(included.size(), 0);
+    for (;;)
+    {
+        int best = -1;
+        for (size_t p = 0; p < included.size(); ++p)
+        {
+            if (cursors[p] >= included[p]->tracks.size())
+                continue;
+            const TrackRecord& head = included[p]->tracks[cursors[p]];
+            if (best < 0)
+            {
+                best = (int)p;
+                continue;
+            }
+            const TrackRecord& bestHead = included[best]->tracks[cursors[best]];
+            if (head.trackID < bestHead.trackID)
+            {
+                best = (int)p;
+            }
+            else if (head.trackID == bestHead.trackID)
+            {
+                // same ID from two workers: keep the fresher record, drop the other
+                ++duplicates;
+                if (head.arrivalTimeNs > bestHead.arrivalTimeNs)
+                {
+                    ++cursors[best];
+                    best = (int)p;
+                }
+                else
+                {
+                    ++cursors[p];
+                }
+            }
+        }
+        if (best < 0)
+            break;
+
+        const TrackSnapshot& part = *included[best];
+        merged.tracks.push_back(part.tracks[cursors[best]++]);
+        TrackRecord& track = merged.tracks.back();
+        if (!track.echoes.empty())
+            track.echoes = EchoSpan(merged.echoes.data() + echoOffsets[best] + (track.echoes.data() - part.echoes.data()), track.echoes.size());
+        if (part.arrivalTimeNs > merged.arrivalTimeNs)
+            merged.arrivalTimeNs = part.arrivalTimeNs;
+    }
+
+    ++merged.version;
+    return merged;
+}
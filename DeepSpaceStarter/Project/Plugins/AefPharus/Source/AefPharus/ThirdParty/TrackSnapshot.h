@@ -0,0 +1,132 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#pragma once
+
+#include "TrackLink.h"
+
+#include <atomic>
+#include <vector>
+
+namespace pharus
+{
+
+//! All tracks of one completely parsed frame
+/** Published by TrackLinkClient in snapshot mode (TrackLinkOptions::snapshots).
+  * A snapshot never changes while a consumer holds it. */
+struct TrackSnapshot
+{
+    //! Increases by one with every published frame, 0 until the first frame arrived
+    unsigned long long version = 0;
+    //! Live tracks (never TS_OFF), sorted by trackID
+    std::vector<TrackRecord> tracks;
+    //! Echo arena of the frame; the tracks' echoes point into it
+    std::vector<PharusVector2f> echoes;
+    //! Arrival time of the frame (see TrackLinkClient::timestampNow()), 0 until the first frame arrived
+    long long arrivalTimeNs = 0;
+};
+
+//! Lock-free triple buffer of TrackSnapshots
+/** One writer (the network thread) fills the back buffer and publishes it, one reader
+  * picks up the latest published buffer. Neither side ever waits for the other and the
+  * reader skips frames it was too slow for. Buffers are reused, so the steady state
+  * does not allocate. */
+class TrackSnapshotBuffer
+{
+public:
+    TrackSnapshotBuffer();
+
+    TrackSnapshotBuffer(const TrackSnapshotBuffer&) = delete;
+    TrackSnapshotBuffer& operator=(const TrackSnapshotBuffer&) = delete;
+
+    //! Buffer to fill next (writer only)
+    TrackSnapshot& writeBuffer();
+    //! Make the write buffer the latest snapshot (writer only)
+    void publish();
+    //! Latest published snapshot (reader only)
+    /** The returned snapshot stays valid and unchanged until the next acquire(). */
+    const TrackSnapshot& acquire();
+
+private:
+    //! Set in middle while it holds a snapshot the reader has not picked up yet
+    static constexpr int FRESH = 4;
+    static constexpr int INDEX_MASK = 3;
+
+    TrackSnapshot slots[3];
+    //! Owned by the writer
+    int back;
+    //! Owned by the reader
+    int front;
+    //! Slot index handed between writer and reader, plus FRESH
+    std::atomic<int> middle;
+};
+
+//! Turns consecutive snapshots into new/updated/lost sets
+/** Consumer side helper: feed it every acquired snapshot, it compares against the
+  * previous one it saw. Tracks that appeared and vanished between two consumed
+  * snapshots are never reported. Not thread-safe, use from the consumer only. */
+class TrackSnapshotDiff
+{
+public:
+    //! Compare snapshot against the previously applied one
+    /** \return false if snapshot is the same version as last time (nothing changed) */
+    bool apply(const TrackSnapshot& snapshot);
+
+    //! Tracks not in the previous snapshot; point into the applied snapshot
+    const std::vector<const TrackRecord*>& newTracks() const { return added; }
+    //! Tracks in both snapshots; point into the applied snapshot
+    const std::vector<const TrackRecord*>& updatedTracks() const { return updated; }
+    //! IDs of tracks in the previous snapshot that are gone now
+    const std::vector<unsigned int>& lostTrackIDs() const { return lost; }
+
+    //! Forget the previous snapshot; the next one reports all its tracks as new
+    void reset();
+    //! Keep the previous track IDs but accept the next snapshot whatever its version
+    /** For switching to another source (a new TrackLinkClient): its tracks are matched
+      * against the previous ones by ID instead of all being lost and new again. */
+    void rebase();
+
+private:
+    unsigned long long lastVersion = 0;
+    //! Sorted IDs of the previous snapshot
+    std::vector<unsigned int> previousIDs;
+    std::vector<unsigned int> currentIDs;
+    std::vector<const TrackRecord*> added;
+    std::vector<const TrackRecord*> updated;
+    std::vector<unsigned int> lost;
+};
+
+//! Combines the snapshots of several receive workers into one
+/** Used by TrackLinkClient with TrackLinkOptions::receiveWorkers > 1. Every worker owns a
+  * disjoint set of senders (the kernel hashes each sender to one socket), so their tracks
+  * are merged by ID into one sorted snapshot. Workers that have not received a frame for
+  * STALE_NS are left out: their senders moved to another socket or stopped, and keeping
+  * their last frame would report dead tracks as alive. Not thread-safe, consumer only. */
+class TrackSnapshotMerger
+{
+public:
+    //! A worker without frames for this long no longer contributes tracks
+    static constexpr long long STALE_NS = 1000000000LL;
+
+    //! Merge the latest snapshot of every worker (each sorted by ID)
+    /** \param now current time on the clock of TrackSnapshot::arrivalTimeNs
+      * \return the merged snapshot, valid and unchanged until the next merge(). Its version
+      *         only changes when a contributing part changed. If a track ID shows up in
+      *         several parts, the most recently received record wins. */
+    const TrackSnapshot& merge(const TrackSnapshot* const* parts, size_t count, long long now);
+
+    //! Track IDs reported by more than one worker so far
+    unsigned long long duplicateTracks() const { return duplicates; }
+
+private:
+    TrackSnapshot merged;
+    unsigned long long lastVersionSum = 0;
+    unsigned long long lastIncluded = 0;
+    unsigned long long duplicates = 0;
+    std::vector<const TrackSnapshot*> included;
+    std::vector<size_t> cursors;
+    std::vector<size_t> echoOffsets;
+};
+
+} // #end namespace pharus
@@ -0,0 +1,108 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#include "TrackTable.h"
+
+#include <utility>
+
+using namespace pharus;
+
+TrackTable::TrackTable()
+: bits(0)
+, mask(0)
+{
+    rehash(MIN_BITS);
+}
+
+TrackRecord& TrackTable::findOrInsert(unsigned int trackID, bool& inserted)
+{
+    // keep the index at most half full
+    if ((records.size() + 1) * 2 > index.size())
+        rehash(bits + 1);
+
+    uint32_t bucket = homeBucket(trackID);
+    for (; index[bucket] != EMPTY; bucket = (bucket + 1) & mask)
+    {
+        if (records[index[bucket]].trackID == trackID)
+        {
+            inserted = false;
+            return records[index[bucket]];
+        }
+    }
+
+    inserted = true;
+    index[bucket] = (uint32_t)records.size();
+    records.emplace_back();
+    TrackRecord& track = records.back();
+    track.trackID = trackID;
+    return track;
+}
+
+bool TrackTable::erase(unsigned int trackID)
+{
+    const int found = findBucket(trackID);
+    if (found < 0)
+        return false;
+
+    const uint32_t slot = index[found];
+
+    // backward-shift deletion: pull following entries of the probe chain into the gap
+    uint32_t gap = (uint32_t)found;
+    index[gap] = EMPTY;
+    for (uint32_t next = (gap + 1) & mask; index[next] != EMPTY; next = (next + 1) & mask)
+    {
+        const uint32_t home = homeBucket(records[index[next]].trackID);
+        // entry may move into the gap unless its home lies cyclically in (gap, next]
+        const bool homeAfterGap = (next > gap) ? (home > gap && home <= next)
+                                               : (home > gap || home <= next);
+        if (!homeAfterGap)
+        {
+            index[gap] = index[next];
+            index[next] = EMPTY;
+            gap = next;
+        }
+    }
+
+    // keep records dense: the last record takes the freed slot
+    const uint32_t last = (uint32_t)records.size() - 1;
+    if (slot != last)
+    {
+        index[findBucket(records[last].trackID)] = slot;
+        std::swap(records[slot], records[last]);
+    }
+    records.pop_back();
+    return true;
+}
+
+void TrackTable::clear()
+{
+    records.clear();
+    for (uint32_t& slot : index)
+        slot = EMPTY;
+}
+
+void TrackTable::reserve(size_t count)
+{
+    records.reserve(count);
+    int newBits = bits;
+    while ((size_t(1) << newBits) < count * 2)
+        ++newBits;
+    if (newBits != bits)
+        rehash(newBits);
+}
+
+void TrackTable::rehash(int newBits)
+{
+    bits = newBits;
+    mask = (1u << bits) - 1;
+    index.assign(size_t(1) << bits, EMPTY);
+
+    for (uint32_t slot = 0; slot < (uint32_t)records.size(); ++slot)
+    {
+        uint32_t bucket = homeBucket(records[slot].trackID);
+        while (index[bucket] != EMPTY)
+            bucket = (bucket + 1) & mask;
+        index[bucket] = slot;
+    }
+}
@@ -0,0 +1,97 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#pragma once
+
+#include "TrackRecord.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace pharus
+{
+
+//! Flat track table: dense record array plus an open-addressing ID index
+/** Records live contiguously in one array (iteration order is unspecified), the
+  * index maps a track ID to its slot with linear probing and is kept at most half
+  * full. Lookup and insert need one hash and usually one probe; erase moves the last
+  * record into the freed slot. Nothing is allocated once the table has reached its
+  * peak size.
+  * \note Insert and erase invalidate pointers and iterators to records. */
+class TrackTable
+{
+public:
+    typedef std::vector<TrackRecord>::const_iterator const_iterator;
+
+    TrackTable();
+
+    //! Number of records
+    size_t size() const { return records.size(); }
+    bool empty() const { return records.empty(); }
+
+    const_iterator begin() const { return records.begin(); }
+    const_iterator end() const { return records.end(); }
+    //! Mutable iteration; changing trackID through it corrupts the index
+    std::vector<TrackRecord>::iterator begin() { return records.begin(); }
+    std::vector<TrackRecord>::iterator end() { return records.end(); }
+
+    //! Record of trackID or nullptr
+    TrackRecord* find(unsigned int trackID)
+    {
+        const int bucket = findBucket(trackID);
+        return bucket >= 0 ? &records[index[bucket]] : nullptr;
+    }
+    const TrackRecord* find(unsigned int trackID) const
+    {
+        const int bucket = findBucket(trackID);
+        return bucket >= 0 ? &records[index[bucket]] : nullptr;
+    }
+
+    //! Record of trackID, appended (default-initialized, trackID set) if unknown
+    TrackRecord& findOrInsert(unsigned int trackID, bool& inserted);
+
+    //! Removes the record of trackID
+    /** \return false if trackID is unknown */
+    bool erase(unsigned int trackID);
+
+    //! Removes all records, keeps the allocated memory
+    void clear();
+
+    //! Make room for count records without reallocating
+    void reserve(size_t count);
+
+private:
+    static constexpr uint32_t EMPTY = 0xFFFFFFFFu;
+    static constexpr int MIN_BITS = 6;
+
+    //! Fibonacci hashing: spreads sequential IDs over the whole index
+    uint32_t homeBucket(unsigned int trackID) const
+    {
+        return (uint32_t)(trackID * 2654435769u) >> (32 - bits);
+    }
+
+    //! Bucket holding trackID, or -1
+    int findBucket(unsigned int trackID) const
+    {
+        for (uint32_t bucket = homeBucket(trackID); ; bucket = (bucket + 1) & mask)
+        {
+            const uint32_t slot = index[bucket];
+            if (slot == EMPTY)
+                return -1;
+            if (records[slot].trackID == trackID)
+                return (int)bucket;
+        }
+    }
+
+    //! Resizes the index to 2^newBits buckets and reinserts all records
+    void rehash(int newBits);
+
+    std::vector<TrackRecord> records;
+    //! Slot in records per bucket, or EMPTY
+    std::vector<uint32_t> index;
+    int bits;
+    uint32_t mask;
+};
+
+} // #end namespace pharus
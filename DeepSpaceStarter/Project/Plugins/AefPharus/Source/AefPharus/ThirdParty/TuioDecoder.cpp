@@ -0,0 +1,257 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#include "TuioDecoder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace pharus;
+
+namespace
+{
+    //! Most arguments of a "set" (2Dblb: s x y a w h f X Y A m r)
+    constexpr int MAX_SET_ARGS = 12;
+    //! Initial capacity, sessions beyond it grow the buffers once
+    constexpr size_t INITIAL_SESSIONS = 256;
+}
+
+TuioDecoder::TuioDecoder(PharusVector2f _area)
+: area(_area)
+, outdated(0)
+{
+    // argument positions after "set" (TUIO 1.1):
+    //   2Dcur: s x y X Y m
+    //   2Dobj: s i x y a X Y A m r
+    //   2Dblb: s x y a w h f X Y A m r
+    static const struct { const char* address; int posArg, velocityArg, angleArg, setArgs; } layouts[PROFILE_COUNT] =
+    {
+        { "/tuio/2Dcur", 1, 3, -1, 6 },
+        { "/tuio/2Dobj", 2, 5, 4, 10 },
+        { "/tuio/2Dblb", 1, 7, 3, 12 },
+    };
+    for (int i = 0; i < PROFILE_COUNT; ++i)
+    {
+        Profile& profile = profiles[i];
+        profile.address = layouts[i].address;
+        profile.posArg = layouts[i].posArg;
+        profile.velocityArg = layouts[i].velocityArg;
+        profile.angleArg = layouts[i].angleArg;
+        profile.setArgs = layouts[i].setArgs;
+        profile.sessions.reserve(INITIAL_SESSIONS);
+        profile.alive.reserve(INITIAL_SESSIONS);
+        profile.aliveSeen = false;
+        profile.pending.reserve(INITIAL_SESSIONS);
+        profile.lastFrame = 0;
+        profile.hasFrame = false;
+    }
+    frameRecords.reserve(INITIAL_SESSIONS);
+    leaving.reserve(INITIAL_SESSIONS);
+}
+
+void TuioDecoder::beginPacket()
+{
+    for (Profile& profile : profiles)
+    {
+        profile.alive.clear();
+        profile.aliveSeen = false;
+        profile.pending.clear();
+    }
+}
+
+TuioDecoder::Result TuioDecoder::add(const OscMessageView& message)
+{
+    // cheap reject for everything that is not TUIO
+    const char* address = message.address();
+    if (strncmp(address, "/tuio/", 6) != 0)
+        return IGNORED;
+
+    for (Profile& profile : profiles)
+    {
+        if (!message.hasAddress(profile.address))
+            continue;
+
+        OscMessageView::Reader args = message.arguments();
+        const char* command = nullptr;
+        if (!args.readString(command))
+            return MALFORMED;
+        if (strcmp(command, "set") == 0)
+            return set(profile, args);
+        if (strcmp(command, "alive") == 0)
+            return alive(profile, args);
+        if (strcmp(command, "fseq") == 0)
+            return endFrame(profile, args);
+        // "source" and extensions
+        return IGNORED;
+    }
+    return IGNORED;
+}
+
+TuioDecoder::Result TuioDecoder::set(Profile& profile, OscMessageView::Reader args)
+{
+    int32_t sessionID = 0;
+    float values[MAX_SET_ARGS];
+    if (!args.readInt(sessionID))
+        return MALFORMED;
+    for (int i = 1; i < profile.setArgs; ++i)
+    {
+        if (!args.readFloat(values[i]))
+            return MALFORMED;
+    }
+
+    TrackRecord update;
+    update.trackID = (unsigned int)sessionID;
+    update.state = TS_CONT;
+    update.relPos.x = values[profile.posArg];
+    update.relPos.y = values[profile.posArg + 1];
+    update.currentPos.x = update.relPos.x * area.x;
+    update.currentPos.y = update.relPos.y * area.y;
+    update.expectPos = update.currentPos;
+
+    // TUIO velocities are in area units per second
+    const float vx = values[profile.velocityArg] * area.x;
+    const float vy = values[profile.velocityArg + 1] * area.y;
+    update.speed = std::sqrt(vx * vx + vy * vy);
+    if (update.speed > 1e-4f)
+    {
+        update.orientation.x = vx / update.speed;
+        update.orientation.y = vy / update.speed;
+    }
+    else if (profile.angleArg >= 0)
+    {
+        // objects and blobs standing still still have an angle
+        update.orientation.x = std::cos(values[profile.angleArg]);
+        update.orientation.y = std::sin(values[profile.angleArg]);
+    }
+    else
+    {
+        // no direction, endFrame() keeps the previous heading
+        update.orientation.x = 0.0f;
+        update.orientation.y = 0.0f;
+    }
+    profile.pending.push_back(update);
+    return CONSUMED;
+}
+
+TuioDecoder::Result TuioDecoder::alive(Profile& profile, OscMessageView::Reader args)
+{
+    profile.alive.clear();
+    while (!args.atEnd())
+    {
+        int32_t sessionID = 0;
+        if (!args.readInt(sessionID))
+        {
+            profile.alive.clear();
+            profile.aliveSeen = false;
+            return MALFORMED;
+        }
+        profile.alive.push_back(sessionID);
+    }
+    profile.aliveSeen = true;
+    return CONSUMED;
+}
+
+TuioDecoder::Result TuioDecoder::endFrame(Profile& profile, OscMessageView::Reader args)
+{
+    int32_t frameID = 0;
+    if (!args.readInt(frameID))
+        return MALFORMED;
+
+    // -1 marks a redundant bundle (periodic refresh): applied, but it does not advance the sequence
+    const bool redundant = frameID == -1;
+    bool continuation = false;
+    if (!redundant && profile.hasFrame)
+    {
+        const long long behind = (long long)profile.lastFrame - frameID;
+        if (behind > 0 && behind < RESTART_DISTANCE)
+        {
+            // reordered datagram, the sessions are newer already
+            ++outdated;
+            profile.pending.clear();
+            profile.alive.clear();
+            profile.aliveSeen = false;
+            return CONSUMED;
+        }
+        // a frame too large for one datagram comes in several bundles with the same fseq
+        continuation = behind == 0;
+    }
+    if (!redundant)
+    {
+        profile.lastFrame = frameID;
+        profile.hasFrame = true;
+    }
+
+    for (const TrackRecord& update : profile.pending)
+    {
+        bool inserted = false;
+        TrackRecord& session = profile.sessions.findOrInsert(update.trackID, inserted);
+        const bool directionless = update.orientation.x == 0.0f && update.orientation.y == 0.0f;
+        const PharusVector2f orientation = directionless && !inserted ? session.orientation : update.orientation;
+        const TrackState state = inserted ? TS_NEW : session.state;
+        session = update;
+        session.orientation = orientation;
+        session.state = state;
+    }
+
+    frameRecords.clear();
+    if (profile.aliveSeen && !continuation)
+    {
+        // complete frame: every live session, and the ones that left. Sessions are emitted in
+        // "alive" order and marked TS_OFF meanwhile (leavers are erased, so the table never holds
+        // TS_OFF otherwise); one pass over the table then finds the unmarked ones.
+        for (int32_t sessionID : profile.alive)
+        {
+            TrackRecord* session = profile.sessions.find((unsigned int)sessionID);
+            // unknown sessions have not been set yet, duplicates are listed once
+            if (!session || session->state == TS_OFF)
+                continue;
+            frameRecords.push_back(*session);
+            session->state = TS_OFF;
+        }
+
+        leaving.clear();
+        for (TrackRecord& session : profile.sessions)
+        {
+            if (session.state == TS_OFF)
+            {
+                session.state = TS_CONT;
+                continue;
+            }
+            // a session that never made it into a frame leaves silently
+            if (session.state != TS_NEW)
+            {
+                frameRecords.push_back(session);
+                frameRecords.back().state = TS_OFF;
+            }
+            leaving.push_back(session.trackID);
+        }
+        for (unsigned int trackID : leaving)
+            profile.sessions.erase(trackID);
+    }
+    else
+    {
+        if (profile.aliveSeen)
+            std::sort(profile.alive.begin(), profile.alive.end());
+        auto isAlive = [&profile](unsigned int trackID)
+        {
+            return !profile.aliveSeen || std::binary_search(profile.alive.begin(), profile.alive.end(), (int32_t)trackID);
+        };
+
+        // the rest of a split frame, or a sender without "alive": only what was set
+        for (const TrackRecord& update : profile.pending)
+        {
+            TrackRecord* session = profile.sessions.find(update.trackID);
+            if (!session || !isAlive(update.trackID))
+                continue;
+            frameRecords.push_back(*session);
+            session->state = TS_CONT;
+        }
+    }
+
+    profile.pending.clear();
+    profile.alive.clear();
+    profile.aliveSeen = false;
+    return FRAME;
+}
@@ -0,0 +1,96 @@
+/*========================================================================
+   Copyright (c) Ars Electronica Futurelab, 2013-2025
+  ========================================================================*/
+
+#pragma once
+
+#include "OscPacket.h"
+#include "TrackRecord.h"
+#include "TrackTable.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace pharus
+{
+
+//! Turns TUIO 1.1 messages into TrackLink style frames
+/** Understands the 2D profiles /tuio/2Dcur, /tuio/2Dobj and /tuio/2Dblb. TUIO is
+  * stateful: per frame a sender lists the live session IDs ("alive"), sends "set" only
+  * for the sessions that changed and closes the frame with "fseq". The decoder keeps
+  * every session's last values, so each frame comes out like a TrackLink frame: one
+  * record per live session (TS_NEW the first time, then TS_CONT) and a TS_OFF record
+  * for every session that left.
+  *
+  * TUIO carries relative positions and velocities only; currentPos and the speed are
+  * scaled by the size of the tracking area, expectPos equals currentPos and there are no
+  * echoes. Session IDs become track IDs, so one sender per decoder.
+  *
+  * Nothing is allocated once the decoder has seen its peak number of sessions. */
+class TuioDecoder
+{
+public:
+    //! What a message did
+    enum Result
+    {
+        //! Not TUIO, or a TUIO message without meaning here ("source", other profiles)
+        IGNORED,
+        //! Taken into the frame being built
+        CONSUMED,
+        //! Completed a frame, see frame()
+        FRAME,
+        //! A TUIO 2D message with missing or mistyped arguments (dropped)
+        MALFORMED
+    };
+
+    //! \param area size of the tracking area in meters (the TUIO unit square)
+    explicit TuioDecoder(PharusVector2f area);
+
+    //! Starts a packet: a frame left without its "fseq" by the previous packet is dropped
+    void beginPacket();
+    //! Feeds one OSC message
+    Result add(const OscMessageView& message);
+    //! Records of the frame the last FRAME result completed, valid until the next add()
+    const std::vector<TrackRecord>& frame() const { return frameRecords; }
+
+    //! Frames dropped because their "fseq" was older than the latest one (reordered datagrams)
+    unsigned long long outdatedFrames() const { return outdated; }
+
+private:
+    //! One of the 2D profiles and its sessions
+    struct Profile
+    {
+        const char* address;
+        //! Argument index (after "set") of x and of the velocity X, -1 = no angle
+        int posArg;
+        int velocityArg;
+        int angleArg;
+        //! Arguments of a "set" (after "set")
+        int setArgs;
+
+        TrackTable sessions;
+        //! Frame being built
+        std::vector<int32_t> alive;
+        bool aliveSeen;
+        std::vector<TrackRecord> pending;
+        //! Latest accepted "fseq"
+        int32_t lastFrame;
+        bool hasFrame;
+    };
+
+    static constexpr int PROFILE_COUNT = 3;
+    //! Sequence numbers this far behind the latest one mean the sender restarted
+    static constexpr int32_t RESTART_DISTANCE = 100;
+
+    Result set(Profile& profile, OscMessageView::Reader args);
+    Result alive(Profile& profile, OscMessageView::Reader args);
+    Result endFrame(Profile& profile, OscMessageView::Reader args);
+
+    PharusVector2f area;
+    Profile profiles[PROFILE_COUNT];
+    std::vector<TrackRecord> frameRecords;
+    std::vector<unsigned int> leaving;
+    unsigned long long outdated;
+};
+
+} // #end namespace pharus
@@ -11,34 +11,44 @@
 	#include <Ws2tcpip.h>		// TCP/IP annex needed for multicasting
 	#include "Windows/HideWindowsPlatformTypes.h" 
 	typedef int socklen_t; // ID NOTE: OTTO STUFF for WIN32
+#else
+	#include <errno.h>
+	#if PLATFORM_LINUX
+		#include <sys/socket.h>		// recvmmsg(), SO_TIMESTAMPNS, SO_RXQ_OVFL, SO_BUSY_POLL
+		#include <stdint.h>
+		#include <time.h>
+	#endif
 #endif
-
-//--------------------------------------------------------------------------------
-bool UDPManager::m_bWinsockInit= false;
+#include <chrono>
 
 //--------------------------------------------------------------------------------
 UDPManager::UDPManager()
 {
-	// was winsock initialized?
-///#ifdef WIN32
-	if (!m_bWinsockInit) {
+	// initialize winsock once; thread-safe, receive workers create sockets concurrently
+	static const bool bWinsockInit = []()
+	{
 		WORD vr;
 		WSADATA	wsaData;
 		vr=	MAKEWORD(2,	2);
 		WSAStartup(vr, &wsaData);
-		m_bWinsockInit=	true;
-	}
-///#else // UNIX
-///	m_bWinsockInit=	true;
-///#endif
+		return true;
+	}();
+	(void)bWinsockInit;
 
 	m_hSocket= INVALID_SOCKET;
+	m_hWakeup= INVALID_SOCKET;
 	m_lTimeoutReceive= DEFAULT_TIMEOUT;
 	m_lTimeoutSend= DEFAULT_TIMEOUT;
 
 	m_nLastError = 0;
 
-	memset(&m_saRemote, 0, sizeof(m_saRemote));
+	m_nRecvSyscalls = 0;
+	m_nRecvDatagrams = 0;
+	m_bKernelTimestamps = false;
+	m_bDropCounter = false;
+	m_nKernelDrops = 0;
+
+	static_cast<sockaddr_in&>(m_saRemote) = sockaddr_in();
 	m_bHaveRemoteAddress= false;
 
 };
@@ -66,6 +76,8 @@ bool UDPManager::Close()
 		return(false);
 	}
 	m_hSocket= INVALID_SOCKET;
+	m_bKernelTimestamps = false;
+	m_bDropCounter = false;
 
 	return(true);
 }
@@ -180,7 +192,14 @@ bool UDPManager::BindMcast(const InetAddr &_addr)
 bool UDPManager::BindMcast(const char *pMcast, const char *localIP, USHORT usPort) // ID NOTE: BindMcast to specific NIC
 {
     // bind to port
-    if (!Bind(usPort, localIP))
+#if PLATFORM_WINDOWS
+    const char* bindIP = localIP;
+#else
+    // the destination address must match the bound one: bound to the NIC address, no
+    // multicast datagram is delivered. The membership below selects the NIC instead.
+    const char* bindIP = pMcast;
+#endif
+    if (!Bind(usPort, bindIP))
     {
         #ifndef NO_TRACELOG
         int error = setLastError();
@@ -291,7 +310,7 @@ bool UDPManager::ConnectMcast(const InetAddr &_addr)
 //--------------------------------------------------------------------------------
 bool UDPManager::Connect(const char *pHost, USHORT usPort)
 {
-	memset(&m_saRemote, 0, sizeof(m_saRemote));
+	static_cast<sockaddr_in&>(m_saRemote) = sockaddr_in();
 
 	if (m_hSocket == INVALID_SOCKET)
 	{
@@ -308,7 +327,7 @@ bool UDPManager::Connect(const char *pHost, USHORT usPort)
 
 			#ifndef NO_TRACELOG
 			int error = setLastError();
-			UE_LOG(LogAefPharus, Error, TEXT("UDPManager::Connect: gethostbyname(\"%hs\") failed: %d!"), pHost, error);
+			UE_LOG(LogAefPharus, Error, TEXT("UDPManager::Connect: gethostbyname(\"%s\") failed: %d!"), ANSI_TO_TCHAR(pHost), error);
 			#endif
 			return false;
 		}
@@ -320,7 +339,7 @@ bool UDPManager::Connect(const char *pHost, USHORT usPort)
 		if ((m_saRemote.sin_addr.s_addr = inet_addr(pHost)) == INADDR_NONE)
 		{
 			#ifndef NO_TRACELOG
-			UE_LOG(LogAefPharus, Error, TEXT("UDPManager::Connect: inet_addr(\"%hs\") failed!"), pHost);
+			UE_LOG(LogAefPharus, Error, TEXT("UDPManager::Connect: inet_addr(\"%s\") failed!"), ANSI_TO_TCHAR(pHost));
 
 			#endif
 			return false;
@@ -432,14 +451,14 @@ int	UDPManager::Send(const void* pBuff, const int iSize)
 	if (ret	>= 0)
 	{
 		#ifndef NO_TRACELOG
-        UE_LOG(LogAefPharus, VeryVerbose, TEXT("UDPManager::Send: sent %d bytes to: %hs/%d"), ret, inet_ntoa((in_addr)m_saRemote.sin_addr), ntohs(m_saRemote.sin_port));
+        UE_LOG(LogAefPharus, VeryVerbose, TEXT("UDPManager::Send: sent %d bytes to: %s/%d"), ret, ANSI_TO_TCHAR(inet_ntoa((in_addr)m_saRemote.sin_addr)), ntohs(m_saRemote.sin_port));
 		#endif
 	}
 	else
 	{
 		#ifndef NO_TRACELOG
 		int error = setLastError();
-		UE_LOG(LogAefPharus, Error, TEXT("UDPManager::Send: sent %d bytes to: %hs/%d"), ret, inet_ntoa((in_addr)m_saRemote.sin_addr), ntohs(m_saRemote.sin_port));
+		UE_LOG(LogAefPharus, Error, TEXT("UDPManager::Send: sent %d bytes to: %s/%d, error %d"), ret, ANSI_TO_TCHAR(inet_ntoa((in_addr)m_saRemote.sin_addr)), ntohs(m_saRemote.sin_port), error);
 		#endif
 	}
 
@@ -508,6 +527,7 @@ int	UDPManager::Receive(void* pBuff, const int iSize)
 		FD_SET(m_hSocket, &fd);
 		struct timeval tv= { m_lTimeoutReceive, 0 };
 		int ret = select((int)m_hSocket+1, &fd, NULL, NULL, &tv);
+		++m_nRecvSyscalls;
 		if (ret == 0)
 		{
 			return(SOCKET_TIMEOUT);
@@ -521,10 +541,12 @@ int	UDPManager::Receive(void* pBuff, const int iSize)
 	memset(pBuff, 0, iSize);
 	socklen_t nLen= sizeof(m_saRemote);
 	int	ret= recvfrom(m_hSocket, (char*)pBuff, iSize, 0, (struct sockaddr*)&m_saRemote, &nLen);
+	++m_nRecvSyscalls;
 	if (ret	>= 0)
 	{
+		++m_nRecvDatagrams;
 		#ifndef NO_TRACELOG
-		UE_LOG(LogAefPharus, VeryVerbose, TEXT("UDPManager::Receive: received %d bytes from: %hs/%d"), ret, inet_ntoa((in_addr)m_saRemote.sin_addr), ntohs(m_saRemote.sin_port));
+		UE_LOG(LogAefPharus, VeryVerbose, TEXT("UDPManager::Receive: received %d bytes from: %s/%d"), ret, ANSI_TO_TCHAR(inet_ntoa((in_addr)m_saRemote.sin_addr)), ntohs(m_saRemote.sin_port));
 		#endif
 		m_bHaveRemoteAddress= true;
 	}
@@ -542,6 +564,248 @@ int	UDPManager::Receive(void* pBuff, const int iSize)
 	return ret;
 }
 
+//--------------------------------------------------------------------------------
+//*	Waits for the first datagram like Receive(), then drains everything already
+//*	queued on the socket (at most iMaxCount, capped to UDP_MAX_BATCH) without
+//*	blocking again. On Linux this is a single recvmmsg() call, elsewhere a
+//*	recvfrom() loop. The buffers are not cleared; use iSize of each slot.
+//*	Return values:
+//*	number of datagrams stored in pDatagrams (>0)
+//*	SOCKET_TIMEOUT indicates timeout (or nothing queued)
+//*	SOCKET_ERROR in	case of a problem.
+int	UDPManager::ReceiveBatch(UDPDatagram* pDatagrams, const int iMaxCount)
+{
+	if (m_hSocket == INVALID_SOCKET || pDatagrams == NULL || iMaxCount <= 0)
+	{
+		return(SOCKET_ERROR);
+	}
+
+	if (m_lTimeoutReceive != NO_TIMEOUT)
+	{
+		fd_set fd;
+		FD_ZERO(&fd);
+		FD_SET(m_hSocket, &fd);
+		SOCKET hMax = m_hSocket;
+		if (m_hWakeup != INVALID_SOCKET)
+		{
+			FD_SET(m_hWakeup, &fd);
+			hMax = (m_hWakeup > hMax) ? m_hWakeup : hMax;
+		}
+		struct timeval tv= { m_lTimeoutReceive, 0 };
+		int ret = select((int)hMax+1, &fd, NULL, NULL, &tv);
+		++m_nRecvSyscalls;
+		if (ret == 0)
+		{
+			return(SOCKET_TIMEOUT);
+		}
+		else if (ret < 0)
+		{
+			return(SOCKET_ERROR);
+		}
+		else if (!FD_ISSET(m_hSocket, &fd))
+		{
+			return(SOCKET_TIMEOUT);	// woken up, nothing to read
+		}
+	}
+
+	const int iMax = (iMaxCount < UDP_MAX_BATCH) ? iMaxCount : UDP_MAX_BATCH;
+	int nCount = 0;
+
+#if PLATFORM_LINUX
+	struct mmsghdr msgs[UDP_MAX_BATCH];
+	struct iovec iovs[UDP_MAX_BATCH];
+	// ancillary data per datagram (kernel timestamp, drop counter)
+	union UDPControl
+	{
+		char buf[CMSG_SPACE(sizeof(struct timespec)) + CMSG_SPACE(sizeof(uint32_t))];
+		struct cmsghdr align;
+	};
+	UDPControl ctrl[UDP_MAX_BATCH];
+	const bool bControl = m_bKernelTimestamps || m_bDropCounter;
+	memset(msgs, 0, sizeof(struct mmsghdr) * iMax);
+	for (int i = 0; i < iMax; ++i)
+	{
+		iovs[i].iov_base = pDatagrams[i].pBuff;
+		iovs[i].iov_len = pDatagrams[i].iCapacity;
+		msgs[i].msg_hdr.msg_iov = &iovs[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+		msgs[i].msg_hdr.msg_name = &pDatagrams[i].saRemote;
+		msgs[i].msg_hdr.msg_namelen = sizeof(pDatagrams[i].saRemote);
+		if (bControl)
+		{
+			msgs[i].msg_hdr.msg_control = ctrl[i].buf;
+			msgs[i].msg_hdr.msg_controllen = sizeof(ctrl[i].buf);
+		}
+	}
+
+	// readiness is known after select(); without a timeout block for the first datagram only
+	const int iFlags = (m_lTimeoutReceive != NO_TIMEOUT) ? MSG_DONTWAIT : MSG_WAITFORONE;
+	int ret = recvmmsg(m_hSocket, msgs, iMax, iFlags, NULL);
+	++m_nRecvSyscalls;
+	if (ret < 0)
+	{
+		if (errno == EAGAIN || errno == EWOULDBLOCK)
+		{
+			return(SOCKET_TIMEOUT);
+		}
+		#ifndef NO_TRACELOG
+		int error = setLastError();
+		UE_LOG(LogAefPharus, Error, TEXT("UDPManager::ReceiveBatch: received error: %d"), error);
+		#endif
+		m_bHaveRemoteAddress= false;
+		return(SOCKET_ERROR);
+	}
+	const long long llNow = GetTimestampNow();
+	for (int i = 0; i < ret; ++i)
+	{
+		pDatagrams[i].iSize = (int)msgs[i].msg_len;
+		pDatagrams[i].llTimestampNs = llNow;
+		if (bControl)
+		{
+			for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msgs[i].msg_hdr); cmsg != NULL; cmsg = CMSG_NXTHDR(&msgs[i].msg_hdr, cmsg))
+			{
+				if (cmsg->cmsg_level != SOL_SOCKET)
+				{
+					continue;
+				}
+				if (cmsg->cmsg_type == SCM_TIMESTAMPNS)
+				{
+					struct timespec ts;
+					memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+					pDatagrams[i].llTimestampNs = (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+				}
+				#ifdef SO_RXQ_OVFL
+				else if (cmsg->cmsg_type == SO_RXQ_OVFL)
+				{
+					// cumulative drops of the socket when this datagram was queued; only sent once non-zero
+					uint32_t drops;
+					memcpy(&drops, CMSG_DATA(cmsg), sizeof(drops));
+					if (drops > m_nKernelDrops)
+					{
+						m_nKernelDrops = drops;
+					}
+				}
+				#endif
+			}
+		}
+	}
+	nCount = ret;
+#else
+	while (nCount < iMax)
+	{
+		// first datagram is known to be ready, the rest only if still queued
+		if (nCount > 0)
+		{
+			bool bReadable = IsReadable();
+			++m_nRecvSyscalls;
+			if (!bReadable)
+			{
+				break;
+			}
+		}
+
+		UDPDatagram& dgram = pDatagrams[nCount];
+		socklen_t nLen= sizeof(dgram.saRemote);
+		int	ret= recvfrom(m_hSocket, dgram.pBuff, dgram.iCapacity, 0, (struct sockaddr*)&dgram.saRemote, &nLen);
+		++m_nRecvSyscalls;
+		if (ret < 0)
+		{
+			if (nCount > 0)
+			{
+				break;	// deliver what we have, the error shows up on the next call
+			}
+#if PLATFORM_WINDOWS
+			if (WSAGetLastError() == WSAEWOULDBLOCK)
+#else
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+#endif
+			{
+				return(SOCKET_TIMEOUT);	// non-blocking socket, nothing queued
+			}
+			#ifndef NO_TRACELOG
+			int error = setLastError();
+			UE_LOG(LogAefPharus, Error, TEXT("UDPManager::ReceiveBatch: received error: %d"), error);
+			#endif
+			m_bHaveRemoteAddress= false;
+			return(SOCKET_ERROR);
+		}
+		dgram.iSize = ret;
+		dgram.llTimestampNs = GetTimestampNow();
+		++nCount;
+	}
+#endif
+
+	if (nCount > 0)
+	{
+		m_nRecvDatagrams += nCount;
+		m_saRemote = pDatagrams[nCount - 1].saRemote;
+		m_bHaveRemoteAddress= true;
+		#ifndef NO_TRACELOG
+		UE_LOG(LogAefPharus, VeryVerbose, TEXT("UDPManager::ReceiveBatch: received %d datagrams"), nCount);
+		#endif
+	}
+
+	return nCount > 0 ? nCount : SOCKET_TIMEOUT;
+}
+
+
+//--------------------------------------------------------------------------------
+bool UDPManager::EnableReceiveTimestamps()
+{
+	if (m_hSocket == INVALID_SOCKET)
+	{
+		return false;
+	}
+
+#if PLATFORM_LINUX
+	int on = 1;
+	m_bKernelTimestamps = (setsockopt(m_hSocket, SOL_SOCKET, SO_TIMESTAMPNS, (char*)&on, sizeof(on)) == 0);
+#else
+	m_bKernelTimestamps = false;
+#endif
+	return m_bKernelTimestamps;
+}
+
+//--------------------------------------------------------------------------------
+bool UDPManager::EnableDropCounter()
+{
+	if (m_hSocket == INVALID_SOCKET)
+	{
+		return false;
+	}
+
+	m_nKernelDrops = 0;
+#if PLATFORM_LINUX && defined(SO_RXQ_OVFL)
+	int on = 1;
+	m_bDropCounter = (setsockopt(m_hSocket, SOL_SOCKET, SO_RXQ_OVFL, (char*)&on, sizeof(on)) == 0);
+#else
+	m_bDropCounter = false;
+#endif
+	return m_bDropCounter;
+}
+
+//--------------------------------------------------------------------------------
+bool UDPManager::EnableBusyPoll(int iMicroseconds)
+{
+	if (m_hSocket == INVALID_SOCKET || iMicroseconds <= 0)
+	{
+		return false;
+	}
+
+#if PLATFORM_LINUX && defined(SO_BUSY_POLL)
+	return (setsockopt(m_hSocket, SOL_SOCKET, SO_BUSY_POLL, (char*)&iMicroseconds, sizeof(iMicroseconds)) == 0);
+#else
+	return false;
+#endif
+}
+
+//--------------------------------------------------------------------------------
+long long UDPManager::GetTimestampNow()
+{
+	// same clock as SO_TIMESTAMPNS (CLOCK_REALTIME)
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::system_clock::now().time_since_epoch()).count();
+}
 
 //--------------------------------------------------------------------------------
 bool UDPManager::GetRemoteAddr(char* pAddress, USHORT* pPort)
@@ -575,6 +839,17 @@ bool UDPManager::GetRemoteAddr(InetAddr &_addr)
 	return true;
 }
 
+//--------------------------------------------------------------------------------
+bool UDPManager::GetLocalAddr(InetAddr &_addr)
+{
+	if (m_hSocket == INVALID_SOCKET)
+	{
+		return(false);
+	}
+	socklen_t nLen= sizeof(_addr);
+	return (getsockname(m_hSocket, (struct sockaddr*)&_addr, &nLen) == 0);
+}
+
 int	UDPManager::GetMaxMsgSize()
 {
 	if (m_hSocket == INVALID_SOCKET)
@@ -728,7 +1003,7 @@ bool UDPManager::GetLocalHost(char* pName, char* pAddress, char* pBroadcast)
 	if ((he = gethostbyname(pName)) == NULL)
 	{
 		#ifndef NO_TRACELOG
-		UE_LOG(LogAefPharus, Error, TEXT("UDPManager::GetLocalHost: gethostbyname(\"%hs\") failed! Error: %d"), pName, WSAGetLastError());
+		UE_LOG(LogAefPharus, Error, TEXT("UDPManager::GetLocalHost: gethostbyname(\"%s\") failed! Error: %d"), ANSI_TO_TCHAR(pName), WSAGetLastError());
 		#endif
 	}
 	else
@@ -810,7 +1085,7 @@ bool UDPManager::SetBlocking(bool bIsBlockingA)
 		return false;
 	}
 
-	unsigned long onL = (bIsBlockingA) ? 1:0;
+	unsigned long onL = (bIsBlockingA) ? 0:1;	// FIONBIO enables non-blocking mode
 	if (ioctlsocket(m_hSocket, FIONBIO, &onL) == SOCKET_ERROR)
 	{
 		#ifndef NO_TRACELOG
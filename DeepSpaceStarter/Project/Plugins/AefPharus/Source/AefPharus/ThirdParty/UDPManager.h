@@ -59,8 +59,52 @@ UDP Multicast (receiving):
 ...
 x) Close()
 
+UDP Batched receiving:
+--------------
+
+Like the receiving cases above, but use ReceiveBatch() with an array of
+UDPDatagram slots to drain every datagram already queued on the socket
+in one call (recvmmsg() on Linux, recvfrom() loop elsewhere).
+
+optional:
+EnableReceiveTimestamps() - every datagram is stamped with its arrival time
+(by the kernel where SO_TIMESTAMPNS exists, right after the receive call otherwise)
+EnableDropCounter() - GetKernelDropCount() reports datagrams the kernel dropped
+because the socket receive buffer was full (SO_RXQ_OVFL, Linux only)
+
+UDP Polled receiving:
+--------------
+
+SetBlocking(false) + SetTimeoutReceive(NO_TIMEOUT): ReceiveBatch() returns
+SOCKET_TIMEOUT immediately when nothing is queued, so the caller can spin on it.
+
+optional:
+EnableBusyPoll() - the kernel polls the network device for a while on empty
+receives instead of waiting for the interrupt (SO_BUSY_POLL, Linux only)
+
+UDP Interruptible receiving:
+--------------
+
+SetWakeup() with the handle of a pharus::TrackLinkWakeup (or any other selectable
+handle): once it becomes readable, a ReceiveBatch() waiting for data returns
+SOCKET_TIMEOUT right away instead of after the receive timeout.
+
 --------------------------------------------------------------------------------*/
 
+/// Upper bound of datagrams fetched by a single ReceiveBatch() call.
+#define UDP_MAX_BATCH       64
+
+//--------------------------------------------------------------------------------
+//* One receive slot for ReceiveBatch(). The caller owns the payload storage.
+struct UDPDatagram
+{
+	char*		pBuff;		// payload storage (caller owned)
+	int			iCapacity;	// size of pBuff in bytes
+	int			iSize;		// bytes received, set by ReceiveBatch()
+	InetAddr	saRemote;	// sender of this datagram, set by ReceiveBatch()
+	long long	llTimestampNs;	// arrival time (see UDPManager::GetTimestampNow()), set by ReceiveBatch()
+};
+
 //--------------------------------------------------------------------------------
 //--------------------------------------------------------------------------------
 
@@ -94,9 +138,39 @@ public:
 	int Send(const void* pBuff, const int iSize); 
 	int SendAll(const void* pBuff, const int iSize);	//all data will be sent guaranteed.
 	int Receive(void* pBuff, const int iSize);
+	int ReceiveBatch(UDPDatagram* pDatagrams, const int iMaxCount);	//returns number of datagrams received
+
+	/// stamp received datagrams in the kernel (SO_TIMESTAMPNS). Call after Create().
+	/// returns false if not supported; ReceiveBatch() then stamps after the receive call
+	bool EnableReceiveTimestamps();
+	bool HasKernelTimestamps() const
+	{
+		return m_bKernelTimestamps;
+	}
+	/// current time on the clock of UDPDatagram::llTimestampNs (ns since the Unix epoch, wall clock)
+	static long long GetTimestampNow();
+
+	/// count datagrams dropped by the kernel on this socket (SO_RXQ_OVFL). Call after Create().
+	/// returns false if not supported
+	bool EnableDropCounter();
+	bool HasDropCounter() const
+	{
+		return m_bDropCounter;
+	}
+	/// datagrams dropped because the receive buffer was full, as of the last ReceiveBatch()
+	unsigned long long GetKernelDropCount() const
+	{
+		return m_nKernelDrops;
+	}
+
+	/// let the kernel busy-poll the device queue for up to iMicroseconds on an empty receive (SO_BUSY_POLL).
+	/// Call after Create(). returns false if not supported or not permitted (raising it above
+	/// net.core.busy_read requires CAP_NET_ADMIN)
+	bool EnableBusyPoll(int iMicroseconds);
 
 	bool GetRemoteAddr(char* pAddress, USHORT* pPort);	//returns IP/Port of last received packet
 	bool GetRemoteAddr(InetAddr &_addr);				//returns IP/Port of last received packet
+	bool GetLocalAddr(InetAddr &_addr);					//returns IP/Port the socket is bound to
 
 	bool SetReuseAddress(bool allowReuse);
 	bool SetEnableBroadcast(bool enableBroadcast);
@@ -125,6 +199,22 @@ public:
 	{
 		return m_lTimeoutReceive;
 	}
+	/// handle that interrupts the wait of ReceiveBatch() when readable; INVALID_SOCKET for none.
+	/// Not owned, must stay open while set
+	void SetWakeup(SOCKET hWakeup)
+	{
+		m_hWakeup= hWakeup;
+	}
+
+	/// receive statistics: syscalls issued (select + recv*) and datagrams received
+	unsigned long long GetReceiveSyscallCount() const
+	{
+		return m_nRecvSyscalls;
+	}
+	unsigned long long GetReceiveDatagramCount() const
+	{
+		return m_nRecvDatagrams;
+	}
 
 	static bool GetLocalHost(char* pName, char* pAddress, char* pBroadcast);
 
@@ -142,6 +232,7 @@ protected:
 	int setLastError();
 
 	SOCKET m_hSocket;
+	SOCKET m_hWakeup;
 
 	long m_lTimeoutReceive;
 	long m_lTimeoutSend;
@@ -151,5 +242,10 @@ protected:
 
 	int m_nLastError;
 
-	static bool m_bWinsockInit;
+	unsigned long long m_nRecvSyscalls;
+	unsigned long long m_nRecvDatagrams;
+
+	bool m_bKernelTimestamps;
+	bool m_bDropCounter;
+	unsigned long long m_nKernelDrops;
 };
\ No newline at end of file